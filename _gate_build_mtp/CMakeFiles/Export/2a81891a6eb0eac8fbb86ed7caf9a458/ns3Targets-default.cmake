@@ -0,0 +1,49 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "default".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "ns3::libcore" for configuration "default"
+set_property(TARGET ns3::libcore APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libcore PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-core-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-core-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libcore )
+list(APPEND _cmake_import_check_files_for_ns3::libcore "${_IMPORT_PREFIX}/lib/libns3-dev-core-default.so" )
+
+# Import target "ns3::libmtp" for configuration "default"
+set_property(TARGET ns3::libmtp APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libmtp PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-mtp-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-mtp-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libmtp )
+list(APPEND _cmake_import_check_files_for_ns3::libmtp "${_IMPORT_PREFIX}/lib/libns3-dev-mtp-default.so" )
+
+# Import target "ns3::libnetwork" for configuration "default"
+set_property(TARGET ns3::libnetwork APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libnetwork PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-network-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-network-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libnetwork )
+list(APPEND _cmake_import_check_files_for_ns3::libnetwork "${_IMPORT_PREFIX}/lib/libns3-dev-network-default.so" )
+
+# Import target "ns3::libstats" for configuration "default"
+set_property(TARGET ns3::libstats APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libstats PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-stats-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-stats-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libstats )
+list(APPEND _cmake_import_check_files_for_ns3::libstats "${_IMPORT_PREFIX}/lib/libns3-dev-stats-default.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdlib_pch_exec.dir/build-support/empty-main.cc.o"
+  "CMakeFiles/stdlib_pch_exec.dir/build-support/empty-main.cc.o.d"
+  "CMakeFiles/stdlib_pch_exec.dir/cmake_pch.hxx.gch"
+  "CMakeFiles/stdlib_pch_exec.dir/cmake_pch.hxx.gch.d"
+  "ns3-dev-stdlib_pch_exec-default"
+  "ns3-dev-stdlib_pch_exec-default.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdlib_pch_exec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build_mtp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ctest-stdlib_pch_exec "ns3-dev-stdlib_pch_exec-default")
+set_tests_properties(ctest-stdlib_pch_exec PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mtp/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1450;set_runtime_outputdirectory;/root/repo/CMakeLists.txt;143;process_options;/root/repo/CMakeLists.txt;0;")
+subdirs("src")
+subdirs("examples")
+subdirs("scratch")
+subdirs("utils")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/scratch/subdir/ns3-dev-scratch-subdir-default"
+  "/root/repo/build/scratch/subdir/ns3-dev-scratch-subdir-default.pdb"
+  "CMakeFiles/scratch_subdir_scratch-subdir.dir/subdir/scratch-subdir-additional-header.cc.o"
+  "CMakeFiles/scratch_subdir_scratch-subdir.dir/subdir/scratch-subdir-additional-header.cc.o.d"
+  "CMakeFiles/scratch_subdir_scratch-subdir.dir/subdir/scratch-subdir.cc.o"
+  "CMakeFiles/scratch_subdir_scratch-subdir.dir/subdir/scratch-subdir.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_subdir_scratch-subdir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/scratch
+# Build directory: /root/repo/_gate_build_mtp/scratch
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ctest-scratch_scratch-simulator "ns3-dev-scratch-simulator-default")
+set_tests_properties(ctest-scratch_scratch-simulator PROPERTIES  WORKING_DIRECTORY "/root/repo/build/scratch/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/scratch/CMakeLists.txt;47;build_exec;/root/repo/scratch/CMakeLists.txt;59;create_scratch;/root/repo/scratch/CMakeLists.txt;0;")
+add_test(ctest-scratch_subdir_scratch-subdir "ns3-dev-scratch-subdir-default")
+set_tests_properties(ctest-scratch_subdir_scratch-subdir PROPERTIES  WORKING_DIRECTORY "/root/repo/build/scratch/subdir/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/scratch/CMakeLists.txt;47;build_exec;/root/repo/scratch/CMakeLists.txt;89;create_scratch;/root/repo/scratch/CMakeLists.txt;0;")
@@ -0,0 +1,75 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-core-test-default.pdb"
+  "/root/repo/build/lib/libns3-dev-core-test-default.so"
+  "CMakeFiles/libcore-test.dir/test/attribute-container-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/attribute-container-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/attribute-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/attribute-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/build-profile-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/build-profile-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/callback-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/callback-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/checkpoint-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/checkpoint-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/command-line-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/command-line-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/config-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/config-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/environment-variable-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/environment-variable-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/event-garbage-collector-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/event-garbage-collector-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/event-profiler-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/event-profiler-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/global-value-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/global-value-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/hash-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/hash-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/int64x64-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/int64x64-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/length-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/length-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/many-uniform-random-variables-one-get-value-call-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/many-uniform-random-variables-one-get-value-call-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/mpsc-queue-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/mpsc-queue-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/names-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/names-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/object-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/object-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/one-uniform-random-variable-many-get-value-calls-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/one-uniform-random-variable-many-get-value-calls-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/pair-value-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/pair-value-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/ptr-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/ptr-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/sample-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/sample-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/simulator-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/simulator-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/splitstring-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/splitstring-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/threaded-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/threaded-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/time-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/time-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/timer-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/timer-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/traced-callback-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/traced-callback-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/trickle-timer-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/trickle-timer-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/tuple-value-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/tuple-value-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/type-id-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/type-id-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/type-traits-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/type-traits-test-suite.cc.o.d"
+  "CMakeFiles/libcore-test.dir/test/watchdog-test-suite.cc.o"
+  "CMakeFiles/libcore-test.dir/test/watchdog-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libcore-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
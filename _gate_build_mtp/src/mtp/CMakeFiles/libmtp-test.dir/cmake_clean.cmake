@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-mtp-test-default.pdb"
+  "/root/repo/build/lib/libns3-dev-mtp-test-default.so"
+  "CMakeFiles/libmtp-test.dir/test/mtp-test-suite.cc.o"
+  "CMakeFiles/libmtp-test.dir/test/mtp-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libmtp-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
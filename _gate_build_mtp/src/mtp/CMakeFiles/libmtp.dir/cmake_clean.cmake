@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-mtp-default.pdb"
+  "/root/repo/build/lib/libns3-dev-mtp-default.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libmtp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
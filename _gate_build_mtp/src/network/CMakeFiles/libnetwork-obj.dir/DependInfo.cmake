@@ -0,0 +1,170 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/network/helper/application-container.cc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/application-container.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/application-container.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/helper/application-container.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/application-container.cc.o.d"
+  "/root/repo/src/network/helper/delay-jitter-estimation.cc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/delay-jitter-estimation.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/delay-jitter-estimation.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/helper/delay-jitter-estimation.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/delay-jitter-estimation.cc.o.d"
+  "/root/repo/src/network/helper/net-device-container.cc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/net-device-container.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/net-device-container.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/helper/net-device-container.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/net-device-container.cc.o.d"
+  "/root/repo/src/network/helper/node-container.cc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/node-container.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/node-container.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/helper/node-container.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/node-container.cc.o.d"
+  "/root/repo/src/network/helper/packet-socket-helper.cc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/packet-socket-helper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/packet-socket-helper.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/helper/packet-socket-helper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/packet-socket-helper.cc.o.d"
+  "/root/repo/src/network/helper/simple-net-device-helper.cc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/simple-net-device-helper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/simple-net-device-helper.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/helper/simple-net-device-helper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/simple-net-device-helper.cc.o.d"
+  "/root/repo/src/network/helper/trace-helper.cc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/trace-helper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/trace-helper.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/helper/trace-helper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/helper/trace-helper.cc.o.d"
+  "/root/repo/src/network/model/address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/address.cc.o.d"
+  "/root/repo/src/network/model/application.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/application.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/application.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/application.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/application.cc.o.d"
+  "/root/repo/src/network/model/buffer-pool.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/buffer-pool.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/buffer-pool.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/buffer-pool.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/buffer-pool.cc.o.d"
+  "/root/repo/src/network/model/buffer.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/buffer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/buffer.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/buffer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/buffer.cc.o.d"
+  "/root/repo/src/network/model/byte-tag-list.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/byte-tag-list.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/byte-tag-list.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/byte-tag-list.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/byte-tag-list.cc.o.d"
+  "/root/repo/src/network/model/channel-list.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/channel-list.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/channel-list.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/channel-list.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/channel-list.cc.o.d"
+  "/root/repo/src/network/model/channel.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/channel.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/channel.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/channel.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/channel.cc.o.d"
+  "/root/repo/src/network/model/chunk.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/chunk.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/chunk.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/chunk.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/chunk.cc.o.d"
+  "/root/repo/src/network/model/header.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/header.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/header.cc.o.d"
+  "/root/repo/src/network/model/net-device.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/net-device.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/net-device.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/net-device.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/net-device.cc.o.d"
+  "/root/repo/src/network/model/nix-vector.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/nix-vector.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/nix-vector.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/nix-vector.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/nix-vector.cc.o.d"
+  "/root/repo/src/network/model/node-list.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/node-list.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/node-list.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/node-list.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/node-list.cc.o.d"
+  "/root/repo/src/network/model/node.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/node.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/node.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/node.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/node.cc.o.d"
+  "/root/repo/src/network/model/packet-accounting.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-accounting.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-accounting.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-accounting.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-accounting.cc.o.d"
+  "/root/repo/src/network/model/packet-metadata.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-metadata.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-metadata.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-metadata.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-metadata.cc.o.d"
+  "/root/repo/src/network/model/packet-tag-list.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-tag-list.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-tag-list.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-tag-list.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet-tag-list.cc.o.d"
+  "/root/repo/src/network/model/packet.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/packet.cc.o.d"
+  "/root/repo/src/network/model/shared-payload.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/shared-payload.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/shared-payload.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/shared-payload.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/shared-payload.cc.o.d"
+  "/root/repo/src/network/model/socket-factory.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/socket-factory.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/socket-factory.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/socket-factory.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/socket-factory.cc.o.d"
+  "/root/repo/src/network/model/socket.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/socket.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/socket.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/socket.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/socket.cc.o.d"
+  "/root/repo/src/network/model/tag-buffer.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/tag-buffer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/tag-buffer.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/tag-buffer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/tag-buffer.cc.o.d"
+  "/root/repo/src/network/model/tag.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/tag.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/tag.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/tag.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/tag.cc.o.d"
+  "/root/repo/src/network/model/trailer.cc" "src/network/CMakeFiles/libnetwork-obj.dir/model/trailer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/trailer.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/model/trailer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/model/trailer.cc.o.d"
+  "/root/repo/src/network/utils/address-utils.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/address-utils.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/address-utils.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/address-utils.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/address-utils.cc.o.d"
+  "/root/repo/src/network/utils/binary-trace-writer.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/binary-trace-writer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/binary-trace-writer.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/binary-trace-writer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/binary-trace-writer.cc.o.d"
+  "/root/repo/src/network/utils/bit-deserializer.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/bit-deserializer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/bit-deserializer.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/bit-deserializer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/bit-deserializer.cc.o.d"
+  "/root/repo/src/network/utils/bit-serializer.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/bit-serializer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/bit-serializer.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/bit-serializer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/bit-serializer.cc.o.d"
+  "/root/repo/src/network/utils/crc32.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/crc32.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/crc32.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/crc32.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/crc32.cc.o.d"
+  "/root/repo/src/network/utils/data-rate.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/data-rate.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/data-rate.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/data-rate.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/data-rate.cc.o.d"
+  "/root/repo/src/network/utils/drop-tail-queue.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/drop-tail-queue.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/drop-tail-queue.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/drop-tail-queue.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/drop-tail-queue.cc.o.d"
+  "/root/repo/src/network/utils/dynamic-queue-limits.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/dynamic-queue-limits.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/dynamic-queue-limits.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/dynamic-queue-limits.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/dynamic-queue-limits.cc.o.d"
+  "/root/repo/src/network/utils/error-channel.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/error-channel.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/error-channel.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/error-channel.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/error-channel.cc.o.d"
+  "/root/repo/src/network/utils/error-model.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/error-model.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/error-model.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/error-model.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/error-model.cc.o.d"
+  "/root/repo/src/network/utils/ethernet-header.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ethernet-header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ethernet-header.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ethernet-header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ethernet-header.cc.o.d"
+  "/root/repo/src/network/utils/ethernet-trailer.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ethernet-trailer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ethernet-trailer.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ethernet-trailer.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ethernet-trailer.cc.o.d"
+  "/root/repo/src/network/utils/flow-id-tag.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/flow-id-tag.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/flow-id-tag.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/flow-id-tag.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/flow-id-tag.cc.o.d"
+  "/root/repo/src/network/utils/inet-socket-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/inet-socket-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/inet-socket-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/inet-socket-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/inet-socket-address.cc.o.d"
+  "/root/repo/src/network/utils/inet6-socket-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/inet6-socket-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/inet6-socket-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/inet6-socket-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/inet6-socket-address.cc.o.d"
+  "/root/repo/src/network/utils/ipv4-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ipv4-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ipv4-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ipv4-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ipv4-address.cc.o.d"
+  "/root/repo/src/network/utils/ipv6-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ipv6-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ipv6-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ipv6-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/ipv6-address.cc.o.d"
+  "/root/repo/src/network/utils/llc-snap-header.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/llc-snap-header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/llc-snap-header.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/llc-snap-header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/llc-snap-header.cc.o.d"
+  "/root/repo/src/network/utils/mac16-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac16-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac16-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac16-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac16-address.cc.o.d"
+  "/root/repo/src/network/utils/mac48-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac48-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac48-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac48-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac48-address.cc.o.d"
+  "/root/repo/src/network/utils/mac64-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac64-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac64-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac64-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac64-address.cc.o.d"
+  "/root/repo/src/network/utils/mac8-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac8-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac8-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac8-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/mac8-address.cc.o.d"
+  "/root/repo/src/network/utils/net-device-queue-interface.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/net-device-queue-interface.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/net-device-queue-interface.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/net-device-queue-interface.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/net-device-queue-interface.cc.o.d"
+  "/root/repo/src/network/utils/output-stream-wrapper.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/output-stream-wrapper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/output-stream-wrapper.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/output-stream-wrapper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/output-stream-wrapper.cc.o.d"
+  "/root/repo/src/network/utils/packet-burst.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-burst.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-burst.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-burst.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-burst.cc.o.d"
+  "/root/repo/src/network/utils/packet-data-calculators.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-data-calculators.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-data-calculators.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-data-calculators.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-data-calculators.cc.o.d"
+  "/root/repo/src/network/utils/packet-probe.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-probe.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-probe.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-probe.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-probe.cc.o.d"
+  "/root/repo/src/network/utils/packet-sampler.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-sampler.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-sampler.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-sampler.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-sampler.cc.o.d"
+  "/root/repo/src/network/utils/packet-socket-address.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-address.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-address.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-address.cc.o.d"
+  "/root/repo/src/network/utils/packet-socket-client.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-client.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-client.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-client.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-client.cc.o.d"
+  "/root/repo/src/network/utils/packet-socket-factory.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-factory.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-factory.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-factory.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-factory.cc.o.d"
+  "/root/repo/src/network/utils/packet-socket-server.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-server.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-server.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-server.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket-server.cc.o.d"
+  "/root/repo/src/network/utils/packet-socket.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packet-socket.cc.o.d"
+  "/root/repo/src/network/utils/packetbb.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packetbb.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packetbb.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packetbb.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/packetbb.cc.o.d"
+  "/root/repo/src/network/utils/pcap-file-wrapper.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcap-file-wrapper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcap-file-wrapper.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcap-file-wrapper.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcap-file-wrapper.cc.o.d"
+  "/root/repo/src/network/utils/pcap-file.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcap-file.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcap-file.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcap-file.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcap-file.cc.o.d"
+  "/root/repo/src/network/utils/pcapng-file.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcapng-file.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcapng-file.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcapng-file.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/pcapng-file.cc.o.d"
+  "/root/repo/src/network/utils/queue-item.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-item.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-item.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-item.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-item.cc.o.d"
+  "/root/repo/src/network/utils/queue-limits.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-limits.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-limits.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-limits.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-limits.cc.o.d"
+  "/root/repo/src/network/utils/queue-size.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-size.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-size.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-size.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue-size.cc.o.d"
+  "/root/repo/src/network/utils/queue.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/queue.cc.o.d"
+  "/root/repo/src/network/utils/radiotap-header.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/radiotap-header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/radiotap-header.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/radiotap-header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/radiotap-header.cc.o.d"
+  "/root/repo/src/network/utils/simple-channel.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/simple-channel.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/simple-channel.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/simple-channel.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/simple-channel.cc.o.d"
+  "/root/repo/src/network/utils/simple-net-device.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/simple-net-device.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/simple-net-device.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/simple-net-device.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/simple-net-device.cc.o.d"
+  "/root/repo/src/network/utils/sll-header.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/sll-header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/sll-header.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/sll-header.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/sll-header.cc.o.d"
+  "/root/repo/src/network/utils/timestamp-tag.cc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/timestamp-tag.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/timestamp-tag.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch-default.dir/cmake_pch.hxx" "src/network/CMakeFiles/libnetwork-obj.dir/utils/timestamp-tag.cc.o" "gcc" "src/network/CMakeFiles/libnetwork-obj.dir/utils/timestamp-tag.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libns3-dev-stats-test-default.pdb"
+  "/root/repo/build/lib/libns3-dev-stats-test-default.so"
+  "CMakeFiles/libstats-test.dir/test/average-test-suite.cc.o"
+  "CMakeFiles/libstats-test.dir/test/average-test-suite.cc.o.d"
+  "CMakeFiles/libstats-test.dir/test/basic-data-calculators-test-suite.cc.o"
+  "CMakeFiles/libstats-test.dir/test/basic-data-calculators-test-suite.cc.o.d"
+  "CMakeFiles/libstats-test.dir/test/double-probe-test-suite.cc.o"
+  "CMakeFiles/libstats-test.dir/test/double-probe-test-suite.cc.o.d"
+  "CMakeFiles/libstats-test.dir/test/histogram-test-suite.cc.o"
+  "CMakeFiles/libstats-test.dir/test/histogram-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libstats-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
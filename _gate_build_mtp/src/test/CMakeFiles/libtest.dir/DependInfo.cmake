@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/build-support/empty.cc" "src/test/CMakeFiles/libtest.dir/__/__/build-support/empty.cc.o" "gcc" "src/test/CMakeFiles/libtest.dir/__/__/build-support/empty.cc.o.d"
+  "/root/repo/src/test/traced/traced-value-callback-typedef-test-suite.cc" "src/test/CMakeFiles/libtest.dir/traced/traced-value-callback-typedef-test-suite.cc.o" "gcc" "src/test/CMakeFiles/libtest.dir/traced/traced-value-callback-typedef-test-suite.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
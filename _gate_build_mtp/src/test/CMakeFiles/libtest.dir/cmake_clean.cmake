@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libtest.dir/__/__/build-support/empty.cc.o"
+  "CMakeFiles/libtest.dir/__/__/build-support/empty.cc.o.d"
+  "CMakeFiles/libtest.dir/traced/traced-value-callback-typedef-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/traced/traced-value-callback-typedef-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
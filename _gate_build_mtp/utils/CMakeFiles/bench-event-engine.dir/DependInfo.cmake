@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/utils/bench-event-engine.cc" "utils/CMakeFiles/bench-event-engine.dir/bench-event-engine.cc.o" "gcc" "utils/CMakeFiles/bench-event-engine.dir/bench-event-engine.cc.o.d"
+  "/root/repo/_gate_build_mtp/CMakeFiles/stdlib_pch_exec.dir/cmake_pch.hxx" "utils/CMakeFiles/bench-event-engine.dir/bench-event-engine.cc.o" "gcc" "utils/CMakeFiles/bench-event-engine.dir/bench-event-engine.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_mtp/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/utils/ns3-dev-bench-event-engine-default"
+  "/root/repo/build/utils/ns3-dev-bench-event-engine-default.pdb"
+  "CMakeFiles/bench-event-engine.dir/bench-event-engine.cc.o"
+  "CMakeFiles/bench-event-engine.dir/bench-event-engine.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-event-engine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
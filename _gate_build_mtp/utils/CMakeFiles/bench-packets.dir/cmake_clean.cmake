@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/utils/ns3-dev-bench-packets-default"
+  "/root/repo/build/utils/ns3-dev-bench-packets-default.pdb"
+  "CMakeFiles/bench-packets.dir/bench-packets.cc.o"
+  "CMakeFiles/bench-packets.dir/bench-packets.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-packets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
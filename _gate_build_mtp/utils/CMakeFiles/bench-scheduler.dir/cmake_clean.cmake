@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/utils/ns3-dev-bench-scheduler-default"
+  "/root/repo/build/utils/ns3-dev-bench-scheduler-default.pdb"
+  "CMakeFiles/bench-scheduler.dir/bench-scheduler.cc.o"
+  "CMakeFiles/bench-scheduler.dir/bench-scheduler.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-scheduler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/utils/ns3-dev-bench-traced-callback-default"
+  "/root/repo/build/utils/ns3-dev-bench-traced-callback-default.pdb"
+  "CMakeFiles/bench-traced-callback.dir/bench-traced-callback.cc.o"
+  "CMakeFiles/bench-traced-callback.dir/bench-traced-callback.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-traced-callback.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/utils
+# Build directory: /root/repo/_gate_build_mtp/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ctest-test-runner "ns3-dev-test-runner-default")
+set_tests_properties(ctest-test-runner PROPERTIES  WORKING_DIRECTORY "/root/repo/build/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/utils/CMakeLists.txt;30;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-bench-scheduler "ns3-dev-bench-scheduler-default")
+set_tests_properties(ctest-bench-scheduler PROPERTIES  WORKING_DIRECTORY "/root/repo/build/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;37;build_exec;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-bench-event-engine "ns3-dev-bench-event-engine-default")
+set_tests_properties(ctest-bench-event-engine PROPERTIES  WORKING_DIRECTORY "/root/repo/build/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;44;build_exec;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-bench-packets "ns3-dev-bench-packets-default")
+set_tests_properties(ctest-bench-packets PROPERTIES  WORKING_DIRECTORY "/root/repo/build/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;52;build_exec;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-bench-traced-callback "ns3-dev-bench-traced-callback-default")
+set_tests_properties(ctest-bench-traced-callback PROPERTIES  WORKING_DIRECTORY "/root/repo/build/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;59;build_exec;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-binary-trace-to-ascii "ns3-dev-binary-trace-to-ascii-default")
+set_tests_properties(ctest-binary-trace-to-ascii PROPERTIES  WORKING_DIRECTORY "/root/repo/build/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;66;build_exec;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-print-introspected-doxygen "ns3-dev-print-introspected-doxygen-default")
+set_tests_properties(ctest-print-introspected-doxygen PROPERTIES  WORKING_DIRECTORY "/root/repo/build/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;73;build_exec;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-perf-io "ns3-dev-perf-io-default")
+set_tests_properties(ctest-perf-io PROPERTIES  WORKING_DIRECTORY "/root/repo/build/utils/perf/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1527;add_test;/root/repo/build-support/macros-and-definitions.cmake;1581;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;82;build_exec;/root/repo/utils/CMakeLists.txt;0;")
@@ -769,6 +769,17 @@ macro(process_options)
       add_definitions(-DHAVE_LIBXML2)
       include_directories(${LIBXML2_INCLUDE_DIR})
     endif()
+
+    find_package(ZLIB QUIET)
+    if(NOT ${ZLIB_FOUND})
+      message(${HIGHLIGHTED_STATUS}
+              "zlib was not found. Continuing without it."
+      )
+    else()
+      message(STATUS "zlib was found.")
+      add_definitions(-DHAVE_ZLIB)
+      include_directories(${ZLIB_INCLUDE_DIRS})
+    endif()
   endif()
 
   set(THREADS_PREFER_PTHREAD_FLAG)
@@ -992,6 +1003,10 @@ macro(process_options)
     endif()
   endif()
 
+  if(${NS3_MTP})
+    add_definitions(-DNS3_MTP)
+  endif()
+
   mark_as_advanced(Boost_INCLUDE_DIR)
   find_package(Boost)
   if(${Boost_FOUND})
@@ -1303,6 +1318,10 @@ macro(process_options)
     list(REMOVE_ITEM libs_to_build mpi)
   endif()
 
+  if(NOT ${NS3_MTP})
+    list(REMOVE_ITEM libs_to_build mtp)
+  endif()
+
   if(NOT ${ENABLE_VISUALIZER})
     list(REMOVE_ITEM libs_to_build visualizer)
   endif()
@@ -0,0 +1 @@
+#include "/root/repo/src/network/model/buffer-pool.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/constant-velocity-mobility-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/gauss-markov-mobility-model.h"
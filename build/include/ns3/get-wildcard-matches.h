@@ -0,0 +1 @@
+#include "/root/repo/src/stats/model/get-wildcard-matches.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mpi/model/mpi-receiver.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/three-gpp-channel-model.h"
@@ -22,10 +22,12 @@
 
 #include "ns3/application-packet-probe.h"
 
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/object.h"
+#include "ns3/packet-sampler.h"
 #include "ns3/trace-source-accessor.h"
 
 namespace ns3
@@ -43,6 +45,11 @@ ApplicationPacketProbe::GetTypeId()
             .SetParent<Probe>()
             .SetGroupName("Applications")
             .AddConstructor<ApplicationPacketProbe>()
+            .AddAttribute("PacketSampling",
+                          "Whether to trace only the packets sampled by the PacketSampler.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ApplicationPacketProbe::m_packetSampling),
+                          MakeBooleanChecker())
             .AddTraceSource("Output",
                             "The packet plus its socket address that serve "
                             "as the output for this probe",
@@ -114,7 +121,7 @@ void
 ApplicationPacketProbe::TraceSink(Ptr<const Packet> packet, const Address& address)
 {
     NS_LOG_FUNCTION(this << packet << address);
-    if (IsEnabled())
+    if (IsEnabled() && (!m_packetSampling || PacketSampler::IsSampled(packet)))
     {
         m_packet = packet;
         m_address = address;
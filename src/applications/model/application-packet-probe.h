@@ -119,6 +119,9 @@ class ApplicationPacketProbe : public Probe
 
     /// The size of the traced packet.
     uint32_t m_packetSizeOld;
+
+    /// Whether only the packets sampled by the PacketSampler are traced.
+    bool m_packetSampling;
 };
 
 } // namespace ns3
@@ -24,6 +24,7 @@
 #include "click-internet-stack-helper.h"
 
 #include "ns3/arp-l3-protocol.h"
+#include "ns3/abort.h"
 #include "ns3/assert.h"
 #include "ns3/callback.h"
 #include "ns3/config.h"
@@ -430,6 +431,12 @@ ClickInternetStackHelper::EnableAsciiIpv4Internal(Ptr<OutputStreamWrapper> strea
     //
     Packet::EnablePrinting();
 
+    //
+    // Our trace sinks print the packets: they cannot write binary records.
+    //
+    NS_ABORT_MSG_IF(stream && stream->GetBinaryTrace(),
+                    "The Click Ipv4 ascii trace sinks do not support binary trace streams");
+
     //
     // If we are not provided an OutputStreamWrapper, we are expected to create
     // one using the usual trace filename conventions and hook WithoutContext
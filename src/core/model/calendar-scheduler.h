@@ -110,6 +110,7 @@ class CalendarScheduler : public Scheduler
     Scheduler::Event PeekNext() const override;
     Scheduler::Event RemoveNext() override;
     void Remove(const Scheduler::Event& ev) override;
+    uint32_t RemoveCancelled() override;
 
   private:
     /** Double the number of buckets if necessary. */
@@ -32,6 +32,35 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("Callback");
 
+bool
+CallbackImplBase::IsEqualComponents(const CallbackImplBase& other) const
+{
+    std::size_t count = GetComponentCount();
+    // if the two callback implementations are made of a distinct number of
+    // components, they are different
+    if (count != other.GetComponentCount())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++)
+    {
+        Component a = GetComponent(i);
+        Component b = other.GetComponent(i);
+        if (a.value == b.value)
+        {
+            // the same object, e.g., the callable object of a callback
+            // bound to arguments in two different ways
+            continue;
+        }
+        if (a.isEqual == nullptr || b.isEqual == nullptr || *a.type != *b.type ||
+            !a.isEqual(a.value, b.value))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 CallbackValue::CallbackValue()
     : m_value()
 {
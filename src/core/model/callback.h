@@ -29,6 +29,8 @@
 
 #include <functional>
 #include <memory>
+#include <tuple>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 #include <vector>
@@ -76,6 +78,12 @@ namespace ns3
  * \ingroup callbackimpl
  * Abstract base class for CallbackImpl
  * Provides reference counting and equality test.
+ *
+ * Two callbacks are equal if they are made of the same components,
+ * i.e., the same callable object and the same bound arguments, in the
+ * same order. The components are compared through the type-erased
+ * view returned by GetComponent(), so that a callback bound in several
+ * steps compares equal to one bound in a single step.
  */
 class CallbackImplBase : public SimpleRefCount<CallbackImplBase>
 {
@@ -85,6 +93,22 @@ class CallbackImplBase : public SimpleRefCount<CallbackImplBase>
     {
     }
 
+    /**
+     * Type-erased view of a component of a callback, i.e., the callable
+     * object or a bound argument.
+     */
+    struct Component
+    {
+        const std::type_info* type; //!< The type of the component.
+        const void* value;          //!< The address of the component.
+        /**
+         * Compare the values of two components of this type, or \c nullptr
+         * if the component is not comparable. Components which are not
+         * comparable (such as lambdas) are only equal to themselves.
+         */
+        bool (*isEqual)(const void* a, const void* b);
+    };
+
     /**
      * Equality test
      *
@@ -97,6 +121,18 @@ class CallbackImplBase : public SimpleRefCount<CallbackImplBase>
      * \return The object type as a string.
      */
     virtual std::string GetTypeid() const = 0;
+    /**
+     * Get the number of components: the callable object and the bound
+     * arguments, if any.
+     * \return The number of components.
+     */
+    virtual std::size_t GetComponentCount() const = 0;
+    /**
+     * Get a component.
+     * \param [in] i The index of the component, 0 being the callable object.
+     * \return The component.
+     */
+    virtual Component GetComponent(std::size_t i) const = 0;
 
   protected:
     /**
@@ -126,234 +162,320 @@ class CallbackImplBase : public SimpleRefCount<CallbackImplBase>
         }
         return typeName;
     }
-};
 
-/**
- * \ingroup callbackimpl
- * Abstract base class for CallbackComponent.
- * Provides equality test.
- */
-class CallbackComponentBase
-{
-  public:
-    /** Virtual destructor */
-    virtual ~CallbackComponentBase()
-    {
-    }
+    /**
+     * Compare the components of two callbacks one by one.
+     *
+     * \param [in] other The other callback implementation.
+     * \return \c true if all the components are equal
+     */
+    bool IsEqualComponents(const CallbackImplBase& other) const;
 
     /**
-     * Equality test
+     * Build the view of a component.
      *
-     * \param [in] other CallbackComponent Ptr
-     * \return \c true if we are equal
+     * \tparam T \deduced The type of the component.
+     * \tparam isComparable Whether the component can be compared to
+     *         others of the same type.
+     * \param [in] t The component.
+     * \return The component view.
      */
-    virtual bool IsEqual(std::shared_ptr<const CallbackComponentBase> other) const = 0;
+    template <typename T, bool isComparable = true>
+    static Component MakeComponent(const T& t)
+    {
+        if constexpr (isComparable)
+        {
+            return {&typeid(T), &t, [](const void* a, const void* b) {
+                        return !(*static_cast<const T*>(a) != *static_cast<const T*>(b));
+                    }};
+        }
+        else
+        {
+            return {&typeid(T), &t, nullptr};
+        }
+    }
 };
 
 /**
  * \ingroup callbackimpl
- * Stores a component of a callback, i.e., the callable object
- * or a bound argument. The purpose of this class is to test
- * the equality of the components of two callbacks.
+ * CallbackImpl class with varying numbers of argument types
  *
- * \tparam T The type of the callback component.
- * \tparam isComparable whether this callback component can be compared to others of the same type
+ * The concrete implementations store the callable object and the bound
+ * arguments inline, so that building a callback takes a single
+ * allocation, and register a static function which invokes them: a
+ * call goes through a single indirect call, with no virtual function
+ * or std::function in between.
+ *
+ * \tparam R \explicit The return type of the Callback.
+ * \tparam UArgs \explicit The types of any arguments to the Callback.
  */
-template <typename T, bool isComparable = true>
-class CallbackComponent : public CallbackComponentBase
+template <typename R, typename... UArgs>
+class CallbackImpl : public CallbackImplBase
 {
   public:
     /**
-     * Constructor
+     * Function call operator.
      *
-     * \param [in] t The value of the callback component
+     * \param uargs The arguments to the Callback.
+     * \return Callback value
      */
-    CallbackComponent(const T& t)
-        : m_comp(t)
+    R operator()(UArgs... uargs) const
     {
+        return m_invoke(this, std::forward<UArgs>(uargs)...);
     }
 
-    /**
-     * Equality test between the values of two components
-     *
-     * \param [in] other CallbackComponentBase Ptr
-     * \return \c true if we are equal
-     */
-    bool IsEqual(std::shared_ptr<const CallbackComponentBase> other) const override
+    bool IsEqual(Ptr<const CallbackImplBase> other) const override
     {
-        auto p = std::dynamic_pointer_cast<const CallbackComponent<T>>(other);
+        if (PeekPointer(other) == this)
+        {
+            return true;
+        }
+        const CallbackImpl<R, UArgs...>* otherDerived =
+            dynamic_cast<const CallbackImpl<R, UArgs...>*>(PeekPointer(other));
 
-        // other must have the same type and value as ours
-        if (p == nullptr || p->m_comp != m_comp)
+        if (otherDerived == nullptr)
         {
             return false;
         }
-
-        return true;
+        return IsEqualComponents(*otherDerived);
     }
 
-  private:
-    T m_comp; //!< the value of the callback component
-};
+    std::string GetTypeid() const override
+    {
+        return DoGetTypeid();
+    }
 
-/**
- * \ingroup callbackimpl
- * Partial specialization of class CallbackComponent with isComparable equal
- * to false. This is required to handle callable objects (such as lambdas and
- * objects returned by std::function and std::bind) that do not provide the
- * equality operator. Given that these objects cannot be compared and the only
- * purpose of the class CallbackComponent is to compare values, no object is
- * stored in this specialized class.
- *
- * \tparam T The type of the callback component.
- */
-template <typename T>
-class CallbackComponent<T, false> : public CallbackComponentBase
-{
-  public:
-    /**
-     * Constructor
-     *
-     * \param [in] t The value of the callback component
-     */
-    CallbackComponent(const T& t)
+    /** \copydoc GetTypeid(). */
+    static std::string DoGetTypeid()
     {
+        static std::vector<std::string> vec = {GetCppTypeid<R>(), GetCppTypeid<UArgs>()...};
+
+        static std::string id("CallbackImpl<");
+        for (auto& s : vec)
+        {
+            id.append(s + ",");
+        }
+        if (id.back() == ',')
+        {
+            id.pop_back();
+        }
+        id.push_back('>');
+
+        return id;
     }
 
+  protected:
+    /** The function invoking a concrete implementation. */
+    typedef R (*Invoker)(const CallbackImpl* impl, UArgs... uargs);
+
     /**
-     * Equality test between functions
+     * Constructor.
      *
-     * \param [in] other CallbackParam Ptr
-     * \return \c true if we are equal
+     * \param [in] invoke The function invoking the concrete implementation.
      */
-    bool IsEqual(std::shared_ptr<const CallbackComponentBase> other) const override
+    CallbackImpl(Invoker invoke)
+        : m_invoke(invoke)
     {
-        return false;
     }
+
+  private:
+    Invoker m_invoke; //!< Invoke the concrete implementation
 };
 
-/// Vector of callback components
-typedef std::vector<std::shared_ptr<CallbackComponentBase>> CallbackComponentVector;
+/**
+ * \ingroup callbackimpl
+ * Stores a callable object and the arguments bound to it.
+ *
+ * \tparam Signature \explicit The signature of the Callback.
+ * \tparam F \explicit The type of the callable object.
+ * \tparam BArgs \explicit The types of the bound arguments.
+ */
+template <typename Signature, typename F, typename... BArgs>
+class FunctorCallbackImpl;
 
 /**
  * \ingroup callbackimpl
- * CallbackImpl class with varying numbers of argument types
+ * Partial specialization of FunctorCallbackImpl extracting the return
+ * and argument types of the Callback.
  *
  * \tparam R \explicit The return type of the Callback.
  * \tparam UArgs \explicit The types of any arguments to the Callback.
+ * \tparam F \explicit The type of the callable object.
+ * \tparam BArgs \explicit The types of the bound arguments.
  */
-template <typename R, typename... UArgs>
-class CallbackImpl : public CallbackImplBase
+template <typename R, typename... UArgs, typename F, typename... BArgs>
+class FunctorCallbackImpl<R(UArgs...), F, BArgs...> : public CallbackImpl<R, UArgs...>
 {
   public:
     /**
      * Constructor.
      *
-     * \param func the callable object
-     * \param components the callback components (callable object and bound arguments)
+     * \param [in] func The callable object
+     * \param [in] bargs The values of the bound arguments
      */
-    CallbackImpl(std::function<R(UArgs...)> func, const CallbackComponentVector& components)
-        : m_func(func),
-          m_components(components)
+    FunctorCallbackImpl(const F& func, const BArgs&... bargs)
+        : CallbackImpl<R, UArgs...>(&FunctorCallbackImpl::Invoke),
+          m_func(func),
+          m_bargs(bargs...)
     {
     }
 
-    /**
-     * Get the stored function.
-     * \return A const reference to the stored function.
-     */
-    const std::function<R(UArgs...)>& GetFunction() const
+    std::size_t GetComponentCount() const override
+    {
+        return 1 + sizeof...(BArgs);
+    }
+
+    CallbackImplBase::Component GetComponent(std::size_t i) const override
     {
-        return m_func;
+        // The original function is comparable if it is a function pointer or
+        // a pointer to a member function or a pointer to a member data.
+        constexpr bool isComp =
+            std::is_function_v<std::remove_pointer_t<F>> || std::is_member_pointer_v<F>;
+
+        if (i == 0)
+        {
+            return CallbackImplBase::MakeComponent<F, isComp>(m_func);
+        }
+        return GetBoundComponent(i - 1, std::index_sequence_for<BArgs...>{});
     }
 
+  private:
     /**
-     * Get the vector of callback components.
-     * \return A const reference to the vector of callback components.
+     * Get a bound argument.
+     *
+     * \param [in] i The index of the bound argument.
+     * \return The component.
      */
-    const CallbackComponentVector& GetComponents() const
+    template <std::size_t... INDEX>
+    CallbackImplBase::Component GetBoundComponent(std::size_t i,
+                                                  std::index_sequence<INDEX...>) const
     {
-        return m_components;
+        CallbackImplBase::Component components[] = {
+            CallbackImplBase::MakeComponent(std::get<INDEX>(m_bargs))...,
+            {nullptr, nullptr, nullptr}};
+        return components[i];
     }
 
     /**
-     * Function call operator.
+     * Invoke the callable object with the bound arguments.
      *
+     * \param [in] impl This object
      * \param uargs The arguments to the Callback.
      * \return Callback value
      */
-    R operator()(UArgs... uargs) const
+    static R Invoke(const CallbackImpl<R, UArgs...>* impl, UArgs... uargs)
     {
-        return m_func(uargs...);
-    }
-
-    bool IsEqual(Ptr<const CallbackImplBase> other) const override
-    {
-        const CallbackImpl<R, UArgs...>* otherDerived =
-            dynamic_cast<const CallbackImpl<R, UArgs...>*>(PeekPointer(other));
-
-        if (otherDerived == nullptr)
+        auto self = static_cast<const FunctorCallbackImpl*>(impl);
+        auto call = [self, &uargs...](BArgs&... bargs) -> decltype(auto) {
+            return std::invoke(self->m_func, bargs..., std::forward<UArgs>(uargs)...);
+        };
+        if constexpr (std::is_void_v<R>)
         {
-            return false;
+            std::apply(call, self->m_bargs);
         }
-
-        // if the two callback implementations are made of a distinct number of
-        // components, they are different
-        if (m_components.size() != otherDerived->GetComponents().size())
+        else
         {
-            return false;
+            return std::apply(call, self->m_bargs);
         }
+    }
 
-        // the two functions are equal if they compare equal or the shared pointers
-        // point to the same locations
-        if (!m_components.at(0)->IsEqual(otherDerived->GetComponents().at(0)) &&
-            m_components.at(0) != otherDerived->GetComponents().at(0))
-        {
-            return false;
-        }
+    /// The callable object; like std::function, it is invoked as non-const
+    mutable F m_func;
+    /// The bound arguments, if any, passed as lvalues like the callable object
+    mutable std::tuple<BArgs...> m_bargs;
+};
 
-        // check if the remaining components are equal one by one
-        for (std::size_t i = 1; i < m_components.size(); i++)
-        {
-            if (!m_components.at(i)->IsEqual(otherDerived->GetComponents().at(i)))
-            {
-                return false;
-            }
-        }
+/**
+ * \ingroup callbackimpl
+ * Binds arguments to an existing callback.
+ *
+ * \tparam Signature \explicit The signature of the Callback.
+ * \tparam BArgs \explicit The types of the bound arguments.
+ */
+template <typename Signature, typename... BArgs>
+class BoundCallbackImpl;
 
-        return true;
-    }
+/**
+ * \ingroup callbackimpl
+ * Partial specialization of BoundCallbackImpl extracting the return
+ * and argument types of the Callback.
+ *
+ * \tparam R \explicit The return type of the Callback.
+ * \tparam UArgs \explicit The types of any arguments to the Callback.
+ * \tparam BArgs \explicit The types of the bound arguments.
+ */
+template <typename R, typename... UArgs, typename... BArgs>
+class BoundCallbackImpl<R(UArgs...), BArgs...> : public CallbackImpl<R, UArgs...>
+{
+  public:
+    /** The type of the callback the arguments are bound to */
+    typedef CallbackImpl<R, BArgs..., UArgs...> Inner;
 
-    std::string GetTypeid() const override
+    /**
+     * Constructor.
+     *
+     * \param [in] inner The callback the arguments are bound to
+     * \param [in] bargs The values of the bound arguments
+     */
+    BoundCallbackImpl(Ptr<const Inner> inner, const std::decay_t<BArgs>&... bargs)
+        : CallbackImpl<R, UArgs...>(&BoundCallbackImpl::Invoke),
+          m_inner(inner),
+          m_bargs(bargs...)
     {
-        return DoGetTypeid();
     }
 
-    /** \copydoc GetTypeid(). */
-    static std::string DoGetTypeid()
+    std::size_t GetComponentCount() const override
     {
-        static std::vector<std::string> vec = {GetCppTypeid<R>(), GetCppTypeid<UArgs>()...};
+        return m_inner->GetComponentCount() + sizeof...(BArgs);
+    }
 
-        static std::string id("CallbackImpl<");
-        for (auto& s : vec)
-        {
-            id.append(s + ",");
-        }
-        if (id.back() == ',')
+    CallbackImplBase::Component GetComponent(std::size_t i) const override
+    {
+        std::size_t innerCount = m_inner->GetComponentCount();
+        if (i < innerCount)
         {
-            id.pop_back();
+            return m_inner->GetComponent(i);
         }
-        id.push_back('>');
-
-        return id;
+        return GetBoundComponent(i - innerCount, std::index_sequence_for<BArgs...>{});
     }
 
   private:
-    /// Stores the callable object associated with this callback (as a lambda)
-    std::function<R(UArgs...)> m_func;
+    /**
+     * Get a bound argument.
+     *
+     * \param [in] i The index of the bound argument.
+     * \return The component.
+     */
+    template <std::size_t... INDEX>
+    CallbackImplBase::Component GetBoundComponent(std::size_t i,
+                                                  std::index_sequence<INDEX...>) const
+    {
+        CallbackImplBase::Component components[] = {
+            CallbackImplBase::MakeComponent(std::get<INDEX>(m_bargs))...,
+            {nullptr, nullptr, nullptr}};
+        return components[i];
+    }
 
-    /// Stores the original callable object and the bound arguments, if any
-    std::vector<std::shared_ptr<CallbackComponentBase>> m_components;
+    /**
+     * Invoke the inner callback with the bound arguments.
+     *
+     * \param [in] impl This object
+     * \param uargs The arguments to the Callback.
+     * \return Callback value
+     */
+    static R Invoke(const CallbackImpl<R, UArgs...>* impl, UArgs... uargs)
+    {
+        auto self = static_cast<const BoundCallbackImpl*>(impl);
+        return std::apply(
+            [self, &uargs...](std::decay_t<BArgs>&... bargs) -> R {
+                return (*self->m_inner)(bargs..., std::forward<UArgs>(uargs)...);
+            },
+            self->m_bargs);
+    }
+
+    Ptr<const Inner> m_inner; //!< The callback the arguments are bound to
+    /// The bound arguments, passed as lvalues to parameters which may be references
+    mutable std::tuple<std::decay_t<BArgs>...> m_bargs;
 };
 
 /**
@@ -466,17 +588,9 @@ class Callback : public CallbackBase
     template <typename... BArgs>
     Callback(const CallbackBase& cb, BArgs... bargs)
     {
-        auto cbDerived =
-            static_cast<const CallbackImpl<R, BArgs..., UArgs...>*>(PeekPointer(cb.GetImpl()));
+        auto cbDerived = StaticCast<const CallbackImpl<R, BArgs..., UArgs...>>(cb.GetImpl());
 
-        std::function<R(BArgs..., UArgs...)> f(cbDerived->GetFunction());
-
-        CallbackComponentVector components(cbDerived->GetComponents());
-        components.insert(components.end(), {std::make_shared<CallbackComponent<BArgs>>(bargs)...});
-
-        m_impl = Create<CallbackImpl<R, UArgs...>>(
-            [f, bargs...](UArgs... uargs) -> R { return f(bargs..., uargs...); },
-            components);
+        m_impl = Create<BoundCallbackImpl<R(UArgs...), BArgs...>>(cbDerived, bargs...);
     }
 
     /**
@@ -496,20 +610,11 @@ class Callback : public CallbackBase
               typename... BArgs>
     Callback(T func, BArgs... bargs)
     {
-        // store the function in a std::function object
-        std::function<R(BArgs..., UArgs...)> f(func);
+        static_assert(std::is_invocable_v<T&, BArgs&..., UArgs...>,
+                      "The callable object cannot be called with these arguments");
 
-        // The original function is comparable if it is a function pointer or
-        // a pointer to a member function or a pointer to a member data.
-        constexpr bool isComp =
-            std::is_function_v<std::remove_pointer_t<T>> || std::is_member_pointer_v<T>;
-
-        CallbackComponentVector components({std::make_shared<CallbackComponent<T, isComp>>(func),
-                                            std::make_shared<CallbackComponent<BArgs>>(bargs)...});
-
-        m_impl = Create<CallbackImpl<R, UArgs...>>(
-            [f, bargs...](UArgs... uargs) -> R { return f(bargs..., uargs...); },
-            components);
+        // store the function and the bound arguments in a single object
+        m_impl = Create<FunctorCallbackImpl<R(UArgs...), T, BArgs...>>(func, bargs...);
     }
 
   private:
@@ -517,19 +622,30 @@ class Callback : public CallbackBase
      * Implementation of the Bind method
      *
      * \tparam BoundArgs The types of the arguments to bind
+     * \param [in] bseq A compile-time integer sequence
      * \param [in] seq A compile-time integer sequence
      * \param [in] bargs The values of the arguments to bind
      * \return The bound callback
      *
      * \internal
-     * The integer sequence is 0..N-1, where N is the number of arguments left unbound.
+     * The first integer sequence is 0..M-1, where M is the number of arguments to bind,
+     * and the second one is 0..N-1, where N is the number of arguments left unbound.
+     * The arguments are bound with the types of the parameters of this callback.
      */
-    template <std::size_t... INDEX, typename... BoundArgs>
-    auto BindImpl(std::index_sequence<INDEX...> seq, BoundArgs... bargs)
+    template <std::size_t... BINDEX, std::size_t... INDEX, typename... BoundArgs>
+    auto BindImpl(std::index_sequence<BINDEX...> bseq,
+                  std::index_sequence<INDEX...> seq,
+                  std::tuple<BoundArgs...>& bargs)
     {
-        return Callback<R, std::tuple_element_t<sizeof...(bargs) + INDEX, std::tuple<UArgs...>>...>(
-            *this,
-            bargs...);
+        using Args = std::tuple<UArgs...>;
+        using Bound =
+            BoundCallbackImpl<R(std::tuple_element_t<sizeof...(BINDEX) + INDEX, Args>...),
+                              std::tuple_element_t<BINDEX, Args>...>;
+
+        Ptr<CallbackImpl<R, std::tuple_element_t<sizeof...(BINDEX) + INDEX, Args>...>> impl =
+            Create<Bound>(Ptr<const CallbackImpl<R, UArgs...>>(DoPeekImpl()),
+                          std::get<BINDEX>(bargs)...);
+        return Callback<R, std::tuple_element_t<sizeof...(BINDEX) + INDEX, Args>...>(impl);
     }
 
   public:
@@ -544,8 +660,10 @@ class Callback : public CallbackBase
     auto Bind(BoundArgs... bargs)
     {
         static_assert(sizeof...(UArgs) > 0);
-        return BindImpl(std::make_index_sequence<sizeof...(UArgs) - sizeof...(BoundArgs)>{},
-                        std::forward<BoundArgs>(bargs)...);
+        std::tuple<BoundArgs...> args(bargs...);
+        return BindImpl(std::index_sequence_for<BoundArgs...>{},
+                        std::make_index_sequence<sizeof...(UArgs) - sizeof...(BoundArgs)>{},
+                        args);
     }
 
     /**
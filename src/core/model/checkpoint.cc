@@ -0,0 +1,460 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "checkpoint.h"
+
+#include "abort.h"
+#include "config.h"
+#include "default-simulator-impl.h"
+#include "log.h"
+#include "object-ptr-container.h"
+#include "pointer.h"
+#include "random-variable-stream.h"
+#include "rng-seed-manager.h"
+#include "rng-stream.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup checkpoint
+ * ns3::Checkpoint implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("Checkpoint");
+
+namespace
+{
+
+/** The checkpoint format version. */
+const uint32_t CHECKPOINT_VERSION = 1;
+
+/**
+ * \ingroup checkpoint
+ * Get the registered CheckpointEvent factories.
+ * \returns The factories, by event name.
+ */
+std::map<std::string, Checkpoint::EventFactory>&
+GetEventFactories()
+{
+    static std::map<std::string, Checkpoint::EventFactory> factories;
+    return factories;
+}
+
+/**
+ * \ingroup checkpoint
+ * Get the simulator implementation, which must be a DefaultSimulatorImpl.
+ * \returns The simulator implementation.
+ */
+Ptr<DefaultSimulatorImpl>
+GetSimulatorImpl()
+{
+    Ptr<DefaultSimulatorImpl> impl =
+        DynamicCast<DefaultSimulatorImpl>(Simulator::GetImplementation());
+    NS_ABORT_MSG_IF(!impl, "Checkpoints require the ns3::DefaultSimulatorImpl");
+    return impl;
+}
+
+/**
+ * \ingroup checkpoint
+ * Write a string which may hold white space, prefixed by its length.
+ * \param [in] os The output stream.
+ * \param [in] str The string.
+ */
+void
+WriteString(std::ostream& os, const std::string& str)
+{
+    os << str.size() << " " << str;
+}
+
+/**
+ * \ingroup checkpoint
+ * Read a string written by WriteString().
+ * \param [in] is The input stream.
+ * \returns The string.
+ */
+std::string
+ReadString(std::istream& is)
+{
+    std::size_t size = 0;
+    is >> size;
+    NS_ABORT_MSG_IF(!is || is.get() != ' ', "Malformed checkpoint string");
+    std::string str(size, '\0');
+    is.read(&str[0], size);
+    NS_ABORT_MSG_IF(!is, "Truncated checkpoint string");
+    return str;
+}
+
+/**
+ * \ingroup checkpoint
+ * Save the attributes of an object, and of the objects it points to.
+ * \param [in] os The output stream.
+ * \param [in] object The object.
+ * \param [in] path The Config path of the object.
+ * \param [in] isRoot Whether the object is a root namespace object,
+ *                    whose own attributes have no Config path.
+ * \param [in,out] visited The objects already saved.
+ */
+void
+SaveAttributes(std::ostream& os,
+               Ptr<Object> object,
+               const std::string& path,
+               bool isRoot,
+               std::set<const Object*>& visited)
+{
+    if (!visited.insert(PeekPointer(object)).second)
+    {
+        return;
+    }
+    NS_LOG_LOGIC("save " << path);
+
+    TypeId tid = object->GetInstanceTypeId();
+    while (true)
+    {
+        for (std::size_t i = 0; i < tid.GetAttributeN(); i++)
+        {
+            TypeId::AttributeInformation info = tid.GetAttribute(i);
+            if (info.supportLevel != TypeId::SUPPORTED || !(info.flags & TypeId::ATTR_GET))
+            {
+                continue;
+            }
+            Ptr<AttributeValue> value = info.checker->Create();
+            if (!object->GetAttributeFailSafe(info.name, *value))
+            {
+                continue;
+            }
+            std::string attributePath = path + "/" + info.name;
+            if (auto pointer = DynamicCast<PointerValue>(value))
+            {
+                if (Ptr<Object> target = pointer->GetObject())
+                {
+                    SaveAttributes(os, target, attributePath, false, visited);
+                }
+                continue;
+            }
+            if (auto container = DynamicCast<ObjectPtrContainerValue>(value))
+            {
+                for (auto it = container->Begin(); it != container->End(); it++)
+                {
+                    if (it->second)
+                    {
+                        SaveAttributes(os,
+                                       it->second,
+                                       attributePath + "/" + std::to_string(it->first),
+                                       false,
+                                       visited);
+                    }
+                }
+                continue;
+            }
+            if (isRoot || !(info.flags & TypeId::ATTR_SET) || DynamicCast<CallbackValue>(value))
+            {
+                continue;
+            }
+            os << "attribute " << path << " " << info.name << " ";
+            WriteString(os, value->SerializeToString(info.checker));
+            os << "\n";
+        }
+        if (tid == tid.GetParent())
+        {
+            break;
+        }
+        tid = tid.GetParent();
+    }
+
+    if (isRoot)
+    {
+        return;
+    }
+    Object::AggregateIterator it = object->GetAggregateIterator();
+    while (it.HasNext())
+    {
+        Ptr<const Object> other = it.Next();
+        if (other != object)
+        {
+            SaveAttributes(os,
+                           ConstCast<Object>(other),
+                           path + "/$" + other->GetInstanceTypeId().GetName(),
+                           false,
+                           visited);
+        }
+    }
+}
+
+/**
+ * \ingroup checkpoint
+ * Restore the value of an attribute, if it differs.
+ * \param [in] object The object.
+ * \param [in] path The Config path of the object.
+ * \param [in] name The attribute name.
+ * \param [in] str The serialized attribute value.
+ */
+void
+RestoreAttribute(Ptr<Object> object,
+                 const std::string& path,
+                 const std::string& name,
+                 const std::string& str)
+{
+    TypeId::AttributeInformation info;
+    NS_ABORT_MSG_UNLESS(object->GetInstanceTypeId().LookupAttributeByName(name, &info),
+                        "No attribute " << name << " in " << path);
+    Ptr<AttributeValue> current = info.checker->Create();
+    if (object->GetAttributeFailSafe(name, *current) &&
+        current->SerializeToString(info.checker) == str)
+    {
+        return;
+    }
+    NS_LOG_LOGIC("restore " << path << "/" << name << " = " << str);
+    Ptr<AttributeValue> value = info.checker->Create();
+    NS_ABORT_MSG_UNLESS(value->DeserializeFromString(str, info.checker),
+                        "Invalid value \"" << str << "\" of " << path << "/" << name);
+    object->SetAttribute(name, *value);
+}
+
+} // unnamed namespace
+
+void
+Checkpoint::RegisterEvent(const std::string& name, EventFactory factory)
+{
+    NS_LOG_FUNCTION(name);
+    NS_ABORT_MSG_IF(name.empty() || name.find_first_of(" \t\n") != std::string::npos,
+                    "Invalid checkpoint event name \"" << name << "\"");
+    bool inserted = GetEventFactories().emplace(name, factory).second;
+    NS_ABORT_MSG_UNLESS(inserted, "Checkpoint event " << name << " registered twice");
+}
+
+uint32_t
+Checkpoint::Save(std::ostream& os)
+{
+    NS_LOG_FUNCTION(&os);
+    Ptr<DefaultSimulatorImpl> impl = GetSimulatorImpl();
+
+    os << "ns3-checkpoint " << CHECKPOINT_VERSION << "\n";
+    os << "resolution " << Time::GetResolution() << "\n";
+    os << "time " << impl->Now().GetTimeStep() << "\n";
+    os << "seed " << RngSeedManager::GetSeed() << "\n";
+    os << "run " << RngSeedManager::GetRun() << "\n";
+    os << "next-stream " << RngSeedManager::PeekNextStreamIndex() << "\n";
+
+    std::vector<const RandomVariableStream*> streams;
+    for (const auto stream : RandomVariableStream::GetInstances())
+    {
+        if (stream->m_rng != nullptr)
+        {
+            streams.push_back(stream);
+        }
+    }
+    std::sort(streams.begin(),
+              streams.end(),
+              [](const RandomVariableStream* a, const RandomVariableStream* b) {
+                  return a->m_rngIndex < b->m_rngIndex;
+              });
+    for (const auto stream : streams)
+    {
+        double state[6];
+        stream->m_rng->GetState(state);
+        os << "stream " << stream->m_rngIndex;
+        for (double s : state)
+        {
+            // The state components are integers below 2^32.
+            os << " " << static_cast<uint64_t>(s);
+        }
+        os << "\n";
+    }
+
+    std::set<const Object*> visited;
+    for (std::size_t i = 0; i < Config::GetRootNamespaceObjectN(); i++)
+    {
+        SaveAttributes(os, Config::GetRootNamespaceObject(i), "", true, visited);
+    }
+
+    uint32_t dropped = 0;
+    for (const auto& ev : impl->GetPendingEvents())
+    {
+        auto event = dynamic_cast<const CheckpointEvent*>(ev.impl);
+        if (event == nullptr)
+        {
+            NS_LOG_WARN("Dropping the event at " << TimeStep(ev.key.m_ts).As()
+                                                 << " which is not a CheckpointEvent");
+            dropped++;
+            continue;
+        }
+        std::ostringstream payload;
+        event->Serialize(payload);
+        os << "event " << ev.key.m_ts << " " << ev.key.m_context << " "
+           << event->GetCheckpointName() << " ";
+        WriteString(os, payload.str());
+        os << "\n";
+    }
+    os << "end\n";
+    NS_ABORT_MSG_IF(!os, "Failed to write the checkpoint");
+    return dropped;
+}
+
+uint32_t
+Checkpoint::Save(const std::string& filename)
+{
+    NS_LOG_FUNCTION(filename);
+    std::ofstream os(filename);
+    NS_ABORT_MSG_UNLESS(os.is_open(), "Cannot open checkpoint file " << filename);
+    return Save(os);
+}
+
+void
+Checkpoint::Restore(std::istream& is)
+{
+    NS_LOG_FUNCTION(&is);
+    Ptr<DefaultSimulatorImpl> impl = GetSimulatorImpl();
+
+    std::string keyword;
+    uint32_t version = 0;
+    is >> keyword >> version;
+    NS_ABORT_MSG_IF(keyword != "ns3-checkpoint" || version != CHECKPOINT_VERSION,
+                    "Not a version " << CHECKPOINT_VERSION << " checkpoint");
+
+    int resolution = -1;
+    int64_t ts = -1;
+    uint32_t seed = 0;
+    uint64_t run = 0;
+    uint64_t nextStream = 0;
+    is >> keyword >> resolution;
+    NS_ABORT_MSG_IF(keyword != "resolution", "Malformed checkpoint: " << keyword);
+    NS_ABORT_MSG_IF(resolution != Time::GetResolution(),
+                    "The checkpoint was saved with a different time resolution");
+    is >> keyword >> ts;
+    NS_ABORT_MSG_IF(keyword != "time", "Malformed checkpoint: " << keyword);
+    is >> keyword >> seed;
+    NS_ABORT_MSG_IF(keyword != "seed", "Malformed checkpoint: " << keyword);
+    is >> keyword >> run;
+    NS_ABORT_MSG_IF(keyword != "run", "Malformed checkpoint: " << keyword);
+    is >> keyword >> nextStream;
+    NS_ABORT_MSG_IF(keyword != "next-stream" || !is, "Malformed checkpoint: " << keyword);
+
+    RngSeedManager::SetSeed(seed);
+    RngSeedManager::SetRun(run);
+    // Do not hand out again the indices of the streams created since.
+    RngSeedManager::SetNextStreamIndex(
+        std::max(nextStream, RngSeedManager::PeekNextStreamIndex()));
+
+    std::multimap<uint64_t, RandomVariableStream*> streams;
+    for (const auto stream : RandomVariableStream::GetInstances())
+    {
+        if (stream->m_rng != nullptr)
+        {
+            streams.emplace(stream->m_rngIndex, stream);
+        }
+    }
+
+    struct SavedEvent
+    {
+        uint64_t ts;
+        uint32_t context;
+        Ptr<CheckpointEvent> event;
+    };
+
+    std::vector<SavedEvent> events;
+    std::string lastPath;
+    Ptr<Object> lastObject;
+    while (is >> keyword && keyword != "end")
+    {
+        if (keyword == "stream")
+        {
+            uint64_t index;
+            uint64_t values[6];
+            is >> index;
+            for (auto& value : values)
+            {
+                is >> value;
+            }
+            NS_ABORT_MSG_IF(!is, "Malformed checkpoint stream");
+            double state[6];
+            std::copy(values, values + 6, state);
+            auto [begin, end] = streams.equal_range(index);
+            if (begin == end)
+            {
+                NS_LOG_WARN("No random variable stream with index " << index);
+            }
+            for (auto it = begin; it != end; it++)
+            {
+                it->second->m_rng->SetState(state);
+            }
+        }
+        else if (keyword == "attribute")
+        {
+            std::string path;
+            std::string name;
+            is >> path >> name;
+            std::string value = ReadString(is);
+            if (path != lastPath || !lastObject)
+            {
+                Config::MatchContainer matches = Config::LookupMatches(path);
+                NS_ABORT_MSG_IF(matches.GetN() != 1,
+                                "The checkpoint object " << path << " matches " << matches.GetN()
+                                                         << " objects");
+                lastPath = path;
+                lastObject = matches.Get(0);
+            }
+            RestoreAttribute(lastObject, path, name, value);
+        }
+        else if (keyword == "event")
+        {
+            SavedEvent saved;
+            std::string name;
+            is >> saved.ts >> saved.context >> name;
+            std::istringstream payload(ReadString(is));
+            auto factory = GetEventFactories().find(name);
+            NS_ABORT_MSG_IF(factory == GetEventFactories().end(),
+                            "No factory registered for the checkpoint event " << name);
+            saved.event = factory->second(payload);
+            NS_ABORT_MSG_IF(!saved.event, "Failed to restore the checkpoint event " << name);
+            events.push_back(saved);
+        }
+        else
+        {
+            NS_FATAL_ERROR("Malformed checkpoint: " << keyword);
+        }
+    }
+    NS_ABORT_MSG_IF(keyword != "end", "Truncated checkpoint");
+
+    impl->SetCurrentTime(TimeStep(ts));
+    for (const auto& saved : events)
+    {
+        Simulator::ScheduleWithContext(saved.context,
+                                       TimeStep(saved.ts) - Simulator::Now(),
+                                       GetPointer(saved.event));
+    }
+}
+
+void
+Checkpoint::Restore(const std::string& filename)
+{
+    NS_LOG_FUNCTION(filename);
+    std::ifstream is(filename);
+    NS_ABORT_MSG_UNLESS(is.is_open(), "Cannot open checkpoint file " << filename);
+    Restore(is);
+}
+
+} // namespace ns3
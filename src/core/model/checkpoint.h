@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "callback.h"
+#include "event-impl.h"
+#include "ptr.h"
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+/**
+ * \file
+ * \ingroup checkpoint
+ * ns3::Checkpoint and ns3::CheckpointEvent declarations.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup core
+ * \defgroup checkpoint Checkpoint
+ *
+ * Save the state of a simulation, and restore it to resume the
+ * simulation later, for example to run several scenarios after a common
+ * warm-up period.
+ */
+
+/**
+ * \ingroup checkpoint
+ * \brief An event which can be saved in a Checkpoint.
+ *
+ * Events bound with MakeEvent() hold arbitrary functions and arguments,
+ * which cannot be saved. Models which want their pending events to be
+ * restored schedule a subclass of CheckpointEvent instead, which writes
+ * its arguments with Serialize(), and register with
+ * Checkpoint::RegisterEvent() a factory which reads them back.
+ */
+class CheckpointEvent : public EventImpl
+{
+  public:
+    /**
+     * Get the name the factory of this event is registered with.
+     *
+     * \returns The name, without white space.
+     */
+    virtual std::string GetCheckpointName() const = 0;
+    /**
+     * Write the arguments of this event.
+     *
+     * \param [in] os The output stream.
+     */
+    virtual void Serialize(std::ostream& os) const = 0;
+};
+
+/**
+ * \ingroup checkpoint
+ * \brief Save and restore the state of a simulation.
+ *
+ * A checkpoint holds:
+ *   - the simulation time,
+ *   - the seed, the run number and the state of each RandomVariableStream,
+ *   - the value of the attributes of the objects reachable from the
+ *     Config root namespace objects (such as the NodeList), through
+ *     Pointer and ObjectPtrContainer attributes and object aggregation
+ *     (the attributes of the root namespace objects themselves have no
+ *     Config path, and are not saved),
+ *   - the pending events which are CheckpointEvents.
+ *
+ * The state of the models which is not exposed through attributes,
+ * and the other pending events, are not saved: Save() returns the
+ * number of pending events which were dropped.
+ *
+ * To restore a checkpoint, the simulation script builds the same
+ * topology as when it was saved, without running the simulator, then
+ * calls Restore(). The attributes which differ from the checkpoint are
+ * set, the random variable streams with the same stream index are
+ * restored, the simulation time is moved forward to the checkpoint time
+ * (see DefaultSimulatorImpl::SetCurrentTime()), and the saved events are
+ * scheduled again.
+ *
+ * \code
+ *   // Warm-up run
+ *   BuildTopology();
+ *   Simulator::Stop(Seconds(100));
+ *   Simulator::Run();
+ *   Checkpoint::Save("warm-up.ckpt");
+ *
+ *   // Later runs
+ *   BuildTopology();
+ *   Checkpoint::Restore("warm-up.ckpt");
+ *   Simulator::Stop(Seconds(10));
+ *   Simulator::Run();
+ * \endcode
+ *
+ * Only the DefaultSimulatorImpl supports checkpoints.
+ */
+class Checkpoint
+{
+  public:
+    /** Callback reading the arguments of an event and creating it. */
+    typedef Callback<Ptr<CheckpointEvent>, std::istream&> EventFactory;
+
+    /**
+     * Register the factory of a CheckpointEvent.
+     *
+     * \param [in] name The name returned by CheckpointEvent::GetCheckpointName().
+     * \param [in] factory The factory of the event.
+     */
+    static void RegisterEvent(const std::string& name, EventFactory factory);
+
+    /**
+     * Save the state of the simulation.
+     *
+     * \param [in] os The output stream.
+     * \returns The number of pending events which could not be saved.
+     */
+    static uint32_t Save(std::ostream& os);
+    /**
+     * Save the state of the simulation to a file.
+     *
+     * \param [in] filename The file name.
+     * \returns The number of pending events which could not be saved.
+     */
+    static uint32_t Save(const std::string& filename);
+
+    /**
+     * Restore the state of the simulation.
+     *
+     * This aborts if the checkpoint is malformed, or if it does not match
+     * the objects of the simulation.
+     *
+     * \param [in] is The input stream.
+     */
+    static void Restore(std::istream& is);
+    /**
+     * Restore the state of the simulation from a file.
+     *
+     * \param [in] filename The file name.
+     */
+    static void Restore(const std::string& filename);
+};
+
+/**
+ * \ingroup checkpoint
+ * Register the factory of a CheckpointEvent at initialization time.
+ *
+ * \param [in] type The CheckpointEvent subclass, which has a static
+ *                  \c std::string \c GetName() function and a static
+ *                  \c Ptr<type> \c Deserialize(std::istream&) function.
+ */
+#define NS_CHECKPOINT_EVENT_REGISTER(type)                                                         \
+    static struct type##CheckpointRegistration                                                     \
+    {                                                                                              \
+        type##CheckpointRegistration()                                                             \
+        {                                                                                          \
+            ns3::Checkpoint::RegisterEvent(type::GetName(), [](std::istream& is) {                 \
+                return ns3::Ptr<ns3::CheckpointEvent>(type::Deserialize(is));                      \
+            });                                                                                    \
+        }                                                                                          \
+    } g_##type##CheckpointRegistration
+
+} // namespace ns3
+
+#endif /* CHECKPOINT_H */
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "dary-heap-scheduler.h"
+
+#include "abort.h"
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "uinteger.h"
+
+#include <algorithm>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * Implementation of ns3::DaryHeapScheduler class.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("DaryHeapScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(DaryHeapScheduler);
+
+TypeId
+DaryHeapScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::DaryHeapScheduler")
+            .SetParent<Scheduler>()
+            .SetGroupName("Core")
+            .AddConstructor<DaryHeapScheduler>()
+            .AddAttribute("Arity",
+                          "The number of children of each heap node (2, 4, 8 or 16)",
+                          TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT,
+                          UintegerValue(4),
+                          MakeUintegerAccessor(&DaryHeapScheduler::SetArity,
+                                               &DaryHeapScheduler::GetArity),
+                          MakeUintegerChecker<uint32_t>(2, 16));
+    return tid;
+}
+
+DaryHeapScheduler::DaryHeapScheduler()
+    : m_log2Arity(2)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+DaryHeapScheduler::~DaryHeapScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+DaryHeapScheduler::SetArity(uint32_t arity)
+{
+    NS_LOG_FUNCTION(this << arity);
+    NS_ABORT_MSG_UNLESS(arity >= 2 && arity <= 16 && (arity & (arity - 1)) == 0,
+                        "Arity must be 2, 4, 8 or 16, not " << arity);
+    NS_ABORT_MSG_UNLESS(m_heap.empty(), "Cannot change the arity of a non-empty heap");
+    m_log2Arity = 0;
+    while ((1U << m_log2Arity) < arity)
+    {
+        m_log2Arity++;
+    }
+}
+
+uint32_t
+DaryHeapScheduler::GetArity() const
+{
+    return 1U << m_log2Arity;
+}
+
+void
+DaryHeapScheduler::SiftUp(std::size_t hole, const Scheduler::Event& ev)
+{
+    while (hole > 0)
+    {
+        std::size_t parent = (hole - 1) >> m_log2Arity;
+        if (!(ev < m_heap[parent]))
+        {
+            break;
+        }
+        m_heap[hole] = m_heap[parent];
+        hole = parent;
+    }
+    m_heap[hole] = ev;
+}
+
+void
+DaryHeapScheduler::SiftDown(std::size_t hole, const Scheduler::Event& ev)
+{
+    std::size_t size = m_heap.size();
+    std::size_t arity = GetArity();
+    while (true)
+    {
+        std::size_t first = (hole << m_log2Arity) + 1;
+        if (first >= size)
+        {
+            break;
+        }
+        std::size_t last = std::min(first + arity, size);
+        std::size_t smallest = first;
+        for (std::size_t child = first + 1; child < last; child++)
+        {
+            if (m_heap[child] < m_heap[smallest])
+            {
+                smallest = child;
+            }
+        }
+        if (!(m_heap[smallest] < ev))
+        {
+            break;
+        }
+        m_heap[hole] = m_heap[smallest];
+        hole = smallest;
+    }
+    m_heap[hole] = ev;
+}
+
+void
+DaryHeapScheduler::Pop()
+{
+    Scheduler::Event last = m_heap.back();
+    m_heap.pop_back();
+    if (!m_heap.empty())
+    {
+        SiftDown(0, last);
+    }
+}
+
+void
+DaryHeapScheduler::DropRemoved()
+{
+    while (!m_removed.empty() && !m_heap.empty())
+    {
+        auto it = m_removed.find(m_heap.front().key.m_uid);
+        if (it == m_removed.end())
+        {
+            return;
+        }
+        m_removed.erase(it);
+        Pop();
+    }
+}
+
+void
+DaryHeapScheduler::Compact()
+{
+    NS_LOG_FUNCTION(this << m_heap.size() << m_removed.size());
+    m_heap.erase(std::remove_if(m_heap.begin(),
+                                m_heap.end(),
+                                [this](const Scheduler::Event& ev) {
+                                    return m_removed.count(ev.key.m_uid) != 0;
+                                }),
+                 m_heap.end());
+    m_removed.clear();
+    Heapify();
+}
+
+void
+DaryHeapScheduler::Heapify()
+{
+    if (m_heap.size() < 2)
+    {
+        return;
+    }
+    // Floyd's bottom-up heap construction
+    std::size_t i = ((m_heap.size() - 2) >> m_log2Arity) + 1;
+    while (i > 0)
+    {
+        i--;
+        Scheduler::Event ev = m_heap[i];
+        SiftDown(i, ev);
+    }
+}
+
+void
+DaryHeapScheduler::Insert(const Scheduler::Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    m_heap.push_back(ev);
+    SiftUp(m_heap.size() - 1, ev);
+}
+
+bool
+DaryHeapScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_heap.empty();
+}
+
+Scheduler::Event
+DaryHeapScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!m_heap.empty());
+    return m_heap.front();
+}
+
+Scheduler::Event
+DaryHeapScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!m_heap.empty());
+    Scheduler::Event next = m_heap.front();
+    Pop();
+    DropRemoved();
+    return next;
+}
+
+void
+DaryHeapScheduler::Remove(const Scheduler::Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    NS_ASSERT(!m_heap.empty());
+    if (m_heap.front().key.m_uid == ev.key.m_uid)
+    {
+        NS_ASSERT(m_heap.front().impl == ev.impl);
+        Pop();
+        DropRemoved();
+        return;
+    }
+    m_removed.insert(ev.key.m_uid);
+    if (2 * m_removed.size() > m_heap.size())
+    {
+        Compact();
+    }
+}
+
+uint32_t
+DaryHeapScheduler::RemoveCancelled()
+{
+    NS_LOG_FUNCTION(this << m_heap.size() << m_removed.size());
+    std::size_t kept = 0;
+    uint32_t cancelled = 0;
+    for (const auto& ev : m_heap)
+    {
+        // The EventImpl of a removed entry may already be deleted
+        if (!m_removed.empty() && m_removed.count(ev.key.m_uid) != 0)
+        {
+            continue;
+        }
+        if (ev.impl->IsCancelled())
+        {
+            ev.impl->Unref();
+            cancelled++;
+            continue;
+        }
+        m_heap[kept] = ev;
+        kept++;
+    }
+    m_heap.resize(kept);
+    m_removed.clear();
+    Heapify();
+    return cancelled;
+}
+
+} // namespace ns3
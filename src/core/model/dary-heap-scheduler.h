@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef DARY_HEAP_SCHEDULER_H
+#define DARY_HEAP_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <stdint.h>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::DaryHeapScheduler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup scheduler
+ * \brief a d-ary implicit heap event scheduler
+ *
+ * This class implements an event scheduler using an implicit d-ary
+ * min-heap on a `std::vector`, ordered by (timestamp, uid). The arity
+ * is set by the \c Arity attribute and must be a power of two, so that
+ * all index computations are shifts.
+ *
+ * Compared to the HeapScheduler, a wider heap is shallower (log_d(n)
+ * levels instead of log_2(n)), and the children of a node are adjacent
+ * in memory: with the default arity of 4 the four candidates examined
+ * at each level of RemoveNext() span only one or two cache lines. With
+ * millions of pending events this trades a few extra comparisons per
+ * level for far fewer cache misses.
+ *
+ * Insert() and RemoveNext() move a "hole" through the heap rather than
+ * swapping entries, so each level costs a single copy.
+ *
+ * Remove() is lazy: unless the event is at the top of the heap, its uid
+ * is only recorded in a set of removed events, and the entry is dropped
+ * when it reaches the top. The EventImpl pointer of such an entry is
+ * never dereferenced again, since the caller releases it right after
+ * Remove(). When removed entries make up more than half of the heap,
+ * the heap is compacted and rebuilt in linear time.
+ *
+ * \par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | Logarithmic     | Sift up
+ * IsEmpty()    | Constant        | `std::vector::empty()`
+ * PeekNext()   | Constant        | Top of the heap is always a live event
+ * Remove()     | Constant        | Lazy deletion, amortized compaction
+ * RemoveNext() | Logarithmic     | Sift down
+ *
+ * \par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | 3 x `sizeof (*)`<br/>(24 bytes)  | `std::vector`
+ * Per Event | 0                                | Events stored in `std::vector` directly
+ *
+ * Removed events cost one `std::unordered_set` node each until they
+ * are dropped.
+ */
+class DaryHeapScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    DaryHeapScheduler();
+    /** Destructor. */
+    ~DaryHeapScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+    uint32_t RemoveCancelled() override;
+
+  private:
+    /**
+     * Set the arity of the heap.
+     *
+     * \param [in] arity The number of children of each node,
+     *             a power of two between 2 and 16.
+     */
+    void SetArity(uint32_t arity);
+    /**
+     * Get the arity of the heap.
+     *
+     * \returns The number of children of each node.
+     */
+    uint32_t GetArity() const;
+
+    /**
+     * Move an event up from a hole until the heap property holds.
+     *
+     * \param [in] hole The index of the hole.
+     * \param [in] ev The event to place.
+     */
+    void SiftUp(std::size_t hole, const Scheduler::Event& ev);
+    /**
+     * Move an event down from a hole until the heap property holds.
+     *
+     * \param [in] hole The index of the hole.
+     * \param [in] ev The event to place.
+     */
+    void SiftDown(std::size_t hole, const Scheduler::Event& ev);
+    /** Remove the top of the heap. */
+    void Pop();
+    /** Pop removed events until the top of the heap is a live event. */
+    void DropRemoved();
+    /** Drop all removed events and rebuild the heap. */
+    void Compact();
+    /** Restore the heap property of the whole heap, in linear time. */
+    void Heapify();
+
+    /** Event list type: vector of Events, managed as a d-ary heap. */
+    typedef std::vector<Scheduler::Event> DaryHeap;
+
+    /** The event list. */
+    DaryHeap m_heap;
+    /** Uids of the events removed but still in the heap. */
+    std::unordered_set<uint32_t> m_removed;
+    /** The base 2 logarithm of the arity. */
+    uint32_t m_log2Arity;
+};
+
+} // namespace ns3
+
+#endif /* DARY_HEAP_SCHEDULER_H */
@@ -19,12 +19,19 @@
 
 #include "default-simulator-impl.h"
 
+#include "abort.h"
 #include "assert.h"
+#include "double.h"
 #include "log.h"
 #include "scheduler.h"
 #include "simulator.h"
+#include "string.h"
+#include "uinteger.h"
 
+#include <algorithm>
 #include <cmath>
+#include <fstream>
+#include <iostream>
 
 /**
  * \file
@@ -48,11 +55,35 @@ DefaultSimulatorImpl::GetTypeId()
     static TypeId tid = TypeId("ns3::DefaultSimulatorImpl")
                             .SetParent<SimulatorImpl>()
                             .SetGroupName("Core")
-                            .AddConstructor<DefaultSimulatorImpl>();
+                            .AddConstructor<DefaultSimulatorImpl>()
+                            .AddAttribute("CompactionThreshold",
+                                          "The fraction of cancelled events in the event list "
+                                          "above which they are removed from it; "
+                                          "1 disables the removal.",
+                                          DoubleValue(0.5),
+                                          MakeDoubleAccessor(
+                                              &DefaultSimulatorImpl::m_compactionThreshold),
+                                          MakeDoubleChecker<double>(0, 1))
+                            .AddAttribute("ProfileInterval",
+                                          "Attribute the wall clock time of one event out of "
+                                          "this many to its handler and context, and report "
+                                          "it at Simulator::Destroy(); 0 disables profiling.",
+                                          UintegerValue(0),
+                                          MakeUintegerAccessor(
+                                              &DefaultSimulatorImpl::SetProfileInterval,
+                                              &DefaultSimulatorImpl::GetProfileInterval),
+                                          MakeUintegerChecker<uint32_t>())
+                            .AddAttribute("ProfileFile",
+                                          "The file to write the event profile to; "
+                                          "by default, it is written to std::clog.",
+                                          StringValue(""),
+                                          MakeStringAccessor(&DefaultSimulatorImpl::m_profileFile),
+                                          MakeStringChecker());
     return tid;
 }
 
 DefaultSimulatorImpl::DefaultSimulatorImpl()
+    : m_eventsWithContext(EVENTS_WITH_CONTEXT_CAPACITY)
 {
     NS_LOG_FUNCTION(this);
     m_stop = false;
@@ -61,8 +92,9 @@ DefaultSimulatorImpl::DefaultSimulatorImpl()
     m_currentTs = 0;
     m_currentContext = Simulator::NO_CONTEXT;
     m_unscheduledEvents = 0;
+    m_cancelledEvents = 0;
     m_eventCount = 0;
-    m_eventsWithContextEmpty = true;
+    m_eventsWithContextOverflowing = false;
     m_mainThreadId = std::this_thread::get_id();
 }
 
@@ -90,6 +122,10 @@ void
 DefaultSimulatorImpl::Destroy()
 {
     NS_LOG_FUNCTION(this);
+    if (m_profiler)
+    {
+        WriteProfile();
+    }
     while (!m_destroyEvents.empty())
     {
         Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
@@ -136,12 +172,25 @@ DefaultSimulatorImpl::ProcessOneEvent()
     NS_ASSERT(next.key.m_ts >= m_currentTs);
     m_unscheduledEvents--;
     m_eventCount++;
+    if (next.impl->IsCancelled())
+    {
+        m_cancelledEvents--;
+    }
 
     NS_LOG_LOGIC("handle " << next.key.m_ts);
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    if (m_profiler && m_profiler->Sample() && !next.impl->IsCancelled())
+    {
+        auto start = EventProfiler::Clock::now();
+        next.impl->Invoke();
+        m_profiler->Record(*next.impl, next.key.m_context, EventProfiler::Clock::now() - start);
+    }
+    else
+    {
+        next.impl->Invoke();
+    }
     next.impl->Unref();
 
     ProcessEventsWithContext();
@@ -156,7 +205,29 @@ DefaultSimulatorImpl::IsFinished() const
 void
 DefaultSimulatorImpl::ProcessEventsWithContext()
 {
-    if (m_eventsWithContextEmpty)
+    auto insert = [this](const EventWithContext& event) {
+        Scheduler::Event ev;
+        ev.impl = event.event;
+        ev.key.m_ts = m_currentTs + event.timestamp;
+        ev.key.m_context = event.context;
+        ev.key.m_uid = m_uid;
+        m_uid++;
+        m_unscheduledEvents++;
+        m_events->Insert(ev);
+    };
+
+    // drain the lock-free queue in one batch
+    EventWithContext event;
+    while (m_eventsWithContext.TryPop(event))
+    {
+        insert(event);
+    }
+
+    // The overflow list only holds events scheduled after those in the
+    // lock-free queue, so it must wait until the queue is fully drained,
+    // including events still being written by other threads.
+    if (!m_eventsWithContextOverflowing.load(std::memory_order_acquire) ||
+        !m_eventsWithContext.IsEmpty())
     {
         return;
     }
@@ -165,21 +236,13 @@ DefaultSimulatorImpl::ProcessEventsWithContext()
     EventsWithContext eventsWithContext;
     {
         std::unique_lock lock{m_eventsWithContextMutex};
-        m_eventsWithContext.swap(eventsWithContext);
-        m_eventsWithContextEmpty = true;
+        m_eventsWithContextOverflow.swap(eventsWithContext);
+        m_eventsWithContextOverflowing.store(false, std::memory_order_release);
     }
     while (!eventsWithContext.empty())
     {
-        EventWithContext event = eventsWithContext.front();
+        insert(eventsWithContext.front());
         eventsWithContext.pop_front();
-        Scheduler::Event ev;
-        ev.impl = event.event;
-        ev.key.m_ts = m_currentTs + event.timestamp;
-        ev.key.m_context = event.context;
-        ev.key.m_uid = m_uid;
-        m_uid++;
-        m_unscheduledEvents++;
-        m_events->Insert(ev);
     }
 }
 
@@ -264,10 +327,12 @@ DefaultSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay, E
         // Current time added in ProcessEventsWithContext()
         ev.timestamp = delay.GetTimeStep();
         ev.event = event;
+        if (m_eventsWithContextOverflowing.load(std::memory_order_acquire) ||
+            !m_eventsWithContext.TryPush(ev))
         {
             std::unique_lock lock{m_eventsWithContextMutex};
-            m_eventsWithContext.push_back(ev);
-            m_eventsWithContextEmpty = false;
+            m_eventsWithContextOverflow.push_back(ev);
+            m_eventsWithContextOverflowing.store(true, std::memory_order_release);
         }
     }
 }
@@ -352,9 +417,30 @@ DefaultSimulatorImpl::Cancel(const EventId& id)
     if (!IsExpired(id))
     {
         id.PeekEventImpl()->Cancel();
+        if (id.GetUid() != EventId::UID::DESTROY)
+        {
+            // The event stays in the event list until it reaches its head
+            m_cancelledEvents++;
+            if (m_cancelledEvents >= COMPACTION_MIN_EVENTS &&
+                m_cancelledEvents > m_compactionThreshold * m_unscheduledEvents)
+            {
+                RemoveCancelled();
+            }
+        }
     }
 }
 
+void
+DefaultSimulatorImpl::RemoveCancelled()
+{
+    NS_LOG_FUNCTION(this << m_unscheduledEvents << m_cancelledEvents);
+    uint32_t removed = m_events->RemoveCancelled();
+    NS_ASSERT_MSG(removed == m_cancelledEvents,
+                  "Removed " << removed << " cancelled events, expected " << m_cancelledEvents);
+    m_unscheduledEvents -= removed;
+    m_cancelledEvents = 0;
+}
+
 bool
 DefaultSimulatorImpl::IsExpired(const EventId& id) const
 {
@@ -405,4 +491,103 @@ DefaultSimulatorImpl::GetEventCount() const
     return m_eventCount;
 }
 
+void
+DefaultSimulatorImpl::SetProfileInterval(uint32_t interval)
+{
+    NS_LOG_FUNCTION(this << interval);
+    if (interval == 0)
+    {
+        m_profiler.reset();
+    }
+    else if (!m_profiler || m_profiler->GetInterval() != interval)
+    {
+        m_profiler = std::make_unique<EventProfiler>(interval);
+    }
+}
+
+uint32_t
+DefaultSimulatorImpl::GetProfileInterval() const
+{
+    return m_profiler ? m_profiler->GetInterval() : 0;
+}
+
+void
+DefaultSimulatorImpl::WriteProfile()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_profileFile.empty())
+    {
+        m_profiler->Report(std::clog);
+    }
+    else
+    {
+        std::ofstream file(m_profileFile);
+        NS_ABORT_MSG_UNLESS(file.is_open(), "Cannot open the event profile " << m_profileFile);
+        m_profiler->Report(file);
+    }
+    m_profiler->Clear();
+}
+
+uint64_t
+DefaultSimulatorImpl::GetLiveEventCount() const
+{
+    return m_unscheduledEvents - m_cancelledEvents;
+}
+
+uint64_t
+DefaultSimulatorImpl::GetCancelledEventCount() const
+{
+    return m_cancelledEvents;
+}
+
+std::vector<Scheduler::Event>
+DefaultSimulatorImpl::GetPendingEvents()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(m_mainThreadId == std::this_thread::get_id(),
+                  "DefaultSimulatorImpl::GetPendingEvents Thread-unsafe invocation!");
+    ProcessEventsWithContext();
+
+    std::vector<Scheduler::Event> events;
+    events.reserve(m_unscheduledEvents);
+    while (!m_events->IsEmpty())
+    {
+        events.push_back(m_events->RemoveNext());
+    }
+    for (const auto& ev : events)
+    {
+        m_events->Insert(ev);
+    }
+    events.erase(std::remove_if(events.begin(),
+                                events.end(),
+                                [](const Scheduler::Event& ev) { return ev.impl->IsCancelled(); }),
+                 events.end());
+    return events;
+}
+
+void
+DefaultSimulatorImpl::SetCurrentTime(const Time& time)
+{
+    NS_LOG_FUNCTION(this << time);
+    NS_ASSERT_MSG(m_mainThreadId == std::this_thread::get_id(),
+                  "DefaultSimulatorImpl::SetCurrentTime Thread-unsafe invocation!");
+    uint64_t ts = time.GetTimeStep();
+    NS_ABORT_MSG_IF(time.IsStrictlyNegative() || ts < m_currentTs,
+                    "Cannot move the simulation time back to " << time);
+    ProcessEventsWithContext();
+
+    std::vector<Scheduler::Event> events;
+    while (!m_events->IsEmpty() && m_events->PeekNext().key.m_ts < ts)
+    {
+        events.push_back(m_events->RemoveNext());
+    }
+    for (auto& ev : events)
+    {
+        ev.key.m_ts = ts;
+        m_events->Insert(ev);
+    }
+    m_currentTs = ts;
+    m_currentUid = EventId::UID::INVALID;
+}
+
 } // namespace ns3
@@ -20,11 +20,17 @@
 #ifndef DEFAULT_SIMULATOR_IMPL_H
 #define DEFAULT_SIMULATOR_IMPL_H
 
+#include "event-profiler.h"
+#include "mpsc-queue.h"
+#include "scheduler.h"
 #include "simulator-impl.h"
 
+#include <atomic>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 /**
  * \file
@@ -35,13 +41,20 @@
 namespace ns3
 {
 
-// Forward
-class Scheduler;
-
 /**
  * \ingroup simulator
  *
  * The default single process simulator implementation.
+ *
+ * Cancelled events stay in the event list until they reach its head.
+ * When they make up more than the \c CompactionThreshold fraction of
+ * the event list, they are all removed at once with
+ * Scheduler::RemoveCancelled(), so that models which cancel many
+ * timers, such as retransmission timeouts, do not bloat the event list.
+ *
+ * When the \c ProfileInterval attribute is not zero, the wall clock time
+ * of the events is attributed to their handler and context by an
+ * EventProfiler, whose report is written at Simulator::Destroy().
  */
 class DefaultSimulatorImpl : public SimulatorImpl
 {
@@ -78,6 +91,43 @@ class DefaultSimulatorImpl : public SimulatorImpl
     uint32_t GetContext() const override;
     uint64_t GetEventCount() const override;
 
+    /**
+     * Get the number of events in the event list which are not cancelled.
+     *
+     * Events scheduled from other threads are only counted once they
+     * have been moved to the event list.
+     *
+     * \returns The number of live events.
+     */
+    uint64_t GetLiveEventCount() const;
+    /**
+     * Get the number of cancelled events still in the event list.
+     *
+     * \returns The number of cancelled events.
+     */
+    uint64_t GetCancelledEventCount() const;
+
+    /**
+     * Get the events in the event list which are not cancelled.
+     *
+     * The events scheduled from other threads are first moved to the
+     * event list. The Destroy events are not included.
+     *
+     * \returns The events, in execution order.
+     */
+    std::vector<Scheduler::Event> GetPendingEvents();
+    /**
+     * Move the simulation time forward, while the simulator is not running.
+     *
+     * This is used to restore a Checkpoint. The pending events earlier
+     * than \p time are moved to \p time, in the same relative order;
+     * their EventIds can still be cancelled, but are then reported as
+     * expired, and can no longer be passed to Simulator::Remove().
+     *
+     * \param [in] time The new simulation time; must not be in the past.
+     */
+    void SetCurrentTime(const Time& time);
+
   private:
     void DoDispose() override;
 
@@ -85,6 +135,20 @@ class DefaultSimulatorImpl : public SimulatorImpl
     void ProcessOneEvent();
     /** Move events from a different context into the main event queue. */
     void ProcessEventsWithContext();
+    /** Remove the cancelled events from the event list. */
+    void RemoveCancelled();
+    /**
+     * Set the event profiling interval.
+     * \param [in] interval Profile one event out of \p interval, or none if zero.
+     */
+    void SetProfileInterval(uint32_t interval);
+    /**
+     * Get the event profiling interval.
+     * \returns The event profiling interval.
+     */
+    uint32_t GetProfileInterval() const;
+    /** Write the event profile, and clear it. */
+    void WriteProfile();
 
     /** Wrap an event with its execution context. */
     struct EventWithContext
@@ -96,16 +160,23 @@ class DefaultSimulatorImpl : public SimulatorImpl
         /** The event implementation. */
         EventImpl* event;
     };
-    /** Container type for the events from a different context. */
+    /** Capacity of the lock-free queue of events from a different thread. */
+    static const std::size_t EVENTS_WITH_CONTEXT_CAPACITY = 4096;
+    /** The lock-free queue of events from a different thread. */
+    MpscQueue<EventWithContext> m_eventsWithContext;
+    /** Container type for the events which did not fit in m_eventsWithContext. */
     typedef std::list<struct EventWithContext> EventsWithContext;
-    /** The container of events from a different context. */
-    EventsWithContext m_eventsWithContext;
+    /** The container of events which did not fit in m_eventsWithContext. */
+    EventsWithContext m_eventsWithContextOverflow;
     /**
-     * Flag \c true if all events with context have been moved to the
-     * primary event queue.
+     * Flag \c true if m_eventsWithContextOverflow may hold events.
+     *
+     * While set, other threads append to m_eventsWithContextOverflow
+     * rather than to m_eventsWithContext, to preserve the order of the
+     * events scheduled by each thread.
      */
-    bool m_eventsWithContextEmpty;
-    /** Mutex to control access to the list of events with context. */
+    std::atomic<bool> m_eventsWithContextOverflowing;
+    /** Mutex to control access to m_eventsWithContextOverflow. */
     std::mutex m_eventsWithContextMutex;
 
     /** Container type for the events to run at Simulator::Destroy() */
@@ -132,6 +203,20 @@ class DefaultSimulatorImpl : public SimulatorImpl
      *  not counting the Destroy events; this is used for validation
      */
     int m_unscheduledEvents;
+    /** Number of cancelled events still in the event list. */
+    uint32_t m_cancelledEvents;
+    /**
+     * Fraction of cancelled events in the event list above which they
+     * are removed.
+     */
+    double m_compactionThreshold;
+    /** Minimum number of cancelled events to remove them. */
+    static const uint32_t COMPACTION_MIN_EVENTS = 1024;
+
+    /** The event profiler, if profiling is enabled. */
+    std::unique_ptr<EventProfiler> m_profiler;
+    /** The file to write the event profile to, or empty for std::clog. */
+    std::string m_profileFile;
 
     /** Main execution thread. */
     std::thread::id m_mainThreadId;
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "event-impl-pool.h"
+
+#include "log.h"
+
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::EventImplPool implementation.
+ */
+
+namespace ns3
+{
+
+// Note: logging is only done on the slab allocation path, the
+// per-event paths are far too hot.
+NS_LOG_COMPONENT_DEFINE("EventImplPool");
+
+namespace
+{
+
+/** Number of size classes. */
+const std::size_t N_CLASSES = EventImplPool::MAX_POOLED_SIZE / EventImplPool::GRANULARITY;
+
+/** A free block, linked through its first bytes. */
+struct FreeBlock
+{
+    FreeBlock* next; //!< Next free block of the same size class.
+};
+
+/** A singly-linked list of free blocks of one size class. */
+struct FreeList
+{
+    FreeBlock* head; //!< First free block.
+    uint32_t count;  //!< Number of blocks in the list.
+};
+
+/** Blocks shared between threads, and ownership of all slabs. */
+struct Depot
+{
+    std::mutex mutex;          //!< Protects all the fields below.
+    FreeList lists[N_CLASSES]; //!< Free lists, one per size class.
+    std::vector<void*> slabs;  //!< All slabs ever allocated.
+    uint64_t reservedBytes;    //!< Total size of the slabs.
+};
+
+/**
+ * Get the depot.
+ *
+ * The depot is intentionally never destroyed, so that events released
+ * during static destruction can still be returned to it.
+ *
+ * \returns The depot.
+ */
+Depot&
+GetDepot()
+{
+    static Depot* depot = new Depot();
+    return *depot;
+}
+
+/**
+ * The free lists and counters of one thread.
+ *
+ * This is trivially destructible, so it stays usable until the thread
+ * terminates, even after ThreadCacheFlusher ran.
+ */
+struct ThreadCache
+{
+    FreeList lists[N_CLASSES];       //!< Free lists, one per size class.
+    EventImplPool::Statistics stats; //!< Allocation counters.
+    bool registered;                 //!< Whether the ThreadCacheFlusher was constructed.
+    bool exited;                     //!< Whether the ThreadCacheFlusher was destroyed.
+};
+
+/** The cache of the calling thread. */
+thread_local ThreadCache t_cache;
+
+/**
+ * Move up to \pname{n} blocks from one free list to another.
+ *
+ * \param [in,out] from The source list.
+ * \param [in,out] to The destination list.
+ * \param [in] n The maximum number of blocks to move.
+ */
+void
+MoveBlocks(FreeList& from, FreeList& to, uint32_t n)
+{
+    while (n > 0 && from.head != nullptr)
+    {
+        FreeBlock* block = from.head;
+        from.head = block->next;
+        from.count--;
+        block->next = to.head;
+        to.head = block;
+        to.count++;
+        n--;
+    }
+}
+
+/** Return the blocks cached by a thread to the depot when it exits. */
+struct ThreadCacheFlusher
+{
+    ~ThreadCacheFlusher()
+    {
+        Depot& depot = GetDepot();
+        std::unique_lock lock{depot.mutex};
+        for (std::size_t cls = 0; cls < N_CLASSES; cls++)
+        {
+            MoveBlocks(t_cache.lists[cls], depot.lists[cls], t_cache.lists[cls].count);
+        }
+        t_cache.exited = true;
+    }
+};
+
+/** Flushes t_cache at thread exit. */
+thread_local ThreadCacheFlusher t_flusher;
+
+/** Make sure t_flusher is constructed for the calling thread. */
+void
+RegisterThreadCache()
+{
+    if (!t_cache.registered)
+    {
+        t_cache.registered = true;
+        [[maybe_unused]] ThreadCacheFlusher* flusher = &t_flusher;
+    }
+}
+
+/**
+ * Refill the free list of the calling thread for one size class,
+ * from the depot if possible, from a new slab otherwise.
+ *
+ * \param [in] cls The size class.
+ * \returns true if a new slab had to be allocated.
+ */
+bool
+Refill(std::size_t cls)
+{
+    RegisterThreadCache();
+    FreeList& list = t_cache.lists[cls];
+    Depot& depot = GetDepot();
+    std::unique_lock lock{depot.mutex};
+    if (depot.lists[cls].head != nullptr)
+    {
+        MoveBlocks(depot.lists[cls], list, EventImplPool::BATCH);
+        return false;
+    }
+
+    std::size_t blockSize = (cls + 1) * EventImplPool::GRANULARITY;
+    std::size_t slabSize = blockSize * EventImplPool::BATCH;
+    auto slab = static_cast<char*>(::operator new(slabSize));
+    NS_LOG_LOGIC("new slab " << static_cast<void*>(slab) << " of " << EventImplPool::BATCH
+                             << " blocks of " << blockSize << " bytes");
+    depot.slabs.push_back(slab);
+    depot.reservedBytes += slabSize;
+    for (uint32_t i = 0; i < EventImplPool::BATCH; i++)
+    {
+        auto block = reinterpret_cast<FreeBlock*>(slab + i * blockSize);
+        block->next = list.head;
+        list.head = block;
+        list.count++;
+    }
+    return true;
+}
+
+} // unnamed namespace
+
+void*
+EventImplPool::Allocate(std::size_t size)
+{
+    if (size > MAX_POOLED_SIZE)
+    {
+        t_cache.stats.oversize++;
+        return ::operator new(size);
+    }
+    std::size_t cls = (size - 1) / GRANULARITY;
+    FreeList& list = t_cache.lists[cls];
+    if (list.head == nullptr && Refill(cls))
+    {
+        t_cache.stats.misses++;
+    }
+    else
+    {
+        t_cache.stats.hits++;
+    }
+    FreeBlock* block = list.head;
+    list.head = block->next;
+    list.count--;
+    return block;
+}
+
+void
+EventImplPool::Deallocate(void* p, std::size_t size)
+{
+    if (p == nullptr)
+    {
+        return;
+    }
+    if (size > MAX_POOLED_SIZE)
+    {
+        ::operator delete(p);
+        return;
+    }
+    std::size_t cls = (size - 1) / GRANULARITY;
+    auto block = static_cast<FreeBlock*>(p);
+    t_cache.stats.frees++;
+    if (t_cache.exited)
+    {
+        // The thread cache was flushed already: bypass it.
+        Depot& depot = GetDepot();
+        std::unique_lock lock{depot.mutex};
+        block->next = depot.lists[cls].head;
+        depot.lists[cls].head = block;
+        depot.lists[cls].count++;
+        return;
+    }
+    FreeList& list = t_cache.lists[cls];
+    block->next = list.head;
+    list.head = block;
+    list.count++;
+    if (list.count > 2 * BATCH)
+    {
+        RegisterThreadCache();
+        Depot& depot = GetDepot();
+        std::unique_lock lock{depot.mutex};
+        MoveBlocks(list, depot.lists[cls], BATCH);
+    }
+}
+
+EventImplPool::Statistics
+EventImplPool::GetStatistics()
+{
+    return t_cache.stats;
+}
+
+void
+EventImplPool::ResetStatistics()
+{
+    t_cache.stats = Statistics{};
+}
+
+uint64_t
+EventImplPool::GetReservedBytes()
+{
+    Depot& depot = GetDepot();
+    std::unique_lock lock{depot.mutex};
+    return depot.reservedBytes;
+}
+
+} // namespace ns3
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EVENT_IMPL_POOL_H
+#define EVENT_IMPL_POOL_H
+
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::EventImplPool declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup events
+ * \brief Size-class slab allocator backing every EventImpl.
+ *
+ * Each MakeEvent() call creates a small, short-lived EventImpl subclass
+ * which used to go through the global operator new and delete. This
+ * pool rounds the requested size up to a multiple of GRANULARITY bytes
+ * and recycles freed blocks through per-thread free lists, one per size
+ * class, so that in steady state scheduling an event does not touch the
+ * system allocator at all.
+ *
+ * Blocks are carved from slabs of BATCH blocks. A thread whose free list
+ * grows beyond 2 * BATCH blocks (typically the simulation thread
+ * releasing events injected by fd-net-device or tap-bridge reader
+ * threads) hands BATCH blocks back to a shared, mutex-protected depot,
+ * from which other threads refill before allocating a new slab. The
+ * lock is only taken on these batch transfers, never per event.
+ *
+ * Requests larger than MAX_POOLED_SIZE bytes are forwarded to the
+ * global operator new.
+ *
+ * Slabs are never released to the system: the pool is sized by the
+ * peak number of pending events.
+ */
+class EventImplPool
+{
+  public:
+    /** Allocation counters of the calling thread. */
+    struct Statistics
+    {
+        uint64_t hits;     //!< Allocations served from a free list.
+        uint64_t misses;   //!< Allocations which required a new slab.
+        uint64_t oversize; //!< Allocations forwarded to the global operator new.
+        uint64_t frees;    //!< Blocks returned to the pool.
+    };
+
+    /** Size class granularity, in bytes. */
+    static const std::size_t GRANULARITY = 16;
+    /** Largest block size served by the pool, in bytes. */
+    static const std::size_t MAX_POOLED_SIZE = 256;
+    /** Number of blocks per slab and per depot transfer. */
+    static const uint32_t BATCH = 64;
+
+    /**
+     * Allocate a block of at least \pname{size} bytes.
+     *
+     * \param [in] size The requested size.
+     * \returns The block.
+     */
+    static void* Allocate(std::size_t size);
+    /**
+     * Release a block obtained from Allocate().
+     *
+     * \param [in] p The block.
+     * \param [in] size The size passed to Allocate().
+     */
+    static void Deallocate(void* p, std::size_t size);
+    /**
+     * Get the allocation counters of the calling thread.
+     *
+     * \returns The counters accumulated since the last ResetStatistics().
+     */
+    static Statistics GetStatistics();
+    /** Reset the allocation counters of the calling thread. */
+    static void ResetStatistics();
+    /**
+     * Get the total number of slab bytes reserved by all threads.
+     *
+     * \returns The number of bytes.
+     */
+    static uint64_t GetReservedBytes();
+};
+
+} // namespace ns3
+
+#endif /* EVENT_IMPL_POOL_H */
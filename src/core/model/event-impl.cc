@@ -19,6 +19,7 @@
 
 #include "event-impl.h"
 
+#include "event-impl-pool.h"
 #include "log.h"
 
 /**
@@ -67,4 +68,22 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+EventImpl::Handler
+EventImpl::GetHandler() const
+{
+    return Handler{};
+}
+
+void*
+EventImpl::operator new(std::size_t size)
+{
+    return EventImplPool::Allocate(size);
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size)
+{
+    EventImplPool::Deallocate(p, size);
+}
+
 } // namespace ns3
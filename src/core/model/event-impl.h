@@ -21,7 +21,11 @@
 
 #include "simple-ref-count.h"
 
+#include <array>
+#include <cstddef>
+#include <cstring>
 #include <stdint.h>
+#include <type_traits>
 
 /**
  * \file
@@ -67,6 +71,48 @@ class EventImpl : public SimpleRefCount<EventImpl>
      */
     bool IsCancelled();
 
+    /** Identity of the function invoked by an event, and of its object. */
+    struct Handler
+    {
+        /** The bits of the function pointer, zero-padded. */
+        std::array<uintptr_t, 3> function;
+        /** The object of a member function, or \c nullptr. */
+        const void* object;
+        /** Whether the function is a member function. */
+        bool member;
+    };
+
+    /**
+     * Identify the function invoked by this event, and its object, to
+     * profile the events by handler.
+     *
+     * The default implementation returns a null function and object:
+     * the concrete event type is then the only identity of the handler.
+     * This is the case of the events built from a function object, whose
+     * type is unique for each lambda expression.
+     *
+     * \returns The handler.
+     */
+    virtual Handler GetHandler() const;
+
+    /**
+     * Allocate an event from the EventImplPool.
+     *
+     * \param [in] size The size of the concrete event type.
+     * \returns The storage for the event.
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Return an event to the EventImplPool.
+     *
+     * The virtual destructor guarantees that \pname{size} is the
+     * size of the concrete event type.
+     *
+     * \param [in] p The storage of the event.
+     * \param [in] size The size of the concrete event type.
+     */
+    static void operator delete(void* p, std::size_t size);
+
   protected:
     /**
      * Implementation for Invoke().
@@ -76,6 +122,26 @@ class EventImpl : public SimpleRefCount<EventImpl>
      */
     virtual void Notify() = 0;
 
+    /**
+     * Build the Handler of a function pointer or member function pointer.
+     *
+     * \tparam FUNC \deduced The function pointer type.
+     * \param [in] function The function.
+     * \param [in] object The object of a member function, or \c nullptr.
+     * \returns The handler.
+     */
+    template <typename FUNC>
+    static Handler MakeHandler(FUNC function, const void* object)
+    {
+        static_assert(sizeof(FUNC) <= sizeof(Handler::function),
+                      "Function pointer too large for EventImpl::Handler");
+        Handler handler{};
+        std::memcpy(handler.function.data(), &function, sizeof(FUNC));
+        handler.object = object;
+        handler.member = std::is_member_function_pointer_v<FUNC>;
+        return handler;
+    }
+
   private:
     bool m_cancel; /**< Has this event been cancelled. */
 };
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "event-profiler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <tuple>
+
+#if (__GNUC__ >= 3)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+#if __has_include(<dlfcn.h>)
+#include <dlfcn.h>
+#define HAVE_DLADDR 1
+#endif
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EventProfiler");
+
+namespace
+{
+
+/**
+ * Demangle a C++ name.
+ *
+ * \param [in] name The mangled name.
+ * \returns The demangled name, or \pname{name} if it cannot be demangled.
+ */
+std::string
+Demangle(const char* name)
+{
+    std::string demangled = name;
+#if (__GNUC__ >= 3)
+    int status;
+    char* buffer = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0)
+    {
+        demangled = buffer;
+    }
+    std::free(buffer);
+#endif
+    return demangled;
+}
+
+/**
+ * Get the address of the code of a handler.
+ *
+ * \param [in] handler The handler.
+ * \returns The address, or \c nullptr if it is not known, as for the
+ *          virtual member functions.
+ */
+const void*
+GetCodeAddress(const EventImpl::Handler& handler)
+{
+    if (!handler.member)
+    {
+        return reinterpret_cast<const void*>(handler.function[0]);
+    }
+#if defined(__GNUC__) && !defined(_WIN32)
+    // With the Itanium C++ ABI, a member function pointer is a {ptr, adj}
+    // pair, and ptr is the address of the function unless it is virtual,
+    // which is flagged by the low bit of ptr, or of adj on ARM.
+#if defined(__arm__) || defined(__aarch64__)
+    bool isVirtual = handler.function[1] & 1;
+#else
+    bool isVirtual = handler.function[0] & 1;
+#endif
+    if (!isVirtual)
+    {
+        return reinterpret_cast<const void*>(handler.function[0]);
+    }
+#endif
+    return nullptr;
+}
+
+} // unnamed namespace
+
+EventProfiler::EventProfiler(uint32_t interval)
+    : m_interval(interval),
+      m_countdown(interval)
+{
+    NS_LOG_FUNCTION(this << interval);
+    NS_ASSERT_MSG(interval > 0, "The sampling interval must be positive");
+}
+
+uint32_t
+EventProfiler::GetInterval() const
+{
+    return m_interval;
+}
+
+void
+EventProfiler::Record(const EventImpl& event, uint32_t context, Clock::duration elapsed)
+{
+    Stats& stats = m_profile[Key{std::type_index(typeid(event)), event.GetHandler(), context}];
+    stats.count++;
+    stats.total += elapsed;
+    stats.max = std::max(stats.max, elapsed);
+}
+
+std::string
+EventProfiler::GetHandlerName(std::type_index type, const EventImpl::Handler& handler)
+{
+#ifdef HAVE_DLADDR
+    const void* address = GetCodeAddress(handler);
+    Dl_info info;
+    if (address != nullptr && dladdr(address, &info) != 0 && info.dli_sname != nullptr &&
+        info.dli_saddr == address)
+    {
+        return Demangle(info.dli_sname);
+    }
+#endif
+
+    std::string name = Demangle(type.name());
+    // The MakeEvent() implementations are local classes: drop the
+    // return type of the function template they belong to.
+    const std::string prefix = "ns3::EventImpl* ";
+    if (name.compare(0, prefix.size(), prefix) == 0)
+    {
+        name = name.substr(prefix.size());
+    }
+    // For member functions, the first template argument of MakeEvent(),
+    // the member function pointer type, names the class and signature.
+    const std::string member = "ns3::MakeEvent<";
+    if (name.compare(0, member.size(), member) == 0 &&
+        name.find("::EventMemberImpl") != std::string::npos)
+    {
+        int depth = 0;
+        for (std::size_t i = member.size(); i < name.size(); i++)
+        {
+            char c = name[i];
+            if (c == '<' || c == '(')
+            {
+                depth++;
+            }
+            else if (c == '>' || c == ')')
+            {
+                depth--;
+            }
+            if (depth < 0 || (depth == 0 && c == ','))
+            {
+                name = name.substr(member.size(), i - member.size());
+                break;
+            }
+        }
+    }
+    // Several functions may share the signature: tell them apart by the
+    // bits of their pointer, which for virtual member functions are an
+    // offset in the virtual table.
+    if (handler.function[0] != 0 || handler.function[1] != 0)
+    {
+        std::ostringstream oss;
+        oss << name << " at 0x" << std::hex << handler.function[0];
+        if (handler.function[1] != 0)
+        {
+            oss << ":" << handler.function[1];
+        }
+        name = oss.str();
+    }
+    return name;
+}
+
+void
+EventProfiler::Finish(std::vector<Entry>& entries) const
+{
+    for (auto& entry : entries)
+    {
+        entry.count *= m_interval;
+        entry.total *= m_interval;
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.total != b.total)
+        {
+            return a.total > b.total;
+        }
+        return std::tie(a.handler, a.context, a.object) < std::tie(b.handler, b.context, b.object);
+    });
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::GetHandlerEntries() const
+{
+    NS_LOG_FUNCTION(this);
+    std::unordered_map<Key, Stats, KeyHash> handlers;
+    for (const auto& [key, stats] : m_profile)
+    {
+        Key handler = key;
+        handler.handler.object = nullptr;
+        handler.context = Simulator::NO_CONTEXT;
+        Stats& sum = handlers[handler];
+        sum.count += stats.count;
+        sum.total += stats.total;
+        sum.max = std::max(sum.max, stats.max);
+    }
+    std::vector<Entry> entries;
+    for (const auto& [key, stats] : handlers)
+    {
+        entries.push_back({GetHandlerName(key.type, key.handler),
+                           nullptr,
+                           Simulator::NO_CONTEXT,
+                           stats.count,
+                           stats.total,
+                           stats.max});
+    }
+    Finish(entries);
+    return entries;
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::GetContextEntries() const
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<Entry> entries;
+    for (const auto& [key, stats] : m_profile)
+    {
+        entries.push_back({GetHandlerName(key.type, key.handler),
+                           key.handler.object,
+                           key.context,
+                           stats.count,
+                           stats.total,
+                           stats.max});
+    }
+    Finish(entries);
+    return entries;
+}
+
+void
+EventProfiler::Report(std::ostream& os, std::size_t maxContextEntries) const
+{
+    NS_LOG_FUNCTION(this << maxContextEntries);
+    using FloatSeconds = std::chrono::duration<double>;
+    using FloatMicroSeconds = std::chrono::duration<double, std::micro>;
+
+    auto handlers = GetHandlerEntries();
+    Clock::duration total = Clock::duration();
+    uint64_t count = 0;
+    for (const auto& entry : handlers)
+    {
+        total += entry.total;
+        count += entry.count;
+    }
+
+    auto row = [&os, total](const Entry& entry) {
+        double share = total.count() ? 100.0 * entry.total.count() / total.count() : 0;
+        os << std::setw(12) << FloatSeconds(entry.total).count() << std::setw(8) << share
+           << std::setw(14) << entry.count << std::setw(12)
+           << FloatMicroSeconds(entry.total).count() / entry.count << std::setw(12)
+           << FloatMicroSeconds(entry.max).count();
+    };
+
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+
+    os << "Event profile: " << count << " events, " << FloatSeconds(total).count() << " s";
+    if (m_interval > 1)
+    {
+        os << ", estimated from one event out of " << m_interval;
+    }
+    os << std::endl;
+
+    os << std::endl << "By event handler:" << std::endl;
+    os << std::setw(12) << "Time (s)" << std::setw(8) << "%" << std::setw(14) << "Events"
+       << std::setw(12) << "Mean (us)" << std::setw(12) << "Max (us)"
+       << "  Handler" << std::endl;
+    for (const auto& entry : handlers)
+    {
+        row(entry);
+        os << "  " << entry.handler << std::endl;
+    }
+
+    auto contexts = GetContextEntries();
+    os << std::endl << "By event handler, object and context";
+    if (contexts.size() > maxContextEntries)
+    {
+        os << ", top " << maxContextEntries << " of " << contexts.size();
+        contexts.resize(maxContextEntries);
+    }
+    os << ":" << std::endl;
+    os << std::setw(12) << "Time (s)" << std::setw(8) << "%" << std::setw(14) << "Events"
+       << std::setw(12) << "Mean (us)" << std::setw(12) << "Max (us)" << std::setw(10)
+       << "Context"
+       << "  Handler" << std::endl;
+    for (const auto& entry : contexts)
+    {
+        row(entry);
+        os << std::setw(10);
+        if (entry.context == Simulator::NO_CONTEXT)
+        {
+            os << "-";
+        }
+        else
+        {
+            os << entry.context;
+        }
+        os << "  " << entry.handler;
+        if (entry.object != nullptr)
+        {
+            os << " on " << entry.object;
+        }
+        os << std::endl;
+    }
+
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void
+EventProfiler::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    m_profile.clear();
+    m_countdown = m_interval;
+}
+
+} // namespace ns3
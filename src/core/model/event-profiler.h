@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include "event-impl.h"
+
+#include <chrono>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::EventProfiler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup events
+ * \brief Attribute the wall clock time of the events to their handler.
+ *
+ * The simulator times the execution of the events, and reports it
+ * here together with the event, whose handler is the function or member
+ * function bound by MakeEvent(), as returned by EventImpl::GetHandler(),
+ * and the context (node id) of the event. The time and number of
+ * invocations are accumulated per handler, and per handler, object and
+ * context, and reported sorted by decreasing time.
+ *
+ * The handlers are named after their symbol when the dynamic linker
+ * can resolve it, and otherwise after their signature, followed by the
+ * address of the function.
+ *
+ * Timing every event costs two clock reads and a hash table lookup per
+ * event. With a sampling interval \c N, only one event out of \c N is
+ * timed, and the reported times and counts are the sampled values
+ * multiplied by \c N.
+ *
+ * The DefaultSimulatorImpl uses an EventProfiler when its
+ * \c ProfileInterval attribute is not zero.
+ */
+class EventProfiler
+{
+  public:
+    /** The clock measuring the events. */
+    typedef std::chrono::steady_clock Clock;
+
+    /** The profile of a handler, or of a handler in a context. */
+    struct Entry
+    {
+        std::string handler;   //!< The name of the handler.
+        const void* object;    //!< The object, for the entries by context.
+        uint32_t context;      //!< The context, for the entries by context.
+        uint64_t count;        //!< The number of events.
+        Clock::duration total; //!< The total wall clock time.
+        Clock::duration max;   //!< The longest event.
+    };
+
+    /**
+     * Constructor.
+     *
+     * \param [in] interval Time one event out of \p interval; must be > 0.
+     */
+    EventProfiler(uint32_t interval);
+
+    /**
+     * Get the sampling interval.
+     *
+     * \returns The sampling interval.
+     */
+    uint32_t GetInterval() const;
+
+    /**
+     * Check whether the next event should be timed.
+     *
+     * \returns \c true one time out of the sampling interval.
+     */
+    inline bool Sample()
+    {
+        if (--m_countdown != 0)
+        {
+            return false;
+        }
+        m_countdown = m_interval;
+        return true;
+    }
+
+    /**
+     * Record the execution of an event.
+     *
+     * \param [in] event The event.
+     * \param [in] context The context of the event.
+     * \param [in] elapsed The wall clock time of the event.
+     */
+    void Record(const EventImpl& event, uint32_t context, Clock::duration elapsed);
+
+    /**
+     * Get the profile of each handler, summed over all contexts.
+     *
+     * \returns The entries, by decreasing total time; their object and
+     *          context are not meaningful.
+     */
+    std::vector<Entry> GetHandlerEntries() const;
+    /**
+     * Get the profile of each handler, for each object and context.
+     *
+     * \returns The entries, by decreasing total time.
+     */
+    std::vector<Entry> GetContextEntries() const;
+
+    /**
+     * Write the profile of the handlers, and of the handlers for the
+     * objects and contexts which took the most time.
+     *
+     * \param [in] os The output stream.
+     * \param [in] maxContextEntries The maximum number of entries by context.
+     */
+    void Report(std::ostream& os, std::size_t maxContextEntries = 20) const;
+
+    /** Forget all the events recorded. */
+    void Clear();
+
+  private:
+    /** Key of the profile of a handler, for an object in a context. */
+    struct Key
+    {
+        std::type_index type;       //!< The EventImpl type.
+        EventImpl::Handler handler; //!< The function and object.
+        uint32_t context;           //!< The context.
+
+        /**
+         * Equality operator.
+         * \param [in] other The other key.
+         * \returns \c true if the keys are equal.
+         */
+        bool operator==(const Key& other) const
+        {
+            return type == other.type && handler.function == other.handler.function &&
+                   handler.object == other.handler.object && context == other.context;
+        }
+    };
+
+    /** Hash functor of the Key. */
+    struct KeyHash
+    {
+        /**
+         * Hash a key.
+         * \param [in] key The key.
+         * \returns The hash.
+         */
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t hash = key.type.hash_code();
+            for (auto word : key.handler.function)
+            {
+                hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+            }
+            hash = (hash ^ reinterpret_cast<uintptr_t>(key.handler.object)) * 0x9e3779b97f4a7c15ULL;
+            return hash ^ (std::size_t(key.context) * 0x9e3779b97f4a7c15ULL);
+        }
+    };
+
+    /** Accumulated statistics. */
+    struct Stats
+    {
+        uint64_t count = 0;                        //!< The number of events sampled.
+        Clock::duration total = Clock::duration(); //!< The total time.
+        Clock::duration max = Clock::duration();   //!< The longest event.
+    };
+
+    /**
+     * Get the name of a handler.
+     *
+     * \param [in] type The EventImpl type.
+     * \param [in] handler The function.
+     * \returns The demangled name.
+     */
+    static std::string GetHandlerName(std::type_index type, const EventImpl::Handler& handler);
+
+    /**
+     * Scale the sampled statistics and sort them by decreasing time.
+     *
+     * \param [in,out] entries The entries.
+     */
+    void Finish(std::vector<Entry>& entries) const;
+
+    uint32_t m_interval;                               //!< The sampling interval.
+    uint32_t m_countdown;                              //!< Events until the next sample.
+    std::unordered_map<Key, Stats, KeyHash> m_profile; //!< The statistics.
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
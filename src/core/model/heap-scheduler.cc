@@ -152,10 +152,10 @@ HeapScheduler::IsEmpty() const
 }
 
 void
-HeapScheduler::BottomUp()
+HeapScheduler::BottomUp(std::size_t start)
 {
-    NS_LOG_FUNCTION(this);
-    std::size_t index = Last();
+    NS_LOG_FUNCTION(this << start);
+    std::size_t index = start;
     while (!IsRoot(index) && IsLessStrictly(index, Parent(index)))
     {
         Exch(index, Parent(index));
@@ -203,7 +203,7 @@ HeapScheduler::Insert(const Event& ev)
 {
     NS_LOG_FUNCTION(this << &ev);
     m_heap.push_back(ev);
-    BottomUp();
+    BottomUp(Last());
 }
 
 Scheduler::Event
@@ -236,6 +236,11 @@ HeapScheduler::Remove(const Event& ev)
             NS_ASSERT(m_heap[i].impl == ev.impl);
             Exch(i, Last());
             m_heap.pop_back();
+            // The former Last item may belong either above or below i.
+            if (!IsBottom(i))
+            {
+                BottomUp(i);
+            }
             TopDown(i);
             return;
         }
@@ -243,4 +248,31 @@ HeapScheduler::Remove(const Event& ev)
     NS_ASSERT(false);
 }
 
+uint32_t
+HeapScheduler::RemoveCancelled()
+{
+    NS_LOG_FUNCTION(this);
+    std::size_t kept = Root();
+    for (std::size_t i = Root(); i < m_heap.size(); i++)
+    {
+        if (m_heap[i].impl->IsCancelled())
+        {
+            m_heap[i].impl->Unref();
+        }
+        else
+        {
+            m_heap[kept] = m_heap[i];
+            kept++;
+        }
+    }
+    auto cancelled = static_cast<uint32_t>(m_heap.size() - kept);
+    m_heap.resize(kept);
+    // Rebuild the heap bottom-up, from the parent of the last item
+    for (std::size_t i = Last() / 2; i >= Root(); i--)
+    {
+        TopDown(i);
+    }
+    return cancelled;
+}
+
 } // namespace ns3
@@ -112,4 +112,26 @@ ListScheduler::Remove(const Event& ev)
     NS_ASSERT(false);
 }
 
+uint32_t
+ListScheduler::RemoveCancelled()
+{
+    NS_LOG_FUNCTION(this);
+    uint32_t cancelled = 0;
+    EventsI i = m_events.begin();
+    while (i != m_events.end())
+    {
+        if (i->impl->IsCancelled())
+        {
+            i->impl->Unref();
+            i = m_events.erase(i);
+            cancelled++;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return cancelled;
+}
+
 } // namespace ns3
@@ -82,6 +82,7 @@ class ListScheduler : public Scheduler
     Scheduler::Event PeekNext() const override;
     Scheduler::Event RemoveNext() override;
     void Remove(const Scheduler::Event& ev) override;
+    uint32_t RemoveCancelled() override;
 
   private:
     /** Event list type: a simple list of Events. */
@@ -58,6 +58,11 @@ MakeEvent(void (*f)())
             (*m_function)();
         }
 
+        Handler GetHandler() const override
+        {
+            return MakeHandler(m_function, nullptr);
+        }
+
       private:
         F m_function;
     }* ev = new EventFunctionImpl0(f);
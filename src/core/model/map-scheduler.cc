@@ -112,4 +112,26 @@ MapScheduler::Remove(const Event& ev)
     m_list.erase(i);
 }
 
+uint32_t
+MapScheduler::RemoveCancelled()
+{
+    NS_LOG_FUNCTION(this);
+    uint32_t cancelled = 0;
+    EventMapI i = m_list.begin();
+    while (i != m_list.end())
+    {
+        if (i->second->IsCancelled())
+        {
+            i->second->Unref();
+            i = m_list.erase(i);
+            cancelled++;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return cancelled;
+}
+
 } // namespace ns3
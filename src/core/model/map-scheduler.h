@@ -80,6 +80,7 @@ class MapScheduler : public Scheduler
     Scheduler::Event PeekNext() const override;
     Scheduler::Event RemoveNext() override;
     void Remove(const Scheduler::Event& ev) override;
+    uint32_t RemoveCancelled() override;
 
   private:
     /** Event list type: a Map from EventKey to EventImpl. */
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include "assert.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::MpscQueue declaration and template implementation.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup core
+ * \brief A bounded, lock-free, multiple producer, single consumer queue.
+ *
+ * This is D. Vyukov's bounded queue: a ring of cells, each carrying a
+ * sequence number which tells producers and the consumer whether the
+ * cell is free or holds a value for the current lap of the ring.
+ * Producers claim a cell with a single compare-and-swap on the enqueue
+ * position; the single consumer needs no read-modify-write at all. No
+ * memory is allocated after construction.
+ *
+ * TryPush() may be called concurrently from any number of threads.
+ * TryPop() must only ever be called from one thread at a time.
+ *
+ * A value pushed by one producer is popped after every value that
+ * producer pushed before it. A cell claimed by a producer which has
+ * not finished writing it yet makes TryPop() report an empty queue,
+ * even if later cells are ready.
+ *
+ * \tparam T \explicit The type of the values, which must be copy-assignable
+ *           and default-constructible.
+ */
+template <typename T>
+class MpscQueue
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * \param [in] capacity The number of cells, a power of two.
+     */
+    MpscQueue(std::size_t capacity);
+
+    /** Copying is not supported. */
+    MpscQueue(const MpscQueue&) = delete;
+    /**
+     * Copying is not supported.
+     * \returns Nothing.
+     */
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * Append a value, from any thread.
+     *
+     * \param [in] value The value.
+     * \returns \c false if the queue is full.
+     */
+    bool TryPush(const T& value);
+    /**
+     * Remove the oldest value, from the consumer thread.
+     *
+     * \param [out] value The value.
+     * \returns \c false if the queue is empty.
+     */
+    bool TryPop(T& value);
+    /**
+     * Check whether every value claimed by a producer has been popped,
+     * from the consumer thread.
+     *
+     * Unlike a failed TryPop(), this also accounts for values which
+     * are still being written.
+     *
+     * \returns \c true if the queue is empty.
+     */
+    bool IsEmpty() const;
+    /**
+     * Get the capacity.
+     *
+     * \returns The number of cells.
+     */
+    std::size_t GetCapacity() const;
+
+  private:
+    /** A cell of the ring. */
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence; //!< Lap of the ring this cell is ready for.
+        T value;                           //!< The value.
+    };
+
+    /** Assumed size of a cache line, to keep producers and consumer apart. */
+    static const std::size_t CACHE_LINE = 64;
+
+    std::unique_ptr<Cell[]> m_cells; //!< The ring.
+    std::size_t m_mask;              //!< Capacity - 1.
+    /** Next position to be claimed by a producer. */
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_enqueuePos;
+    /** Next position to be read by the consumer. */
+    alignas(CACHE_LINE) std::size_t m_dequeuePos;
+};
+
+} // namespace ns3
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+namespace ns3
+{
+
+template <typename T>
+MpscQueue<T>::MpscQueue(std::size_t capacity)
+    : m_cells(new Cell[capacity]),
+      m_mask(capacity - 1),
+      m_enqueuePos(0),
+      m_dequeuePos(0)
+{
+    NS_ASSERT_MSG(capacity >= 2 && (capacity & (capacity - 1)) == 0,
+                  "MpscQueue capacity must be a power of two");
+    for (std::size_t i = 0; i < capacity; i++)
+    {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool
+MpscQueue<T>::TryPush(const T& value)
+{
+    std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Cell& cell = m_cells[pos & m_mask];
+        std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+        if (diff == 0)
+        {
+            // The cell is free for this lap: try to claim it.
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.value = value;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+            // pos was reloaded by the failed compare_exchange_weak
+        }
+        else if (diff < 0)
+        {
+            // The cell still holds a value from the previous lap.
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the cell first.
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool
+MpscQueue<T>::TryPop(T& value)
+{
+    Cell& cell = m_cells[m_dequeuePos & m_mask];
+    std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    if (sequence != m_dequeuePos + 1)
+    {
+        return false;
+    }
+    value = cell.value;
+    // Free the cell for the next lap of the producers.
+    cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+    m_dequeuePos++;
+    return true;
+}
+
+template <typename T>
+bool
+MpscQueue<T>::IsEmpty() const
+{
+    return m_enqueuePos.load(std::memory_order_acquire) == m_dequeuePos;
+}
+
+template <typename T>
+std::size_t
+MpscQueue<T>::GetCapacity() const
+{
+    return m_mask + 1;
+}
+
+} // namespace ns3
+
+#endif /* MPSC_QUEUE_H */
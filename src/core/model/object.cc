@@ -165,16 +165,20 @@ Object::DoGetObject(TypeId tid) const
         }
         if (cur == tid)
         {
+#ifndef NS3_MTP
             // This is an attempt to 'cache' the result of this lookup.
             // the idea is that if we perform a lookup for a TypeId on this object,
             // we are likely to perform the same lookup later so, we make sure
             // that the aggregate array is sorted by the number of accesses
             // to each object.
+            // This is not done with multithreaded parallel simulation support,
+            // since the objects may be looked up from several threads.
 
             // first, increment the access count
             current->m_getObjectCount++;
             // then, update the sort
             UpdateSortedArray(m_aggregates, i);
+#endif
             // finally, return the match
             return const_cast<Object*>(current);
         }
@@ -37,6 +37,9 @@
 #include <algorithm> // upper_bound
 #include <cmath>
 #include <iostream>
+#ifdef NS3_MTP
+#include <mutex>
+#endif
 
 /**
  * \file
@@ -49,6 +52,31 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("RandomVariableStream");
 
+namespace
+{
+
+/** The live RandomVariableStream instances. */
+struct RandomVariableStreamRegistry
+{
+#ifdef NS3_MTP
+    std::mutex mutex; //!< Protects the list of the instances.
+#endif
+    RandomVariableStream* head{nullptr}; //!< The first instance of the list.
+};
+
+/**
+ * Get the registry of the RandomVariableStream instances.
+ * \returns The registry.
+ */
+RandomVariableStreamRegistry&
+GetRegistry()
+{
+    static RandomVariableStreamRegistry registry;
+    return registry;
+}
+
+} // unnamed namespace
+
 NS_OBJECT_ENSURE_REGISTERED(RandomVariableStream);
 
 TypeId
@@ -77,17 +105,62 @@ RandomVariableStream::GetTypeId()
 }
 
 RandomVariableStream::RandomVariableStream()
-    : m_rng(nullptr)
+    : m_rng(nullptr),
+      m_rngIndex(0)
 {
     NS_LOG_FUNCTION(this);
+    RandomVariableStreamRegistry& registry = GetRegistry();
+#ifdef NS3_MTP
+    std::unique_lock lock{registry.mutex};
+#endif
+    m_prevInstance = nullptr;
+    m_nextInstance = registry.head;
+    if (registry.head)
+    {
+        registry.head->m_prevInstance = this;
+    }
+    registry.head = this;
 }
 
 RandomVariableStream::~RandomVariableStream()
 {
     NS_LOG_FUNCTION(this);
+    {
+        RandomVariableStreamRegistry& registry = GetRegistry();
+#ifdef NS3_MTP
+        std::unique_lock lock{registry.mutex};
+#endif
+        if (m_prevInstance)
+        {
+            m_prevInstance->m_nextInstance = m_nextInstance;
+        }
+        else
+        {
+            registry.head = m_nextInstance;
+        }
+        if (m_nextInstance)
+        {
+            m_nextInstance->m_prevInstance = m_prevInstance;
+        }
+    }
     delete m_rng;
 }
 
+std::vector<RandomVariableStream*>
+RandomVariableStream::GetInstances()
+{
+    RandomVariableStreamRegistry& registry = GetRegistry();
+#ifdef NS3_MTP
+    std::unique_lock lock{registry.mutex};
+#endif
+    std::vector<RandomVariableStream*> instances;
+    for (RandomVariableStream* stream = registry.head; stream; stream = stream->m_nextInstance)
+    {
+        instances.push_back(stream);
+    }
+    return instances;
+}
+
 void
 RandomVariableStream::SetAntithetic(bool isAntithetic)
 {
@@ -116,6 +189,7 @@ RandomVariableStream::SetStream(int64_t stream)
         uint64_t nextStream = RngSeedManager::GetNextStreamIndex();
         NS_ASSERT(nextStream <= ((1ULL) << 63));
         m_rng = new RngStream(RngSeedManager::GetSeed(), nextStream, RngSeedManager::GetRun());
+        m_rngIndex = nextStream;
     }
     else
     {
@@ -124,6 +198,7 @@ RandomVariableStream::SetStream(int64_t stream)
         uint64_t base = ((1ULL) << 63);
         uint64_t target = base + stream;
         m_rng = new RngStream(RngSeedManager::GetSeed(), target, RngSeedManager::GetRun());
+        m_rngIndex = target;
     }
     m_stream = stream;
 }
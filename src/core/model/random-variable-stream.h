@@ -30,6 +30,7 @@
 #include "type-id.h"
 
 #include <stdint.h>
+#include <vector>
 
 /**
  * \file
@@ -162,15 +163,38 @@ class RandomVariableStream : public Object
     RngStream* Peek() const;
 
   private:
+    /** Checkpoint saves and restores the state of the RngStreams. */
+    friend class Checkpoint;
+
+    /**
+     * Get the live RandomVariableStream instances.
+     *
+     * The instances link themselves in a process-wide intrusive list, so
+     * that creating and destroying a stream does not allocate memory. With
+     * NS3_MTP, the list is protected by a mutex since streams may be
+     * created and destroyed from several threads.
+     *
+     * \returns A copy of the instances.
+     */
+    static std::vector<RandomVariableStream*> GetInstances();
+
     /** Pointer to the underlying RngStream. */
     RngStream* m_rng;
 
+    /** The index of the underlying RngStream. */
+    uint64_t m_rngIndex;
+
     /** Indicates if antithetic values should be generated by this RNG stream. */
     bool m_isAntithetic;
 
     /** The stream number for the RngStream. */
     int64_t m_stream;
 
+    /** The previous instance in the list of the live instances. */
+    RandomVariableStream* m_prevInstance;
+    /** The next instance in the list of the live instances. */
+    RandomVariableStream* m_nextInstance;
+
 }; // class RandomVariableStream
 
 /**
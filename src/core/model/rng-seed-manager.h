@@ -104,6 +104,19 @@ class RngSeedManager
      * \returns The next stream index.
      */
     static uint64_t GetNextStreamIndex();
+    /**
+     * Set the next automatically assigned stream index.
+     *
+     * This is used to restore a Checkpoint, so that the streams
+     * created afterwards do not reuse the indices of the restored streams.
+     * \param [in] next The next stream index.
+     */
+    static void SetNextStreamIndex(uint64_t next);
+    /**
+     * Get the next automatically assigned stream index, without assigning it.
+     * \returns The next stream index.
+     */
+    static uint64_t PeekNextStreamIndex();
 };
 
 /** Alias for compatibility. */
@@ -71,6 +71,19 @@ class RngStream
      */
     double RandU01();
 
+    /**
+     * Get the state of the generator.
+     *
+     * \param [out] state The state vector.
+     */
+    void GetState(double state[6]) const;
+    /**
+     * Set the state of the generator, as returned by GetState().
+     *
+     * \param [in] state The state vector.
+     */
+    void SetState(const double state[6]);
+
   private:
     /**
      * Advance \pname{state} of the RNG by leaps and bounds.
@@ -20,8 +20,11 @@
 #include "scheduler.h"
 
 #include "assert.h"
+#include "event-impl.h"
 #include "log.h"
 
+#include <vector>
+
 /**
  * \file
  * \ingroup scheduler
@@ -47,4 +50,30 @@ Scheduler::GetTypeId()
     return tid;
 }
 
+uint32_t
+Scheduler::RemoveCancelled()
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<Event> live;
+    uint32_t cancelled = 0;
+    while (!IsEmpty())
+    {
+        Event ev = RemoveNext();
+        if (ev.impl->IsCancelled())
+        {
+            ev.impl->Unref();
+            cancelled++;
+        }
+        else
+        {
+            live.push_back(ev);
+        }
+    }
+    for (const auto& ev : live)
+    {
+        Insert(ev);
+    }
+    return cancelled;
+}
+
 } // namespace ns3
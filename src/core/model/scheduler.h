@@ -103,6 +103,14 @@ class EventImpl;
  *      <td class="markdownTableBodyLeft"> 16 bytes </td>
  * </tr>
  * <tr class="markdownTableBody">
+ *      <td class="markdownTableBodyLeft"> DaryHeapScheduler </td>
+ *      <td class="markdownTableBodyLeft"> d-ary heap on `std::vector` </td>
+ *      <td class="markdownTableBodyLeft"> Logarithmic  </td>
+ *      <td class="markdownTableBodyLeft"> Logarithmic </td>
+ *      <td class="markdownTableBodyLeft"> 24 bytes </td>
+ *      <td class="markdownTableBodyLeft"> 0 </td>
+ * </tr>
+ * <tr class="markdownTableBody">
  *      <td class="markdownTableBodyLeft"> HeapScheduler </td>
  *      <td class="markdownTableBodyLeft"> Heap on `std::vector` </td>
  *      <td class="markdownTableBodyLeft"> Logarithmic  </td>
@@ -226,6 +234,21 @@ class Scheduler : public Object
      * \param [in] ev The event to remove
      */
     virtual void Remove(const Event& ev) = 0;
+    /**
+     * Remove all the cancelled events from the event list.
+     *
+     * Cancelled events are normally left in the event list until they
+     * reach its head. Simulators call this method to reclaim them in
+     * bulk when they make up a large part of the list. The events removed
+     * are released with EventImpl::Unref().
+     *
+     * The default implementation empties the event list with RemoveNext()
+     * and inserts the live events back; subclasses which can filter their
+     * storage in place override it.
+     *
+     * \returns The number of cancelled events removed.
+     */
+    virtual uint32_t RemoveCancelled();
 };
 
 /**
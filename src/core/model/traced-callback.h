@@ -92,6 +92,20 @@ class TracedCallback
     void operator()(Ts... args) const;
     /**
      * \brief Checks if the Callbacks list is empty.
+     *
+     * Invoking a TracedCallback with no Callback connected does nothing,
+     * but the caller still builds its arguments: the calls which copy a
+     * packet or add a header for the trace, or convert pointers to Ptr,
+     * should be guarded with this check on the hot paths:
+     * \code
+     *   if (!m_txTrace.IsEmpty())
+     *   {
+     *       Ptr<Packet> copy = packet->Copy();
+     *       copy->AddHeader(header);
+     *       m_txTrace(copy);
+     *   }
+     * \endcode
+     *
      * \return true if the Callbacks list is empty.
      */
     bool IsEmpty() const;
@@ -19,6 +19,7 @@
 #include "ns3/test.h"
 
 #include <stdint.h>
+#include <string>
 
 using namespace ns3;
 
@@ -931,6 +932,140 @@ CallbackEqualityTestCase::DoRun()
     //
     Callback<double> target9d = target8b.Bind(4);
     NS_TEST_ASSERT_MSG_EQ(target9d.IsEqual(target9c), false, "Equality test failed");
+
+    //
+    // Make sure that binding arguments one at a time or all at once builds
+    // callbacks which compare equal.
+    //
+    Callback<int> target10a(&CallbackEqualityTestCase::TargetMember, this, 1.5, 2);
+    Callback<int> target10b = target1a.Bind(1.5).Bind(2);
+    NS_TEST_ASSERT_MSG_EQ(target10a.IsEqual(target10b), true, "Equality test failed");
+    NS_TEST_ASSERT_MSG_EQ(target10b.IsEqual(target10a), true, "Equality test failed");
+    NS_TEST_ASSERT_MSG_EQ(target10a.IsEqual(target3c), false, "Equality test failed");
+}
+
+/**
+ * \ingroup callback-tests
+ *
+ * Reference counted class used to test callbacks bound to a Ptr.
+ */
+class CallbackInvocationTarget : public SimpleRefCount<CallbackInvocationTarget>
+{
+  public:
+    /**
+     * Callback target function.
+     *
+     * \param a the value to add
+     */
+    void Add(int a)
+    {
+        m_sum += a;
+    }
+
+    int m_sum{0}; //!< Sum of the values added.
+};
+
+/**
+ * Non-member function used to test bound arguments.
+ *
+ * \param result the string to append to
+ * \param value the string to append
+ */
+void
+CallbackInvocationAppend(std::string* result, std::string value)
+{
+    *result += value;
+}
+
+/**
+ * \ingroup callback-tests
+ *
+ * Test the invocation of the callable objects.
+ */
+class CallbackInvocationTestCase : public TestCase
+{
+  public:
+    CallbackInvocationTestCase();
+
+    ~CallbackInvocationTestCase() override
+    {
+    }
+
+    /**
+     * Callback target function returning a value.
+     *
+     * \param a first argument
+     * \return the argument
+     */
+    int Target(int a)
+    {
+        m_value = a;
+        return a;
+    }
+
+  private:
+    void DoRun() override;
+    void DoSetup() override;
+
+    int m_value; //!< Argument of the last call to Target.
+};
+
+CallbackInvocationTestCase::CallbackInvocationTestCase()
+    : TestCase("Check the invocation of the callable objects")
+{
+}
+
+void
+CallbackInvocationTestCase::DoSetup()
+{
+    m_value = 0;
+}
+
+void
+CallbackInvocationTestCase::DoRun()
+{
+    //
+    // Make sure that a callback returning void can wrap a member function
+    // returning a value.
+    //
+    Callback<void, int> target1 = MakeCallback(&CallbackInvocationTestCase::Target, this);
+    target1(5);
+    NS_TEST_ASSERT_MSG_EQ(m_value, 5, "Callback did not fire");
+
+    //
+    // Make sure that a mutable lambda keeps its state across calls, and that
+    // the copies of a callback share it.
+    //
+    Callback<int> counter([count = 0]() mutable { return ++count; });
+    Callback<int> copy = counter;
+    NS_TEST_ASSERT_MSG_EQ(counter(), 1, "Wrong first call");
+    NS_TEST_ASSERT_MSG_EQ(copy(), 2, "Copy does not share the state");
+
+    //
+    // Make sure that a member function can be called through a bound Ptr.
+    //
+    Ptr<CallbackInvocationTarget> object = Create<CallbackInvocationTarget>();
+    Callback<void, int> target2 = MakeCallback(&CallbackInvocationTarget::Add, object);
+    target2(2);
+    target2(3);
+    NS_TEST_ASSERT_MSG_EQ(object->m_sum, 5, "Callback to a Ptr did not fire");
+
+    //
+    // Make sure that bound arguments are not consumed by the first call.
+    //
+    std::string result;
+    Callback<void> target3 = MakeBoundCallback(&CallbackInvocationAppend, &result, "ab");
+    target3();
+    target3();
+    NS_TEST_ASSERT_MSG_EQ(result, "abab", "Bound arguments were consumed");
+
+    //
+    // Make sure that a bound argument can be taken by non-const reference,
+    // and keeps its value across calls, as with a mutable lambda.
+    //
+    Callback<int, int> target4([](int& sum, int a) { return sum += a; }, 10);
+    target4(1);
+    NS_TEST_ASSERT_MSG_EQ(target4(2), 13, "Bound argument not passed by reference");
 }
 
 /**
@@ -1196,6 +1331,7 @@ CallbackTestSuite::CallbackTestSuite()
     AddTestCase(new MakeCallbackTestCase, TestCase::QUICK);
     AddTestCase(new MakeBoundCallbackTestCase, TestCase::QUICK);
     AddTestCase(new CallbackEqualityTestCase, TestCase::QUICK);
+    AddTestCase(new CallbackInvocationTestCase, TestCase::QUICK);
     AddTestCase(new NullifyCallbackTestCase, TestCase::QUICK);
     AddTestCase(new MakeCallbackTemplatesTestCase, TestCase::QUICK);
 }
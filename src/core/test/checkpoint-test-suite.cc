@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/checkpoint.h"
+#include "ns3/config.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <sstream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * Checkpoint test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup checkpoint-tests Checkpoint tests
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup checkpoint-tests
+ * Object of the checkpoint tests, whose state is held in its attributes.
+ */
+class CheckpointTestObject : public Object
+{
+  public:
+    /**
+     * Register this type.
+     * \return The object TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid =
+            TypeId("ns3::tests::CheckpointTestObject")
+                .SetParent<Object>()
+                .HideFromDocumentation()
+                .AddConstructor<CheckpointTestObject>()
+                .AddAttribute("Total",
+                              "The sum of the random values drawn.",
+                              UintegerValue(0),
+                              MakeUintegerAccessor(&CheckpointTestObject::m_total),
+                              MakeUintegerChecker<uint32_t>())
+                .AddAttribute("Random",
+                              "The random variable.",
+                              PointerValue(),
+                              MakePointerAccessor(&CheckpointTestObject::m_random),
+                              MakePointerChecker<RandomVariableStream>());
+        return tid;
+    }
+
+    /**
+     * Draw a random value, and add it to the total.
+     * \returns The value.
+     */
+    uint32_t Draw()
+    {
+        uint32_t value = m_random->GetInteger();
+        m_total += value;
+        return value;
+    }
+
+    /**
+     * Get the sum of the random values drawn.
+     * \returns The sum.
+     */
+    uint32_t GetTotal() const
+    {
+        return m_total;
+    }
+
+  private:
+    uint32_t m_total;                   //!< The sum of the random values drawn.
+    Ptr<RandomVariableStream> m_random; //!< The random variable.
+};
+
+/**
+ * \ingroup checkpoint-tests
+ * Root namespace object of the checkpoint tests.
+ */
+class CheckpointTestRoot : public Object
+{
+  public:
+    /**
+     * Register this type.
+     * \return The object TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid =
+            TypeId("ns3::tests::CheckpointTestRoot")
+                .SetParent<Object>()
+                .HideFromDocumentation()
+                .AddConstructor<CheckpointTestRoot>()
+                .AddAttribute("Object",
+                              "The object of the test.",
+                              PointerValue(),
+                              MakePointerAccessor(&CheckpointTestRoot::m_object),
+                              MakePointerChecker<CheckpointTestObject>());
+        return tid;
+    }
+
+  private:
+    Ptr<CheckpointTestObject> m_object; //!< The object of the test.
+};
+
+/**
+ * \ingroup checkpoint-tests
+ * A periodic event which can be saved in a checkpoint.
+ */
+class CheckpointTestEvent : public CheckpointEvent
+{
+  public:
+    /** A record of the execution of an event. */
+    struct Record
+    {
+        int64_t ts;     //!< The time of the event.
+        uint32_t count; //!< The count of the event.
+        uint32_t value; //!< The random value drawn.
+        uint32_t total; //!< The total after the event.
+    };
+
+    /**
+     * Constructor.
+     * \param [in] count The number of events before this one.
+     */
+    CheckpointTestEvent(uint32_t count)
+        : m_count(count)
+    {
+    }
+
+    /**
+     * Get the name of this event type.
+     * \returns The name.
+     */
+    static std::string GetName()
+    {
+        return "ns3::tests::CheckpointTestEvent";
+    }
+
+    /**
+     * Read an event.
+     * \param [in] is The input stream.
+     * \returns The event.
+     */
+    static Ptr<CheckpointTestEvent> Deserialize(std::istream& is)
+    {
+        uint32_t count;
+        is >> count;
+        return is ? Create<CheckpointTestEvent>(count) : nullptr;
+    }
+
+    std::string GetCheckpointName() const override
+    {
+        return GetName();
+    }
+
+    void Serialize(std::ostream& os) const override
+    {
+        os << m_count;
+    }
+
+    static Ptr<CheckpointTestObject> g_object; //!< The object the events draw with.
+    static std::vector<Record> g_records;      //!< The executed events.
+
+  private:
+    void Notify() override
+    {
+        uint32_t value = g_object->Draw();
+        g_records.push_back({Simulator::Now().GetTimeStep(), m_count, value, g_object->GetTotal()});
+        Simulator::Schedule(Seconds(1), Ptr<EventImpl>(Create<CheckpointTestEvent>(m_count + 1)));
+    }
+
+    uint32_t m_count; //!< The number of events before this one.
+};
+
+Ptr<CheckpointTestObject> CheckpointTestEvent::g_object;
+std::vector<CheckpointTestEvent::Record> CheckpointTestEvent::g_records;
+
+NS_CHECKPOINT_EVENT_REGISTER(CheckpointTestEvent);
+
+/**
+ * \ingroup checkpoint-tests
+ * Check that a simulation restored from a checkpoint continues
+ * like the uninterrupted simulation.
+ */
+class CheckpointTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    CheckpointTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Build the scenario: create the objects.
+     * \param [in] firstStream The first automatically assigned stream index.
+     */
+    void Build(uint64_t firstStream);
+    /** Tear down the scenario. */
+    void TearDown();
+
+    Ptr<CheckpointTestRoot> m_root; //!< The root namespace object.
+
+    /** An event which cannot be saved. */
+    void Noop()
+    {
+    }
+};
+
+CheckpointTestCase::CheckpointTestCase()
+    : TestCase("Check the restoration of a checkpoint")
+{
+}
+
+void
+CheckpointTestCase::Build(uint64_t firstStream)
+{
+    // Create the streams with the same indices, as a new process would.
+    RngSeedManager::SetNextStreamIndex(firstStream);
+    Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+    random->SetAttribute("Min", DoubleValue(0));
+    random->SetAttribute("Max", DoubleValue(1000));
+    CheckpointTestEvent::g_object = CreateObject<CheckpointTestObject>();
+    CheckpointTestEvent::g_object->SetAttribute("Random", PointerValue(random));
+    m_root = CreateObject<CheckpointTestRoot>();
+    m_root->SetAttribute("Object", PointerValue(CheckpointTestEvent::g_object));
+    Config::RegisterRootNamespaceObject(m_root);
+    CheckpointTestEvent::g_records.clear();
+}
+
+void
+CheckpointTestCase::TearDown()
+{
+    Simulator::Destroy();
+    Config::UnregisterRootNamespaceObject(m_root);
+    m_root = nullptr;
+    CheckpointTestEvent::g_object = nullptr;
+}
+
+void
+CheckpointTestCase::DoRun()
+{
+    Simulator::Destroy();
+    uint64_t firstStream = RngSeedManager::PeekNextStreamIndex();
+
+    // The uninterrupted simulation
+    Build(firstStream);
+    Simulator::Schedule(MilliSeconds(500), Ptr<EventImpl>(Create<CheckpointTestEvent>(0)));
+    Simulator::Stop(Seconds(20));
+    Simulator::Run();
+    auto reference = CheckpointTestEvent::g_records;
+    TearDown();
+    NS_TEST_ASSERT_MSG_EQ(reference.size(), 20, "Wrong number of events");
+
+    // The simulation up to the checkpoint
+    Build(firstStream);
+    Simulator::Schedule(MilliSeconds(500), Ptr<EventImpl>(Create<CheckpointTestEvent>(0)));
+    Simulator::Schedule(Seconds(15), &CheckpointTestCase::Noop, this);
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+    auto records = CheckpointTestEvent::g_records;
+    std::stringstream checkpoint;
+    uint32_t dropped = Checkpoint::Save(checkpoint);
+    NS_TEST_EXPECT_MSG_EQ(dropped, 1, "Only the Noop event should have been dropped");
+    TearDown();
+
+    // The restored simulation, whose setup events are moved to the checkpoint time
+    Build(firstStream);
+    Simulator::Schedule(Seconds(0), &CheckpointTestCase::Noop, this);
+    Checkpoint::Restore(checkpoint);
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), Seconds(10), "Time not restored");
+    NS_TEST_EXPECT_MSG_EQ(CheckpointTestEvent::g_object->GetTotal(),
+                          records.back().total,
+                          "Attribute not restored");
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+    records.insert(records.end(),
+                   CheckpointTestEvent::g_records.begin(),
+                   CheckpointTestEvent::g_records.end());
+    TearDown();
+
+    NS_TEST_ASSERT_MSG_EQ(records.size(), reference.size(), "Wrong number of events");
+    for (std::size_t i = 0; i < records.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(records[i].ts, reference[i].ts, "Wrong time of event " << i);
+        NS_TEST_EXPECT_MSG_EQ(records[i].count, reference[i].count, "Wrong count of event " << i);
+        NS_TEST_EXPECT_MSG_EQ(records[i].value, reference[i].value, "Wrong value of event " << i);
+        NS_TEST_EXPECT_MSG_EQ(records[i].total, reference[i].total, "Wrong total of event " << i);
+    }
+}
+
+/**
+ * \ingroup checkpoint-tests
+ * Checkpoint test suite.
+ */
+class CheckpointTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    CheckpointTestSuite()
+        : TestSuite("checkpoint")
+    {
+        AddTestCase(new CheckpointTestCase());
+    }
+};
+
+/**
+ * \ingroup checkpoint-tests
+ * CheckpointTestSuite instance variable.
+ */
+static CheckpointTestSuite g_checkpointTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/config.h"
+#include "ns3/event-impl.h"
+#include "ns3/event-profiler.h"
+#include "ns3/make-event.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <fstream>
+#include <sstream>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * EventProfiler test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup event-profiler-tests EventProfiler tests
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup event-profiler-tests
+ * Check the aggregation, scaling and sorting of the EventProfiler.
+ */
+class EventProfilerTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    EventProfilerTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** First handler. */
+    void Rx()
+    {
+    }
+
+    /** Third handler, with the same signature as the first one. */
+    void Drop()
+    {
+    }
+
+    /**
+     * Second handler.
+     * \param value Unused.
+     */
+    void Tx(uint32_t value)
+    {
+    }
+};
+
+EventProfilerTestCase::EventProfilerTestCase()
+    : TestCase("Check the EventProfiler entries")
+{
+}
+
+void
+EventProfilerTestCase::DoRun()
+{
+    EventImpl* rx = MakeEvent(&EventProfilerTestCase::Rx, this);
+    EventImpl* tx = MakeEvent(&EventProfilerTestCase::Tx, this, 1);
+    EventImpl* drop = MakeEvent(&EventProfilerTestCase::Drop, this);
+    EventProfilerTestCase other;
+    EventImpl* otherRx = MakeEvent(&EventProfilerTestCase::Rx, &other);
+    using std::chrono::microseconds;
+
+    EventProfiler profiler(3);
+    NS_TEST_EXPECT_MSG_EQ(profiler.GetInterval(), 3, "Wrong interval");
+    uint32_t samples = 0;
+    for (uint32_t i = 0; i < 30; i++)
+    {
+        samples += profiler.Sample() ? 1 : 0;
+    }
+    NS_TEST_EXPECT_MSG_EQ(samples, 10, "Wrong number of samples");
+
+    profiler.Record(*rx, 1, microseconds(10));
+    profiler.Record(*rx, 2, microseconds(35));
+    profiler.Record(*tx, 1, microseconds(25));
+    profiler.Record(*tx, 1, microseconds(5));
+    profiler.Record(*tx, 2, microseconds(1));
+    profiler.Record(*drop, 1, microseconds(7));
+    profiler.Record(*otherRx, 1, microseconds(2));
+
+    auto handlers = profiler.GetHandlerEntries();
+    NS_TEST_ASSERT_MSG_EQ(handlers.size(), 3, "Wrong number of handlers");
+    // rx: 47 us, tx: 31 us, drop: 7 us, times the interval
+    NS_TEST_EXPECT_MSG_EQ((handlers[0].handler.find("Rx") != std::string::npos ||
+                           handlers[0].handler.find("EventProfilerTestCase") != std::string::npos),
+                          true,
+                          "Unexpected handler name " << handlers[0].handler);
+    NS_TEST_EXPECT_MSG_NE(handlers[0].handler,
+                          handlers[1].handler,
+                          "Handlers should have different names");
+    NS_TEST_EXPECT_MSG_NE(handlers[0].handler,
+                          handlers[2].handler,
+                          "Handlers with the same signature should have different names");
+    NS_TEST_EXPECT_MSG_EQ(handlers[0].count, 3 * 3, "Wrong count of the first handler");
+    NS_TEST_EXPECT_MSG_EQ((handlers[0].total == microseconds(47 * 3)),
+                          true,
+                          "Wrong time of the first handler");
+    NS_TEST_EXPECT_MSG_EQ((handlers[0].max == microseconds(35)),
+                          true,
+                          "Wrong maximum of the first handler");
+    NS_TEST_EXPECT_MSG_EQ(handlers[1].count, 3 * 3, "Wrong count of the second handler");
+    NS_TEST_EXPECT_MSG_EQ((handlers[1].total == microseconds(31 * 3)),
+                          true,
+                          "Wrong time of the second handler");
+    NS_TEST_EXPECT_MSG_EQ(handlers[2].count, 1 * 3, "Wrong count of the third handler");
+
+    // rx on this in context 2: 35 us, tx in context 1: 30 us, rx on this
+    // in context 1: 10 us, drop: 7 us, rx on other: 2 us, tx in context 2
+    auto contexts = profiler.GetContextEntries();
+    NS_TEST_ASSERT_MSG_EQ(contexts.size(), 6, "Wrong number of entries by context");
+    NS_TEST_EXPECT_MSG_EQ(contexts[0].context, 2, "Wrong context of the first entry");
+    NS_TEST_EXPECT_MSG_EQ(contexts[0].object, this, "Wrong object of the first entry");
+    NS_TEST_EXPECT_MSG_EQ(contexts[2].handler, handlers[0].handler, "Wrong third entry");
+    NS_TEST_EXPECT_MSG_EQ(contexts[2].context, 1, "Wrong context of the third entry");
+    NS_TEST_EXPECT_MSG_EQ(contexts[4].handler, handlers[0].handler, "Wrong fifth entry");
+    NS_TEST_EXPECT_MSG_EQ(contexts[4].object, &other, "Wrong object of the fifth entry");
+    NS_TEST_EXPECT_MSG_EQ(contexts[4].count, 1 * 3, "Wrong count of the fifth entry");
+    for (const auto& entry : contexts)
+    {
+        if (entry.handler == handlers[1].handler && entry.context == 1)
+        {
+            NS_TEST_EXPECT_MSG_EQ(entry.count, 2 * 3, "Wrong count of tx in context 1");
+        }
+    }
+
+    std::ostringstream report;
+    profiler.Report(report, 3);
+    NS_TEST_EXPECT_MSG_NE(report.str().find("21 events"),
+                          std::string::npos,
+                          "Wrong total in the report:\n"
+                              << report.str());
+    NS_TEST_EXPECT_MSG_NE(report.str().find("top 3 of 6"),
+                          std::string::npos,
+                          "Entries by context not truncated:\n"
+                              << report.str());
+
+    profiler.Clear();
+    NS_TEST_EXPECT_MSG_EQ(profiler.GetHandlerEntries().size(), 0, "Profile not cleared");
+
+    rx->Unref();
+    tx->Unref();
+    drop->Unref();
+    otherRx->Unref();
+}
+
+/**
+ * \ingroup event-profiler-tests
+ * Check the profiling of the DefaultSimulatorImpl.
+ */
+class SimulatorProfileTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    SimulatorProfileTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** Event handler. */
+    void Handler()
+    {
+    }
+};
+
+SimulatorProfileTestCase::SimulatorProfileTestCase()
+    : TestCase("Check the event profile of the DefaultSimulatorImpl")
+{
+}
+
+void
+SimulatorProfileTestCase::DoRun()
+{
+    std::string filename = CreateTempDirFilename("event-profile.txt");
+    Simulator::Destroy();
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileInterval", UintegerValue(1));
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileFile", StringValue(filename));
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        Simulator::ScheduleWithContext(i % 2, Seconds(i), &SimulatorProfileTestCase::Handler, this);
+    }
+    // Cancelled events are not profiled
+    EventId cancelled = Simulator::Schedule(Seconds(1), &SimulatorProfileTestCase::Handler, this);
+    cancelled.Cancel();
+    Simulator::Run();
+    Simulator::Destroy();
+
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileInterval", UintegerValue(0));
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileFile", StringValue(""));
+
+    std::ifstream file(filename);
+    NS_TEST_ASSERT_MSG_EQ(file.is_open(), true, "No event profile was written");
+    std::stringstream report;
+    report << file.rdbuf();
+    NS_TEST_EXPECT_MSG_NE(report.str().find("Event profile: 10 events"),
+                          std::string::npos,
+                          "Wrong event count in the report:\n"
+                              << report.str());
+    NS_TEST_EXPECT_MSG_NE(report.str().find("SimulatorProfileTestCase"),
+                          std::string::npos,
+                          "Handler missing in the report:\n"
+                              << report.str());
+}
+
+/**
+ * \ingroup event-profiler-tests
+ * EventProfiler test suite.
+ */
+class EventProfilerTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    EventProfilerTestSuite()
+        : TestSuite("event-profiler")
+    {
+        AddTestCase(new EventProfilerTestCase());
+        AddTestCase(new SimulatorProfileTestCase());
+    }
+};
+
+/**
+ * \ingroup event-profiler-tests
+ * EventProfilerTestSuite instance variable.
+ */
+static EventProfilerTestSuite g_eventProfilerTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/mpsc-queue.h"
+#include "ns3/test.h"
+
+#include <thread>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * MpscQueue test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup mpsc-queue-tests MpscQueue tests
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup mpsc-queue-tests
+ * Check the MpscQueue from a single thread: capacity and ordering.
+ */
+class MpscQueueSingleThreadTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    MpscQueueSingleThreadTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+MpscQueueSingleThreadTestCase::MpscQueueSingleThreadTestCase()
+    : TestCase("Check MpscQueue capacity and ordering from a single thread")
+{
+}
+
+void
+MpscQueueSingleThreadTestCase::DoRun()
+{
+    MpscQueue<uint32_t> queue(4);
+    NS_TEST_EXPECT_MSG_EQ(queue.GetCapacity(), 4, "Wrong capacity");
+    NS_TEST_EXPECT_MSG_EQ(queue.IsEmpty(), true, "New queue should be empty");
+
+    uint32_t value;
+    NS_TEST_EXPECT_MSG_EQ(queue.TryPop(value), false, "Popped from an empty queue");
+
+    uint32_t pushed = 0;
+    uint32_t popped = 0;
+    // Several laps of the ring
+    for (uint32_t lap = 0; lap < 5; lap++)
+    {
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(queue.TryPush(pushed), true, "Push failed");
+            pushed++;
+        }
+        NS_TEST_EXPECT_MSG_EQ(queue.TryPush(pushed), false, "Pushed into a full queue");
+        NS_TEST_EXPECT_MSG_EQ(queue.IsEmpty(), false, "Full queue reported empty");
+
+        // Pop less than was pushed, so the next lap starts mid-ring
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(queue.TryPop(value), true, "Pop failed");
+            NS_TEST_EXPECT_MSG_EQ(value, popped, "Values popped out of order");
+            popped++;
+        }
+        NS_TEST_EXPECT_MSG_EQ(queue.TryPush(pushed), true, "Push failed");
+        pushed++;
+        while (queue.TryPop(value))
+        {
+            NS_TEST_EXPECT_MSG_EQ(value, popped, "Values popped out of order");
+            popped++;
+        }
+        NS_TEST_EXPECT_MSG_EQ(popped, pushed, "Values lost");
+        NS_TEST_EXPECT_MSG_EQ(queue.IsEmpty(), true, "Drained queue should be empty");
+    }
+}
+
+/**
+ * \ingroup mpsc-queue-tests
+ * Check the MpscQueue with concurrent producers.
+ */
+class MpscQueueMultiThreadTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    MpscQueueMultiThreadTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** Number of producer threads. */
+    static const uint32_t PRODUCERS = 4;
+    /** Number of values pushed by each producer. */
+    static const uint32_t COUNT = 100000;
+};
+
+MpscQueueMultiThreadTestCase::MpscQueueMultiThreadTestCase()
+    : TestCase("Check MpscQueue ordering and completeness with concurrent producers")
+{
+}
+
+void
+MpscQueueMultiThreadTestCase::DoRun()
+{
+    // A small queue, so that producers often find it full
+    MpscQueue<uint64_t> queue(64);
+
+    std::vector<std::thread> producers;
+    for (uint64_t producer = 0; producer < PRODUCERS; producer++)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (uint64_t i = 0; i < COUNT; i++)
+            {
+                while (!queue.TryPush((producer << 32) | i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint64_t> next(PRODUCERS, 0);
+    uint64_t received = 0;
+    bool ordered = true;
+    while (received < PRODUCERS * COUNT)
+    {
+        uint64_t value;
+        if (!queue.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        received++;
+        uint64_t producer = value >> 32;
+        uint64_t i = value & 0xffffffff;
+        if (producer >= PRODUCERS)
+        {
+            ordered = false;
+            continue;
+        }
+        // keep draining on error, so that no producer blocks forever
+        ordered &= (next[producer] == i);
+        next[producer] = i + 1;
+    }
+
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+
+    NS_TEST_EXPECT_MSG_EQ(ordered, true, "Values of a producer popped out of order");
+    NS_TEST_EXPECT_MSG_EQ(received, PRODUCERS * COUNT, "Values lost");
+    NS_TEST_EXPECT_MSG_EQ(queue.IsEmpty(), true, "Drained queue should be empty");
+}
+
+/**
+ * \ingroup mpsc-queue-tests
+ * MpscQueue test suite.
+ */
+class MpscQueueTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    MpscQueueTestSuite()
+        : TestSuite("mpsc-queue")
+    {
+        AddTestCase(new MpscQueueSingleThreadTestCase());
+        AddTestCase(new MpscQueueMultiThreadTestCase());
+    }
+};
+
+/**
+ * \ingroup mpsc-queue-tests
+ * MpscQueueTestSuite instance variable.
+ */
+static MpscQueueTestSuite g_mpscQueueTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -17,12 +17,19 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 #include "ns3/calendar-scheduler.h"
+#include "ns3/dary-heap-scheduler.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/event-impl-pool.h"
 #include "ns3/heap-scheduler.h"
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <vector>
 
 using namespace ns3;
 
@@ -717,6 +724,249 @@ SimulatorTemplateTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that a Scheduler returns events in order, after many removals.
+ */
+class SchedulerOrderingTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * \param schedulerFactory Scheduler factory.
+     * \param description Description of the scheduler configuration.
+     */
+    SchedulerOrderingTestCase(ObjectFactory schedulerFactory, std::string description);
+
+  private:
+    void DoRun() override;
+
+    ObjectFactory m_schedulerFactory; //!< Scheduler factory.
+};
+
+SchedulerOrderingTestCase::SchedulerOrderingTestCase(ObjectFactory schedulerFactory,
+                                                     std::string description)
+    : TestCase("Check event ordering and removal with " + description),
+      m_schedulerFactory(schedulerFactory)
+{
+}
+
+void
+SchedulerOrderingTestCase::DoRun()
+{
+    Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler>();
+    const uint32_t n = 2000;
+
+    // Pseudo-random timestamps, with many duplicates to exercise the uid tie-break.
+    std::vector<Scheduler::Event> events;
+    uint64_t ts = 12345;
+    for (uint32_t uid = 0; uid < n; uid++)
+    {
+        ts = (ts * 6364136223846793005ULL + 1442695040888963407ULL);
+        Scheduler::Event ev;
+        ev.impl = nullptr;
+        ev.key.m_ts = (ts >> 33) % 500;
+        ev.key.m_uid = uid + EventId::UID::VALID;
+        ev.key.m_context = 0;
+        events.push_back(ev);
+        scheduler->Insert(ev);
+    }
+
+    // Remove two thirds of the events, including the earliest ones.
+    std::vector<Scheduler::Event> sorted = events;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<Scheduler::Event> expected;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (i % 3 != 2)
+        {
+            scheduler->Remove(sorted[i]);
+        }
+        else
+        {
+            expected.push_back(sorted[i]);
+        }
+    }
+
+    for (const auto& ev : expected)
+    {
+        NS_TEST_ASSERT_MSG_EQ(scheduler->IsEmpty(), false, "Scheduler is empty too early");
+        Scheduler::Event next = scheduler->PeekNext();
+        NS_TEST_EXPECT_MSG_EQ(next.key.m_uid, ev.key.m_uid, "PeekNext returned the wrong event");
+        next = scheduler->RemoveNext();
+        NS_TEST_EXPECT_MSG_EQ(next.key.m_uid, ev.key.m_uid, "RemoveNext returned the wrong event");
+        NS_TEST_EXPECT_MSG_EQ(next.key.m_ts, ev.key.m_ts, "RemoveNext returned the wrong time");
+    }
+    NS_TEST_EXPECT_MSG_EQ(scheduler->IsEmpty(), true, "Scheduler should be empty");
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that cancelled events are counted and removed from the event list.
+ */
+class SimulatorCancelledEventsTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * \param schedulerFactory Scheduler factory.
+     */
+    SimulatorCancelledEventsTestCase(ObjectFactory schedulerFactory);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Test Event.
+     * \param value Event parameter.
+     */
+    void Event(uint32_t value);
+
+    ObjectFactory m_schedulerFactory; //!< Scheduler factory.
+    uint32_t m_count;                 //!< Number of events run.
+    bool m_live;                      //!< Whether only live events ran.
+    Time m_last;                      //!< Time of the last event.
+};
+
+SimulatorCancelledEventsTestCase::SimulatorCancelledEventsTestCase(ObjectFactory schedulerFactory)
+    : TestCase("Check the removal of cancelled events with " +
+               schedulerFactory.GetTypeId().GetName()),
+      m_schedulerFactory(schedulerFactory)
+{
+}
+
+void
+SimulatorCancelledEventsTestCase::Event(uint32_t value)
+{
+    m_count++;
+    m_live &= (value % 4 == 0);
+    m_live &= (Simulator::Now() >= m_last);
+    m_last = Simulator::Now();
+}
+
+void
+SimulatorCancelledEventsTestCase::DoRun()
+{
+    m_count = 0;
+    m_live = true;
+    m_last = Seconds(0);
+    Simulator::SetScheduler(m_schedulerFactory);
+    auto impl = DynamicCast<DefaultSimulatorImpl>(Simulator::GetImplementation());
+    if (!impl)
+    {
+        Simulator::Destroy();
+        return;
+    }
+
+    const uint32_t n = 4000;
+    std::vector<EventId> ids;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        ids.push_back(Simulator::Schedule(MicroSeconds((i * 7919) % 1009),
+                                          &SimulatorCancelledEventsTestCase::Event,
+                                          this,
+                                          i));
+    }
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLiveEventCount(), n, "Wrong number of live events");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetCancelledEventCount(), 0, "Wrong number of cancelled events");
+
+    // Cancel three events out of four; with the default threshold of one
+    // half, the event list is compacted at the 2001st cancellation.
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (i % 4 != 0)
+        {
+            Simulator::Cancel(ids[i]);
+            // Cancelling twice must not count twice
+            Simulator::Cancel(ids[i]);
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLiveEventCount(), n / 4, "Wrong number of live events");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetCancelledEventCount(),
+                          3 * n / 4 - 2001,
+                          "Cancelled events were not removed");
+    NS_TEST_EXPECT_MSG_EQ(Simulator::IsExpired(ids[1]), true, "Cancelled event not expired");
+
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_count, n / 4, "Wrong number of events run");
+    NS_TEST_EXPECT_MSG_EQ(m_live, true, "Events ran cancelled or out of order");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLiveEventCount(), 0, "Events left after Run");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetCancelledEventCount(), 0, "Cancelled events left after Run");
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that events are recycled through the EventImplPool.
+ */
+class SimulatorEventPoolTestCase : public TestCase
+{
+  public:
+    SimulatorEventPoolTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Schedule and run a batch of events.
+     */
+    void RunBatch();
+
+    /**
+     * Test Event.
+     * \param value Event parameter.
+     */
+    void Event(uint64_t value);
+
+    uint64_t m_sum; //!< Sum of the event parameters.
+};
+
+SimulatorEventPoolTestCase::SimulatorEventPoolTestCase()
+    : TestCase("Check that events are recycled through the EventImplPool")
+{
+}
+
+void
+SimulatorEventPoolTestCase::Event(uint64_t value)
+{
+    m_sum += value;
+}
+
+void
+SimulatorEventPoolTestCase::RunBatch()
+{
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        Simulator::Schedule(MicroSeconds(i % 10), &SimulatorEventPoolTestCase::Event, this, i);
+    }
+    Simulator::Run();
+}
+
+void
+SimulatorEventPoolTestCase::DoRun()
+{
+    m_sum = 0;
+
+    // warm up the pool
+    RunBatch();
+    NS_TEST_EXPECT_MSG_EQ(m_sum, 499500, "Not all events ran");
+
+    EventImplPool::ResetStatistics();
+    RunBatch();
+    EventImplPool::Statistics stats = EventImplPool::GetStatistics();
+    NS_TEST_EXPECT_MSG_EQ(m_sum, 2 * 499500, "Not all events ran");
+    NS_TEST_EXPECT_MSG_EQ(stats.misses, 0, "Events were not recycled");
+    NS_TEST_EXPECT_MSG_EQ(stats.oversize, 0, "Events should fit in a size class");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(stats.hits, 1000, "Events were not allocated from the pool");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(stats.frees, 1000, "Events were not returned to the pool");
+    NS_TEST_EXPECT_MSG_GT(EventImplPool::GetReservedBytes(), 0, "No slab was allocated");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup simulator-tests
  *
@@ -740,6 +990,38 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
+        factory.SetTypeId(DaryHeapScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
+
+        std::string schedulerTypes[] = {
+            "ns3::ListScheduler",
+            "ns3::MapScheduler",
+            "ns3::HeapScheduler",
+            "ns3::CalendarScheduler",
+            "ns3::PriorityQueueScheduler",
+        };
+        for (auto& schedulerType : schedulerTypes)
+        {
+            factory = ObjectFactory(schedulerType);
+            AddTestCase(new SchedulerOrderingTestCase(factory, schedulerType), TestCase::QUICK);
+        }
+        for (auto& schedulerType : schedulerTypes)
+        {
+            factory = ObjectFactory(schedulerType);
+            AddTestCase(new SimulatorCancelledEventsTestCase(factory), TestCase::QUICK);
+        }
+        factory = ObjectFactory("ns3::DaryHeapScheduler");
+        AddTestCase(new SimulatorCancelledEventsTestCase(factory), TestCase::QUICK);
+        for (uint32_t arity : {2, 4, 8, 16})
+        {
+            factory = ObjectFactory("ns3::DaryHeapScheduler");
+            factory.Set("Arity", UintegerValue(arity));
+            AddTestCase(new SchedulerOrderingTestCase(factory,
+                                                      "ns3::DaryHeapScheduler, arity " +
+                                                          std::to_string(arity)),
+                        TestCase::QUICK);
+        }
+        AddTestCase(new SimulatorEventPoolTestCase(), TestCase::QUICK);
     }
 };
 
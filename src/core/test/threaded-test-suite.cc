@@ -278,6 +278,73 @@ ThreadedSimulatorEventsTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(m_a, m_d, "Bad scheduling");
 }
 
+/**
+ * \ingroup threaded-tests
+ *
+ * \brief Check that a burst of events scheduled from another thread,
+ * larger than the lock-free queue of the DefaultSimulatorImpl, is
+ * delivered completely and in order.
+ */
+class ThreadedSimulatorBurstTestCase : public TestCase
+{
+  public:
+    ThreadedSimulatorBurstTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Event scheduled from the other thread.
+     * \param value The sequence number of the event.
+     */
+    void Event(uint32_t value);
+
+    /** Number of events scheduled by the other thread. */
+    static const uint32_t COUNT = 20000;
+    uint32_t m_next; //!< Next expected sequence number.
+    bool m_ordered;  //!< Whether all events ran in order.
+};
+
+ThreadedSimulatorBurstTestCase::ThreadedSimulatorBurstTestCase()
+    : TestCase("Check a burst of events scheduled from another thread")
+{
+}
+
+void
+ThreadedSimulatorBurstTestCase::Event(uint32_t value)
+{
+    m_ordered &= (value == m_next);
+    m_next = value + 1;
+}
+
+void
+ThreadedSimulatorBurstTestCase::DoRun()
+{
+    m_next = 0;
+    m_ordered = true;
+
+    // make sure the simulator is created by this thread
+    Simulator::Now();
+
+    std::thread thread([this]() {
+        for (uint32_t i = 0; i < COUNT; i++)
+        {
+            Simulator::ScheduleWithContext(0,
+                                           MicroSeconds(1),
+                                           &ThreadedSimulatorBurstTestCase::Event,
+                                           this,
+                                           i);
+        }
+    });
+    thread.join();
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_EXPECT_MSG_EQ(m_next, COUNT, "Events were lost");
+    NS_TEST_EXPECT_MSG_EQ(m_ordered, true, "Events ran out of order");
+}
+
 /**
  * \ingroup threaded-tests
  *
@@ -298,6 +365,7 @@ class ThreadedSimulatorTestSuite : public TestSuite
             "ns3::HeapScheduler",
             "ns3::MapScheduler",
             "ns3::CalendarScheduler",
+            "ns3::DaryHeapScheduler",
         };
         unsigned int threadCounts[] = {0, 2, 10, 20};
         ObjectFactory factory;
@@ -315,6 +383,7 @@ class ThreadedSimulatorTestSuite : public TestSuite
                 }
             }
         }
+        AddTestCase(new ThreadedSimulatorBurstTestCase(), TestCase::QUICK);
     }
 };
 
@@ -19,6 +19,7 @@
 
 #include "flow-monitor.h"
 
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -80,7 +81,12 @@ FlowMonitor::GetTypeId()
                 ("The minimum inter-arrival time that is considered a flow interruption."),
                 TimeValue(Seconds(0.5)),
                 MakeTimeAccessor(&FlowMonitor::m_flowInterruptionsMinTime),
-                MakeTimeChecker());
+                MakeTimeChecker())
+            .AddAttribute("PacketSampling",
+                          "Whether to monitor only the packets sampled by the PacketSampler.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&FlowMonitor::m_packetSampling),
+                          MakeBooleanChecker());
     return tid;
 }
 
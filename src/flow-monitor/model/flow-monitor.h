@@ -224,6 +224,15 @@ class FlowMonitor : public Object
     /// \param maxDelay the max delay for a packet
     void CheckForLostPackets(Time maxDelay);
 
+    /// Check whether the probes report only the packets sampled by the
+    /// PacketSampler.  A packet which is not sampled when it enters the
+    /// system is not tagged, and is ignored by the other probes.
+    /// \returns true if the packets are sampled
+    bool IsPacketSampling() const
+    {
+        return m_packetSampling;
+    }
+
     // --- methods to get the results ---
 
     /// Container: FlowId, FlowStats
@@ -306,6 +315,7 @@ class FlowMonitor : public Object
     double m_packetSizeBinWidth;        //!< packet size bin width (for histograms)
     double m_flowInterruptionsBinWidth; //!< Flow interruptions bin width (for histograms)
     Time m_flowInterruptionsMinTime;    //!< Flow interruptions minimum time
+    bool m_packetSampling;              //!< Report only the sampled packets
 
     /// Get the stats for a given flow
     /// \param flowId the Flow identification
@@ -25,6 +25,7 @@
 #include "ns3/ipv4-flow-classifier.h"
 #include "ns3/log.h"
 #include "ns3/node.h"
+#include "ns3/packet-sampler.h"
 #include "ns3/packet.h"
 #include "ns3/pointer.h"
 
@@ -328,6 +329,12 @@ Ipv4FlowProbe::SendOutgoingLogger(const Ipv4Header& ipHeader,
     FlowId flowId;
     FlowPacketId packetId;
 
+    if (m_flowMonitor->IsPacketSampling() && !PacketSampler::IsSampled(ipPayload))
+    {
+        // not tagged, so that the other probes ignore the packet as well
+        return;
+    }
+
     if (!m_ipv4->IsUnicast(ipHeader.GetDestination()))
     {
         // we are not prepared to handle broadcast yet
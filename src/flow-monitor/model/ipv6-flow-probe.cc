@@ -26,6 +26,7 @@
 #include "ns3/ipv6-flow-classifier.h"
 #include "ns3/log.h"
 #include "ns3/node.h"
+#include "ns3/packet-sampler.h"
 #include "ns3/packet.h"
 #include "ns3/pointer.h"
 
@@ -284,6 +285,12 @@ Ipv6FlowProbe::SendOutgoingLogger(const Ipv6Header& ipHeader,
     FlowId flowId;
     FlowPacketId packetId;
 
+    if (m_flowMonitor->IsPacketSampling() && !PacketSampler::IsSampled(ipPayload))
+    {
+        // not tagged, so that the other probes ignore the packet as well
+        return;
+    }
+
     if (m_classifier->Classify(ipHeader, ipPayload, &flowId, &packetId))
     {
         uint32_t size = (ipPayload->GetSize() + ipHeader.GetSerializedSize());
@@ -21,6 +21,7 @@
 #include "internet-stack-helper.h"
 
 #include "ns3/arp-l3-protocol.h"
+#include "ns3/abort.h"
 #include "ns3/assert.h"
 #include "ns3/callback.h"
 #include "ns3/config.h"
@@ -811,6 +812,12 @@ InternetStackHelper::EnableAsciiIpv4Internal(Ptr<OutputStreamWrapper> stream,
     //
     Packet::EnablePrinting();
 
+    //
+    // Our trace sinks print the packets: they cannot write binary records.
+    //
+    NS_ABORT_MSG_IF(stream && stream->GetBinaryTrace(),
+                    "The Ipv4 ascii trace sinks do not support binary trace streams");
+
     //
     // If we are not provided an OutputStreamWrapper, we are expected to create
     // one using the usual trace filename conventions and hook WithoutContext
@@ -1155,6 +1162,12 @@ InternetStackHelper::EnableAsciiIpv6Internal(Ptr<OutputStreamWrapper> stream,
     //
     Packet::EnablePrinting();
 
+    //
+    // Our trace sinks print the packets: they cannot write binary records.
+    //
+    NS_ABORT_MSG_IF(stream && stream->GetBinaryTrace(),
+                    "The Ipv6 ascii trace sinks do not support binary trace streams");
+
     //
     // If we are not provided an OutputStreamWrapper, we are expected to create
     // one using the usual trace filename conventions and do a hook WithoutContext
@@ -21,6 +21,7 @@
 
 #include "ns3/abort.h"
 #include "ns3/assert.h"
+#include "ns3/header-field.h"
 #include "ns3/header.h"
 #include "ns3/log.h"
 
@@ -31,6 +32,22 @@ NS_LOG_COMPONENT_DEFINE("Ipv4Header");
 
 NS_OBJECT_ENSURE_REGISTERED(Ipv4Header);
 
+/// Layout of the IPv4 header, without options
+struct Ipv4HeaderLayout
+{
+    using VerIhl = HeaderField<0, uint8_t>;                           //!< Version and header length
+    using Tos = HeaderField<VerIhl::END, uint8_t>;                    //!< Type of service
+    using TotalLength = HeaderField<Tos::END, uint16_t>;              //!< Total length
+    using Identification = HeaderField<TotalLength::END, uint16_t>;   //!< Identification
+    using FlagsFragment = HeaderField<Identification::END, uint16_t>; //!< Flags, fragment offset
+    using Ttl = HeaderField<FlagsFragment::END, uint8_t>;             //!< Time to live
+    using Protocol = HeaderField<Ttl::END, uint8_t>;                  //!< Protocol
+    using Checksum = HeaderField<Protocol::END, uint16_t, false>;     //!< Checksum
+    using Source = HeaderField<Checksum::END, uint32_t>;              //!< Source address
+    using Destination = HeaderField<Source::END, uint32_t>;           //!< Destination address
+    static const uint32_t SIZE = Destination::END;                    //!< Size of the header
+};
+
 Ipv4Header::Ipv4Header()
     : m_calcChecksum(false),
       m_payloadSize(0),
@@ -392,40 +409,37 @@ void
 Ipv4Header::Serialize(Buffer::Iterator start) const
 {
     NS_LOG_FUNCTION(this << &start);
+    using Layout = Ipv4HeaderLayout;
     Buffer::Iterator i = start;
+    uint8_t* header = i.WriteSpan(Layout::SIZE);
 
     uint8_t verIhl = (4 << 4) | (5);
-    i.WriteU8(verIhl);
-    i.WriteU8(m_tos);
-    i.WriteHtonU16(m_payloadSize + 5 * 4);
-    i.WriteHtonU16(m_identification);
-    uint32_t fragmentOffset = m_fragmentOffset / 8;
-    uint8_t flagsFrag = (fragmentOffset >> 8) & 0x1f;
+    Layout::VerIhl::Write(header, verIhl);
+    Layout::Tos::Write(header, m_tos);
+    Layout::TotalLength::Write(header, m_payloadSize + 5 * 4);
+    Layout::Identification::Write(header, m_identification);
+    uint16_t flagsFrag = (m_fragmentOffset / 8) & 0x1fff;
     if (m_flags & DONT_FRAGMENT)
     {
-        flagsFrag |= (1 << 6);
+        flagsFrag |= (1 << 14);
     }
     if (m_flags & MORE_FRAGMENTS)
     {
-        flagsFrag |= (1 << 5);
+        flagsFrag |= (1 << 13);
     }
-    i.WriteU8(flagsFrag);
-    uint8_t frag = fragmentOffset & 0xff;
-    i.WriteU8(frag);
-    i.WriteU8(m_ttl);
-    i.WriteU8(m_protocol);
-    i.WriteHtonU16(0);
-    i.WriteHtonU32(m_source.Get());
-    i.WriteHtonU32(m_destination.Get());
+    Layout::FlagsFragment::Write(header, flagsFrag);
+    Layout::Ttl::Write(header, m_ttl);
+    Layout::Protocol::Write(header, m_protocol);
+    Layout::Checksum::Write(header, 0);
+    Layout::Source::Write(header, m_source.Get());
+    Layout::Destination::Write(header, m_destination.Get());
 
     if (m_calcChecksum)
     {
         i = start;
         uint16_t checksum = i.CalculateIpChecksum(20);
         NS_LOG_LOGIC("checksum=" << checksum);
-        i = start;
-        i.Next(10);
-        i.WriteU16(checksum);
+        Layout::Checksum::Write(header, checksum);
     }
 }
 
@@ -433,9 +447,10 @@ uint32_t
 Ipv4Header::Deserialize(Buffer::Iterator start)
 {
     NS_LOG_FUNCTION(this << &start);
+    using Layout = Ipv4HeaderLayout;
     Buffer::Iterator i = start;
 
-    uint8_t verIhl = i.ReadU8();
+    uint8_t verIhl = i.PeekU8();
     uint8_t ihl = verIhl & 0x0f;
     uint16_t headerSize = ihl * 4;
 
@@ -445,31 +460,28 @@ Ipv4Header::Deserialize(Buffer::Iterator start)
         return 0;
     }
 
-    m_tos = i.ReadU8();
-    uint16_t size = i.ReadNtohU16();
+    uint8_t scratch[Layout::SIZE];
+    const uint8_t* header = i.ReadSpan(scratch, Layout::SIZE);
+    m_tos = Layout::Tos::Read(header);
+    uint16_t size = Layout::TotalLength::Read(header);
     m_payloadSize = size - headerSize;
-    m_identification = i.ReadNtohU16();
-    uint8_t flags = i.ReadU8();
+    m_identification = Layout::Identification::Read(header);
+    uint16_t flagsFrag = Layout::FlagsFragment::Read(header);
     m_flags = 0;
-    if (flags & (1 << 6))
+    if (flagsFrag & (1 << 14))
     {
         m_flags |= DONT_FRAGMENT;
     }
-    if (flags & (1 << 5))
+    if (flagsFrag & (1 << 13))
     {
         m_flags |= MORE_FRAGMENTS;
     }
-    i.Prev();
-    m_fragmentOffset = i.ReadU8() & 0x1f;
-    m_fragmentOffset <<= 8;
-    m_fragmentOffset |= i.ReadU8();
-    m_fragmentOffset <<= 3;
-    m_ttl = i.ReadU8();
-    m_protocol = i.ReadU8();
-    m_checksum = i.ReadU16();
-    /* i.Next (2); // checksum */
-    m_source.Set(i.ReadNtohU32());
-    m_destination.Set(i.ReadNtohU32());
+    m_fragmentOffset = (flagsFrag & 0x1fff) << 3;
+    m_ttl = Layout::Ttl::Read(header);
+    m_protocol = Layout::Protocol::Read(header);
+    m_checksum = Layout::Checksum::Read(header);
+    m_source.Set(Layout::Source::Read(header));
+    m_destination.Set(Layout::Destination::Read(header));
     m_headerSize = headerSize;
 
     if (m_calcChecksum)
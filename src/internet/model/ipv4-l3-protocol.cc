@@ -598,7 +598,10 @@ Ipv4L3Protocol::Receive(Ptr<NetDevice> device,
 
     if (ipv4Interface->IsUp())
     {
-        m_rxTrace(packet, this, interface);
+        if (!m_rxTrace.IsEmpty())
+        {
+            m_rxTrace(packet, this, interface);
+        }
     }
     else
     {
@@ -824,7 +827,10 @@ Ipv4L3Protocol::Send(Ptr<Packet> packet,
         // 1b) with a valid gateway
         NS_LOG_LOGIC("Ipv4L3Protocol::Send case 1b:  passed in with route and valid gateway");
         int32_t interface = GetInterfaceForDevice(route->GetOutputDevice());
-        m_sendOutgoingTrace(ipHeader, packet, interface);
+        if (!m_sendOutgoingTrace.IsEmpty())
+        {
+            m_sendOutgoingTrace(ipHeader, packet, interface);
+        }
         if (m_enableDpd && ipHeader.GetDestination().IsMulticast())
         {
             UpdateDuplicate(packet, ipHeader);
@@ -1073,7 +1079,10 @@ Ipv4L3Protocol::IpMulticastForward(Ptr<Ipv4MulticastRoute> mrtentry,
         rtentry->SetGateway(Ipv4Address::GetAny());
         rtentry->SetOutputDevice(GetNetDevice(interface));
 
-        m_multicastForwardTrace(ipHeader, packet, interface);
+        if (!m_multicastForwardTrace.IsEmpty())
+        {
+            m_multicastForwardTrace(ipHeader, packet, interface);
+        }
         SendRealOut(rtentry, packet, ipHeader);
     }
 }
@@ -1113,7 +1122,10 @@ Ipv4L3Protocol::IpForward(Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ipv
         packet->AddPacketTag(priorityTag);
     }
 
-    m_unicastForwardTrace(ipHeader, packet, interface);
+    if (!m_unicastForwardTrace.IsEmpty())
+    {
+        m_unicastForwardTrace(ipHeader, packet, interface);
+    }
     SendRealOut(rtentry, packet, ipHeader);
 }
 
@@ -1138,7 +1150,10 @@ Ipv4L3Protocol::LocalDeliver(Ptr<const Packet> packet, const Ipv4Header& ip, uin
         ipHeader.SetPayloadSize(p->GetSize());
     }
 
-    m_localDeliverTrace(ipHeader, p, iif);
+    if (!m_localDeliverTrace.IsEmpty())
+    {
+        m_localDeliverTrace(ipHeader, p, iif);
+    }
 
     Ptr<IpL4Protocol> protocol = GetProtocol(ipHeader.GetProtocol(), iif);
     if (protocol)
@@ -1581,33 +1596,29 @@ Ipv4L3Protocol::ProcessFragment(Ptr<Packet>& packet, Ipv4Header& ipHeader, uint3
     key.first = addressCombination;
     key.second = idProto;
 
-    Ptr<Fragments> fragments;
-
     MapFragments_t::iterator it = m_fragments.find(key);
     if (it == m_fragments.end())
     {
-        fragments = Create<Fragments>();
-        m_fragments.insert(std::make_pair(key, fragments));
+        it = m_fragments.emplace(key, Create<Fragments>()).first;
 
         FragmentsTimeoutsListI_t iter = SetTimeout(key, ipHeader, iif);
-        fragments->SetTimeoutIter(iter);
-    }
-    else
-    {
-        fragments = it->second;
+        it->second->SetTimeoutIter(iter);
     }
 
     NS_LOG_LOGIC("Adding fragment - Size: " << packet->GetSize()
                                             << " - Offset: " << (ipHeader.GetFragmentOffset()));
 
+    // Access the fragments through the map entry, which owns them: a
+    // local Ptr copy released after erasing the entry trips GCC 12's
+    // -Wuse-after-free at -O2.
+    Ptr<Fragments>& fragments = it->second;
     fragments->AddFragment(p, ipHeader.GetFragmentOffset(), !ipHeader.IsLastFragment());
 
     if (fragments->IsEntire())
     {
         packet = fragments->GetPacket();
         m_timeoutEventList.erase(fragments->GetTimeoutIter());
-        fragments = nullptr;
-        m_fragments.erase(key);
+        m_fragments.erase(it);
         ret = true;
     }
 
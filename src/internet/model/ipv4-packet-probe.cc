@@ -22,10 +22,12 @@
 
 #include "ns3/ipv4-packet-probe.h"
 
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/object.h"
+#include "ns3/packet-sampler.h"
 #include "ns3/trace-source-accessor.h"
 
 namespace ns3
@@ -43,6 +45,11 @@ Ipv4PacketProbe::GetTypeId()
             .SetParent<Probe>()
             .SetGroupName("Internet")
             .AddConstructor<Ipv4PacketProbe>()
+            .AddAttribute("PacketSampling",
+                          "Whether to trace only the packets sampled by the PacketSampler.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&Ipv4PacketProbe::m_packetSampling),
+                          MakeBooleanChecker())
             .AddTraceSource("Output",
                             "The packet plus its IPv4 object and interface "
                             "that serve as the output for this probe",
@@ -118,7 +125,7 @@ void
 Ipv4PacketProbe::TraceSink(Ptr<const Packet> packet, Ptr<Ipv4> ipv4, uint32_t interface)
 {
     NS_LOG_FUNCTION(this << packet << ipv4 << interface);
-    if (IsEnabled())
+    if (IsEnabled() && (!m_packetSampling || PacketSampler::IsSampled(packet)))
     {
         m_packet = packet;
         m_ipv4 = ipv4;
@@ -23,10 +23,12 @@
 
 #include "ns3/ipv6-packet-probe.h"
 
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/object.h"
+#include "ns3/packet-sampler.h"
 #include "ns3/trace-source-accessor.h"
 
 namespace ns3
@@ -44,6 +46,11 @@ Ipv6PacketProbe::GetTypeId()
             .SetParent<Probe>()
             .SetGroupName("Internet")
             .AddConstructor<Ipv6PacketProbe>()
+            .AddAttribute("PacketSampling",
+                          "Whether to trace only the packets sampled by the PacketSampler.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&Ipv6PacketProbe::m_packetSampling),
+                          MakeBooleanChecker())
             .AddTraceSource("Output",
                             "The packet plus its IPv6 object and interface "
                             "that serve as the output for this probe",
@@ -119,7 +126,7 @@ void
 Ipv6PacketProbe::TraceSink(Ptr<const Packet> packet, Ptr<Ipv6> ipv6, uint32_t interface)
 {
     NS_LOG_FUNCTION(this << packet << ipv6 << interface);
-    if (IsEnabled())
+    if (IsEnabled() && (!m_packetSampling || PacketSampler::IsSampled(packet)))
     {
         m_packet = packet;
         m_ipv6 = ipv6;
@@ -23,6 +23,7 @@
 
 #include "ns3/address-utils.h"
 #include "ns3/buffer.h"
+#include "ns3/header-field.h"
 #include "ns3/log.h"
 
 #include <iostream>
@@ -35,6 +36,20 @@ NS_LOG_COMPONENT_DEFINE("TcpHeader");
 
 NS_OBJECT_ENSURE_REGISTERED(TcpHeader);
 
+/// Layout of the TCP header, without options
+struct TcpHeaderLayout
+{
+    using SourcePort = HeaderField<0, uint16_t>;                        //!< Source port
+    using DestinationPort = HeaderField<SourcePort::END, uint16_t>;     //!< Destination port
+    using SequenceNumber = HeaderField<DestinationPort::END, uint32_t>; //!< Sequence number
+    using AckNumber = HeaderField<SequenceNumber::END, uint32_t>;       //!< Ack number
+    using LengthFlags = HeaderField<AckNumber::END, uint16_t>;          //!< Length and flags
+    using WindowSize = HeaderField<LengthFlags::END, uint16_t>;         //!< Window size
+    using Checksum = HeaderField<WindowSize::END, uint16_t, false>;     //!< Checksum
+    using UrgentPointer = HeaderField<Checksum::END, uint16_t>;         //!< Urgent pointer
+    static const uint32_t SIZE = UrgentPointer::END;                    //!< Size of the header
+};
+
 TcpHeader::TcpHeader()
     : m_sourcePort(0),
       m_destinationPort(0),
@@ -305,15 +320,17 @@ TcpHeader::GetSerializedSize() const
 void
 TcpHeader::Serialize(Buffer::Iterator start) const
 {
+    using Layout = TcpHeaderLayout;
     Buffer::Iterator i = start;
-    i.WriteHtonU16(m_sourcePort);
-    i.WriteHtonU16(m_destinationPort);
-    i.WriteHtonU32(m_sequenceNumber.GetValue());
-    i.WriteHtonU32(m_ackNumber.GetValue());
-    i.WriteHtonU16(GetLength() << 12 | m_flags); // reserved bits are all zero
-    i.WriteHtonU16(m_windowSize);
-    i.WriteHtonU16(0);
-    i.WriteHtonU16(m_urgentPointer);
+    uint8_t* header = i.WriteSpan(Layout::SIZE);
+    Layout::SourcePort::Write(header, m_sourcePort);
+    Layout::DestinationPort::Write(header, m_destinationPort);
+    Layout::SequenceNumber::Write(header, m_sequenceNumber.GetValue());
+    Layout::AckNumber::Write(header, m_ackNumber.GetValue());
+    Layout::LengthFlags::Write(header, GetLength() << 12 | m_flags); // reserved bits are all zero
+    Layout::WindowSize::Write(header, m_windowSize);
+    Layout::Checksum::Write(header, 0);
+    Layout::UrgentPointer::Write(header, m_urgentPointer);
 
     // Serialize options if they exist
     // This implementation does not presently try to align options on word
@@ -341,9 +358,7 @@ TcpHeader::Serialize(Buffer::Iterator start) const
         i = start;
         uint16_t checksum = i.CalculateIpChecksum(start.GetSize(), headerChecksum);
 
-        i = start;
-        i.Next(16);
-        i.WriteU16(checksum);
+        Layout::Checksum::Write(header, checksum);
     }
 }
 
@@ -351,17 +366,19 @@ uint32_t
 TcpHeader::Deserialize(Buffer::Iterator start)
 {
     m_optionsLen = 0;
+    using Layout = TcpHeaderLayout;
     Buffer::Iterator i = start;
-    m_sourcePort = i.ReadNtohU16();
-    m_destinationPort = i.ReadNtohU16();
-    m_sequenceNumber = i.ReadNtohU32();
-    m_ackNumber = i.ReadNtohU32();
-    uint16_t field = i.ReadNtohU16();
+    uint8_t scratch[Layout::SIZE];
+    const uint8_t* header = i.ReadSpan(scratch, Layout::SIZE);
+    m_sourcePort = Layout::SourcePort::Read(header);
+    m_destinationPort = Layout::DestinationPort::Read(header);
+    m_sequenceNumber = Layout::SequenceNumber::Read(header);
+    m_ackNumber = Layout::AckNumber::Read(header);
+    uint16_t field = Layout::LengthFlags::Read(header);
     m_flags = field & 0xFF;
     m_length = field >> 12;
-    m_windowSize = i.ReadNtohU16();
-    i.Next(2);
-    m_urgentPointer = i.ReadNtohU16();
+    m_windowSize = Layout::WindowSize::Read(header);
+    m_urgentPointer = Layout::UrgentPointer::Read(header);
 
     // Deserialize options if they exist
     m_options.clear();
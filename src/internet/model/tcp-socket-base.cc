@@ -1336,7 +1336,10 @@ TcpSocketBase::DoForwardUp(Ptr<Packet> packet, const Address& fromAddress, const
         }
     }
 
-    m_rxTrace(packet, tcpHeader, this);
+    if (!m_rxTrace.IsEmpty())
+    {
+        m_rxTrace(packet, tcpHeader, this);
+    }
 
     if (tcpHeader.GetFlags() & TcpHeader::SYN)
     {
@@ -1452,7 +1455,10 @@ TcpSocketBase::DoForwardUp(Ptr<Packet> packet, const Address& fromAddress, const
             h.SetDestinationPort(tcpHeader.GetSourcePort());
             h.SetWindowSize(AdvertisedWindowSize());
             AddOptions(h);
-            m_txTrace(p, h, this);
+            if (!m_txTrace.IsEmpty())
+            {
+                m_txTrace(p, h, this);
+            }
             m_tcp->SendPacket(p, h, toAddress, fromAddress, m_boundnetdevice);
         }
         break;
@@ -2839,7 +2845,10 @@ TcpSocketBase::SendEmptyPacket(uint8_t flags)
         NS_LOG_INFO("Sending a pure ACK, acking seq " << m_tcb->m_rxBuffer->NextRxSequence());
     }
 
-    m_txTrace(p, header, this);
+    if (!m_txTrace.IsEmpty())
+    {
+        m_txTrace(p, header, this);
+    }
 
     if (m_endPoint != nullptr)
     {
@@ -3215,7 +3224,10 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
         m_retxEvent = Simulator::Schedule(m_rto, &TcpSocketBase::ReTxTimeout, this);
     }
 
-    m_txTrace(p, header, this);
+    if (!m_txTrace.IsEmpty())
+    {
+        m_txTrace(p, header, this);
+    }
 
     if (m_endPoint)
     {
@@ -3931,7 +3943,10 @@ TcpSocketBase::PersistTimeout()
         ipTclassTag.SetTclass(MarkEcnCodePoint(0, m_tcb->m_ectCodePoint));
         p->AddPacketTag(ipTclassTag);
     }
-    m_txTrace(p, tcpHeader, this);
+    if (!m_txTrace.IsEmpty())
+    {
+        m_txTrace(p, tcpHeader, this);
+    }
 
     if (m_endPoint != nullptr)
     {
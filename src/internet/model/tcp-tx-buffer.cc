@@ -22,6 +22,7 @@
 
 #include "ns3/abort.h"
 #include "ns3/log.h"
+#include "ns3/packet-accounting.h"
 #include "ns3/packet.h"
 #include "ns3/tcp-option-ts.h"
 
@@ -191,6 +192,7 @@ TcpTxBuffer::Add(Ptr<Packet> p)
         {
             TcpTxItem* item = new TcpTxItem();
             item->m_packet = p->Copy();
+            PacketAccounting::NotifyHeld(PeekPointer(item->m_packet), this);
             m_appList.insert(m_appList.end(), item);
             m_size += p->GetSize();
 
@@ -385,6 +387,7 @@ TcpTxBuffer::SplitItems(TcpTxItem* t1, TcpTxItem* t2, uint32_t size) const
     NS_LOG_FUNCTION(this << *t2 << size);
 
     t1->m_packet = t2->m_packet->CreateFragment(0, size);
+    PacketAccounting::NotifyHeld(PeekPointer(t1->m_packet), this);
     t2->m_packet->RemoveAtStart(size);
 
     t1->m_startSeq = t2->m_startSeq;
@@ -727,6 +730,7 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
             NS_LOG_INFO(*item);
             // PacketTags are preserved when fragmenting
             item->m_packet = item->m_packet->CreateFragment(offset, pktSize);
+            PacketAccounting::NotifyHeld(PeekPointer(item->m_packet), this);
             item->m_startSeq += offset;
             m_size -= offset;
             m_sentSize -= offset;
@@ -20,12 +20,23 @@
 #include "udp-header.h"
 
 #include "ns3/address-utils.h"
+#include "ns3/header-field.h"
 
 namespace ns3
 {
 
 NS_OBJECT_ENSURE_REGISTERED(UdpHeader);
 
+/// Layout of the UDP header
+struct UdpHeaderLayout
+{
+    using SourcePort = HeaderField<0, uint16_t>;                    //!< Source port
+    using DestinationPort = HeaderField<SourcePort::END, uint16_t>; //!< Destination port
+    using Length = HeaderField<DestinationPort::END, uint16_t>;     //!< Length
+    using Checksum = HeaderField<Length::END, uint16_t, false>;     //!< Checksum
+    static const uint32_t SIZE = Checksum::END;                     //!< Size of the header
+};
+
 /* The magic values below are used only for debugging.
  * They can be used to easily detect memory corruption
  * problems so you can see the patterns in memory.
@@ -185,22 +196,24 @@ UdpHeader::GetSerializedSize() const
 void
 UdpHeader::Serialize(Buffer::Iterator start) const
 {
+    using Layout = UdpHeaderLayout;
     Buffer::Iterator i = start;
+    uint8_t* header = i.WriteSpan(Layout::SIZE);
 
-    i.WriteHtonU16(m_sourcePort);
-    i.WriteHtonU16(m_destinationPort);
+    Layout::SourcePort::Write(header, m_sourcePort);
+    Layout::DestinationPort::Write(header, m_destinationPort);
     if (m_payloadSize == 0)
     {
-        i.WriteHtonU16(start.GetSize());
+        Layout::Length::Write(header, start.GetSize());
     }
     else
     {
-        i.WriteHtonU16(m_payloadSize);
+        Layout::Length::Write(header, m_payloadSize);
     }
 
     if (m_checksum == 0)
     {
-        i.WriteU16(0);
+        Layout::Checksum::Write(header, 0);
 
         if (m_calcChecksum)
         {
@@ -208,25 +221,26 @@ UdpHeader::Serialize(Buffer::Iterator start) const
             i = start;
             uint16_t checksum = i.CalculateIpChecksum(start.GetSize(), headerChecksum);
 
-            i = start;
-            i.Next(6);
-            i.WriteU16(checksum);
+            Layout::Checksum::Write(header, checksum);
         }
     }
     else
     {
-        i.WriteU16(m_checksum);
+        Layout::Checksum::Write(header, m_checksum);
     }
 }
 
 uint32_t
 UdpHeader::Deserialize(Buffer::Iterator start)
 {
+    using Layout = UdpHeaderLayout;
     Buffer::Iterator i = start;
-    m_sourcePort = i.ReadNtohU16();
-    m_destinationPort = i.ReadNtohU16();
-    m_payloadSize = i.ReadNtohU16() - GetSerializedSize();
-    m_checksum = i.ReadU16();
+    uint8_t scratch[Layout::SIZE];
+    const uint8_t* header = i.ReadSpan(scratch, Layout::SIZE);
+    m_sourcePort = Layout::SourcePort::Read(header);
+    m_destinationPort = Layout::DestinationPort::Read(header);
+    m_payloadSize = Layout::Length::Read(header) - GetSerializedSize();
+    m_checksum = Layout::Checksum::Read(header);
 
     if (m_calcChecksum)
     {
@@ -21,6 +21,7 @@
 #include "lr-wpan-helper.h"
 
 #include "ns3/names.h"
+#include <ns3/abort.h>
 #include <ns3/log.h>
 #include <ns3/lr-wpan-csmaca.h>
 #include <ns3/lr-wpan-error-model.h>
@@ -402,6 +403,12 @@ LrWpanHelper::EnableAsciiInternal(Ptr<OutputStreamWrapper> stream,
     //
     Packet::EnablePrinting();
 
+    //
+    // Our trace sinks print the packets: they cannot write binary records.
+    //
+    NS_ABORT_MSG_IF(stream && stream->GetBinaryTrace(),
+                    "The LrWpan ascii trace sinks do not support binary trace streams");
+
     //
     // If we are not provided an OutputStreamWrapper, we are expected to create
     // one using the usual trace filename conventions and do a Hook*WithoutContext
@@ -197,9 +197,11 @@ LteInterference::ConditionallyEvaluateChunk()
         NS_LOG_LOGIC(this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals
                           << " noise = " << *m_noise);
 
-        SpectrumValue interf = (*m_allSignals) - (*m_rxSignal) + (*m_noise);
+        SpectrumValue interf;
+        interf.SetInterference(*m_allSignals, *m_rxSignal, *m_noise);
 
-        SpectrumValue sinr = (*m_rxSignal) / interf;
+        SpectrumValue sinr;
+        sinr.SetQuotient(*m_rxSignal, interf);
         Time duration = Now() - m_lastChangeTime;
         for (std::list<Ptr<LteChunkProcessor>>::const_iterator it =
                  m_sinrChunkProcessorList.begin();
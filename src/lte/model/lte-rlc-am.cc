@@ -24,6 +24,7 @@
 #include "ns3/lte-rlc-am-header.h"
 #include "ns3/lte-rlc-sdu-status-tag.h"
 #include "ns3/lte-rlc-tag.h"
+#include "ns3/packet-accounting.h"
 #include "ns3/simulator.h"
 
 namespace ns3
@@ -170,6 +171,7 @@ LteRlcAm::DoTransmitPdcpPdu(Ptr<Packet> p)
 
         NS_LOG_LOGIC("Txon Buffer: New packet added");
         m_txonBuffer.emplace_back(p, Simulator::Now());
+        PacketAccounting::NotifyHeld(PeekPointer(p), this);
         m_txonBufferSize += p->GetSize();
         NS_LOG_LOGIC("NumOfBuffers = " << m_txonBuffer.size());
         NS_LOG_LOGIC("txonBufferSize = " << m_txonBufferSize);
@@ -394,6 +396,9 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
                     NS_LOG_INFO("Move SN = " << seqNumberValue << " back to txedBuffer");
                     m_txedBuffer.at(seqNumberValue).m_pdu =
                         m_retxBuffer.at(seqNumberValue).m_pdu->Copy();
+                    PacketAccounting::NotifyHeld(
+                        PeekPointer(m_txedBuffer.at(seqNumberValue).m_pdu),
+                        this);
                     m_txedBuffer.at(seqNumberValue).m_retxCount =
                         m_retxBuffer.at(seqNumberValue).m_retxCount;
                     m_txedBuffer.at(seqNumberValue).m_waitingSince =
@@ -534,6 +539,7 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
                 firstSegment->AddPacketTag(oldTag);
 
                 m_txonBuffer.insert(m_txonBuffer.begin(), TxPdu(firstSegment, firstSegmentTime));
+                PacketAccounting::NotifyHeld(PeekPointer(firstSegment), this);
                 m_txonBufferSize += m_txonBuffer.begin()->m_pdu->GetSize();
 
                 NS_LOG_LOGIC("    Txon buffer: Give back the remaining segment");
@@ -761,6 +767,9 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
     NS_LOG_LOGIC("Put transmitted PDU in the txedBuffer");
     m_txedBufferSize += packet->GetSize();
     m_txedBuffer.at(rlcAmHeader.GetSequenceNumber().GetValue()).m_pdu = packet->Copy();
+    PacketAccounting::NotifyHeld(
+        PeekPointer(m_txedBuffer.at(rlcAmHeader.GetSequenceNumber().GetValue()).m_pdu),
+        this);
     m_txedBuffer.at(rlcAmHeader.GetSequenceNumber().GetValue()).m_retxCount = 0;
     m_txedBuffer.at(rlcAmHeader.GetSequenceNumber().GetValue()).m_waitingSince = Simulator::Now();
 
@@ -1093,6 +1102,9 @@ LteRlcAm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
                     NS_LOG_INFO("Move SN = " << seqNumberValue << " to retxBuffer");
                     m_retxBuffer.at(seqNumberValue).m_pdu =
                         m_txedBuffer.at(seqNumberValue).m_pdu->Copy();
+                    PacketAccounting::NotifyHeld(
+                        PeekPointer(m_retxBuffer.at(seqNumberValue).m_pdu),
+                        this);
                     m_retxBuffer.at(seqNumberValue).m_retxCount =
                         m_txedBuffer.at(seqNumberValue).m_retxCount;
                     m_retxBuffer.at(seqNumberValue).m_waitingSince =
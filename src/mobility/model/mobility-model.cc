@@ -55,7 +55,10 @@ MobilityModel::GetTypeId()
     return tid;
 }
 
+uint32_t MobilityModel::m_uidCount = 0;
+
 MobilityModel::MobilityModel()
+    : m_uid(m_uidCount++)
 {
 }
 
@@ -120,6 +123,12 @@ MobilityModel::AssignStreams(int64_t start)
     return DoAssignStreams(start);
 }
 
+uint32_t
+MobilityModel::GetUid() const
+{
+    return m_uid;
+}
+
 // Default implementation does nothing
 int64_t
 MobilityModel::DoAssignStreams(int64_t start)
@@ -91,6 +91,12 @@ class MobilityModel : public Object
      */
     int64_t AssignStreams(int64_t stream);
 
+    /**
+     * \return the unique identifier of this model, the mobility models being
+     * numbered in their order of creation
+     */
+    uint32_t GetUid() const;
+
     /**
      *  TracedCallback signature.
      *
@@ -149,6 +155,9 @@ class MobilityModel : public Object
      * or position has occurred.
      */
     ns3::TracedCallback<Ptr<const MobilityModel>> m_courseChangeTrace;
+
+    uint32_t m_uid;             //!< unique identifier of this model
+    static uint32_t m_uidCount; //!< counter to assign m_uid
 };
 
 } // namespace ns3
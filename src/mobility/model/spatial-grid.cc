@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "spatial-grid.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SpatialGrid");
+
+SpatialGrid::SpatialGrid(double cellSize)
+    : m_cellSize(cellSize),
+      m_maxSpeed(0),
+      m_lastRefresh(Simulator::Now())
+{
+    NS_LOG_FUNCTION(this << cellSize);
+    NS_ABORT_MSG_IF(cellSize <= 0, "Invalid cell size " << cellSize);
+}
+
+SpatialGrid::~SpatialGrid()
+{
+    NS_LOG_FUNCTION(this);
+    for (const auto& [mobility, tracked] : m_tracked)
+    {
+        mobility->TraceDisconnectWithoutContext("CourseChange",
+                                                MakeCallback(&SpatialGrid::CourseChanged, this));
+    }
+}
+
+void
+SpatialGrid::Add(uint32_t id, Ptr<MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << id << mobility);
+    Remove(id);
+    if (!mobility)
+    {
+        m_entries[id] = {nullptr, 0, 0};
+        m_unlocated.push_back(id);
+        return;
+    }
+    m_entries[id] = {mobility, 0, 0};
+    auto [tracked, inserted] = m_tracked.try_emplace(PeekPointer(mobility));
+    if (inserted)
+    {
+        mobility->TraceConnectWithoutContext("CourseChange",
+                                             MakeCallback(&SpatialGrid::CourseChanged, this));
+        tracked->second.speed = mobility->GetVelocity().GetLength();
+        m_maxSpeed = std::max(m_maxSpeed, tracked->second.speed);
+    }
+    tracked->second.ids.push_back(id);
+    Bin(id);
+}
+
+void
+SpatialGrid::Remove(uint32_t id)
+{
+    NS_LOG_FUNCTION(this << id);
+    auto it = m_entries.find(id);
+    if (it == m_entries.end())
+    {
+        return;
+    }
+    Ptr<MobilityModel> mobility = it->second.mobility;
+    if (!mobility)
+    {
+        m_unlocated.erase(std::find(m_unlocated.begin(), m_unlocated.end(), id));
+        m_entries.erase(it);
+        return;
+    }
+    Unbin(id);
+    m_entries.erase(it);
+    auto tracked = m_tracked.find(PeekPointer(mobility));
+    std::vector<uint32_t>& ids = tracked->second.ids;
+    ids.erase(std::find(ids.begin(), ids.end(), id));
+    if (ids.empty())
+    {
+        mobility->TraceDisconnectWithoutContext("CourseChange",
+                                                MakeCallback(&SpatialGrid::CourseChanged, this));
+        m_tracked.erase(tracked);
+    }
+}
+
+std::size_t
+SpatialGrid::GetN() const
+{
+    return m_entries.size();
+}
+
+void
+SpatialGrid::GetWithinRange(const Vector& position, double range, std::vector<uint32_t>& ids)
+{
+    NS_LOG_FUNCTION(this << position << range);
+    Refresh();
+    ids.clear();
+
+    // the moving entries may have left the cells in which they were binned
+    double slack = m_maxSpeed * (Simulator::Now() - m_lastRefresh).GetSeconds();
+    double searched = range + slack;
+    int64_t xMin = GetCellCoordinate(position.x - searched);
+    int64_t xMax = GetCellCoordinate(position.x + searched);
+    int64_t yMin = GetCellCoordinate(position.y - searched);
+    int64_t yMax = GetCellCoordinate(position.y + searched);
+
+    auto addWithinRange = [&](const std::vector<uint32_t>& cell) {
+        for (uint32_t id : cell)
+        {
+            const Entry& entry = m_entries.at(id);
+            if (CalculateDistance(position, entry.mobility->GetPosition()) <= range)
+            {
+                ids.push_back(id);
+            }
+        }
+    };
+
+    if (static_cast<double>(xMax - xMin + 1) * (yMax - yMin + 1) > m_cells.size())
+    {
+        // the range spans more cells than are occupied
+        for (const auto& [key, cell] : m_cells)
+        {
+            addWithinRange(cell);
+        }
+    }
+    else
+    {
+        for (int64_t x = xMin; x <= xMax; ++x)
+        {
+            for (int64_t y = yMin; y <= yMax; ++y)
+            {
+                auto cell = m_cells.find(GetCell(x, y));
+                if (cell != m_cells.end())
+                {
+                    addWithinRange(cell->second);
+                }
+            }
+        }
+    }
+    ids.insert(ids.end(), m_unlocated.begin(), m_unlocated.end());
+    std::sort(ids.begin(), ids.end());
+}
+
+int64_t
+SpatialGrid::GetCell(int64_t x, int64_t y)
+{
+    return static_cast<int64_t>((static_cast<uint64_t>(x) << 32) | static_cast<uint32_t>(y));
+}
+
+int64_t
+SpatialGrid::GetCellCoordinate(double coordinate) const
+{
+    return static_cast<int64_t>(std::floor(coordinate / m_cellSize));
+}
+
+void
+SpatialGrid::Bin(uint32_t id)
+{
+    Entry& entry = m_entries.at(id);
+    Vector position = entry.mobility->GetPosition();
+    entry.cell = GetCell(GetCellCoordinate(position.x), GetCellCoordinate(position.y));
+    std::vector<uint32_t>& cell = m_cells[entry.cell];
+    entry.slot = cell.size();
+    cell.push_back(id);
+}
+
+void
+SpatialGrid::Unbin(uint32_t id)
+{
+    const Entry& entry = m_entries.at(id);
+    auto cell = m_cells.find(entry.cell);
+    std::vector<uint32_t>& ids = cell->second;
+    // move the last entry of the cell to the slot of the removed entry
+    ids[entry.slot] = ids.back();
+    m_entries.at(ids[entry.slot]).slot = entry.slot;
+    ids.pop_back();
+    if (ids.empty())
+    {
+        m_cells.erase(cell);
+    }
+}
+
+void
+SpatialGrid::CourseChanged(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    Tracked& tracked = m_tracked.at(const_cast<MobilityModel*>(PeekPointer(mobility)));
+    tracked.speed = mobility->GetVelocity().GetLength();
+    m_maxSpeed = std::max(m_maxSpeed, tracked.speed);
+    for (uint32_t id : tracked.ids)
+    {
+        Unbin(id);
+        Bin(id);
+    }
+}
+
+void
+SpatialGrid::Refresh()
+{
+    Time now = Simulator::Now();
+    if (m_maxSpeed * (now - m_lastRefresh).GetSeconds() <= m_cellSize / 2)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+    m_maxSpeed = 0;
+    for (const auto& [mobility, tracked] : m_tracked)
+    {
+        if (tracked.speed > 0)
+        {
+            for (uint32_t id : tracked.ids)
+            {
+                Unbin(id);
+                Bin(id);
+            }
+            m_maxSpeed = std::max(m_maxSpeed, tracked.speed);
+        }
+    }
+    m_lastRefresh = now;
+}
+
+} // namespace ns3
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "mobility-model.h"
+
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/vector.h"
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup mobility
+ * \brief Uniform grid of mobility models, to find those within range of a position
+ *
+ * The channels which deliver each transmission to all their receivers
+ * can instead ask the grid for the receivers within their maximum range,
+ * at the cost of the neighbors of the transmitter rather than of all the
+ * receivers.
+ *
+ * The entries, each identified by an id chosen by the user of the grid,
+ * are binned into square cells by their horizontal position.  An entry
+ * is moved to its new cell on the course changes of its mobility model.
+ * The models which move between course changes, at the velocity of their
+ * last course change, are binned again lazily, when the distance that the
+ * fastest of them may have covered since they were last binned exceeds
+ * half a cell; the cells searched are extended by that distance in the
+ * meantime.  This assumes that the velocity of the models only changes
+ * with a course change, which holds for the models of ns-3 except the
+ * ConstantAccelerationMobilityModel.
+ *
+ * The entries without mobility model are always within range.
+ */
+class SpatialGrid : public SimpleRefCount<SpatialGrid>
+{
+  public:
+    /**
+     * \param cellSize The size of the cells, in meters, which is best set
+     * to the range of the queries.
+     */
+    SpatialGrid(double cellSize);
+    ~SpatialGrid();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    SpatialGrid(const SpatialGrid&) = delete;
+    SpatialGrid& operator=(const SpatialGrid&) = delete;
+
+    /**
+     * \brief Add an entry, or move an existing entry to a new mobility model.
+     *
+     * \param id The id of the entry.
+     * \param mobility The mobility model of the entry, or nullptr.
+     */
+    void Add(uint32_t id, Ptr<MobilityModel> mobility);
+    /**
+     * \brief Remove an entry, if present.
+     * \param id The id of the entry.
+     */
+    void Remove(uint32_t id);
+    /**
+     * \returns The number of entries.
+     */
+    std::size_t GetN() const;
+
+    /**
+     * \brief Get the entries within range of a position.
+     *
+     * \param position The position.
+     * \param range The range, in meters.
+     * \param [out] ids The ids of the entries within range, in increasing
+     * order, including the entries without mobility model.
+     */
+    void GetWithinRange(const Vector& position, double range, std::vector<uint32_t>& ids);
+
+  private:
+    /// An entry of the grid
+    struct Entry
+    {
+        Ptr<MobilityModel> mobility; //!< The mobility model, or nullptr
+        int64_t cell;                //!< The cell of the entry
+        std::size_t slot;            //!< The index of the entry in its cell
+    };
+
+    /// The entries which share a mobility model
+    struct Tracked
+    {
+        std::vector<uint32_t> ids; //!< The ids of the entries
+        double speed;              //!< The speed at the last course change
+    };
+
+    /**
+     * \param x The horizontal coordinate of the cell.
+     * \param y The vertical coordinate of the cell.
+     * \returns The key of the cell.
+     */
+    static int64_t GetCell(int64_t x, int64_t y);
+    /**
+     * \param coordinate A coordinate, in meters.
+     * \returns The coordinate of the cell which contains it.
+     */
+    int64_t GetCellCoordinate(double coordinate) const;
+    /**
+     * \brief Put an entry in the cell of its current position.
+     * \param id The id of the entry.
+     */
+    void Bin(uint32_t id);
+    /**
+     * \brief Remove an entry from its cell.
+     * \param id The id of the entry.
+     */
+    void Unbin(uint32_t id);
+    /**
+     * \brief Bin again the entries of a mobility model.
+     * \param mobility The mobility model whose course changed.
+     */
+    void CourseChanged(Ptr<const MobilityModel> mobility);
+    /**
+     * \brief Bin again the moving entries, if they may have moved by half
+     * a cell since they were last binned.
+     */
+    void Refresh();
+
+    double m_cellSize;                                          //!< The size of the cells
+    std::unordered_map<uint32_t, Entry> m_entries;              //!< The entries, by id
+    std::unordered_map<int64_t, std::vector<uint32_t>> m_cells; //!< The ids of the entries, by cell
+    std::unordered_map<MobilityModel*, Tracked> m_tracked;      //!< The mobility models tracked
+    std::vector<uint32_t> m_unlocated;                          //!< The entries without mobility
+    double m_maxSpeed;                                          //!< The max speed of the models
+    Time m_lastRefresh;                                         //!< The last refresh of the bins
+};
+
+} // namespace ns3
+
+#endif /* SPATIAL_GRID_H */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/simulator.h"
+#include "ns3/spatial-grid.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Spatial grid test: the entries within range, found by the grid,
+ * are those found by checking all the entries, while static and moving
+ * entries are added, moved and removed.
+ */
+class SpatialGridTestCase : public TestCase
+{
+  public:
+    SpatialGridTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Compare the entries within range found by the grid to those of all the entries
+    void CheckWithinRange();
+    /// Move and remove some entries
+    void ChangeCourses();
+
+    Ptr<SpatialGrid> m_grid;                                //!< The grid
+    std::vector<Ptr<ConstantVelocityMobilityModel>> m_mobs; //!< The mobility models, by id
+    std::vector<bool> m_present;                            //!< Whether the ids are in the grid
+    uint32_t m_queries;                                     //!< The number of queries checked
+};
+
+SpatialGridTestCase::SpatialGridTestCase()
+    : TestCase("Check the entries within range of the spatial grid"),
+      m_queries(0)
+{
+}
+
+void
+SpatialGridTestCase::CheckWithinRange()
+{
+    const double range = 100;
+    std::vector<uint32_t> ids;
+    for (uint32_t tx = 0; tx < m_mobs.size(); tx += 7)
+    {
+        Vector position = m_mobs[tx]->GetPosition();
+        m_grid->GetWithinRange(position, range, ids);
+
+        std::vector<uint32_t> expected;
+        for (uint32_t id = 0; id < m_mobs.size(); ++id)
+        {
+            if (m_present[id] && CalculateDistance(position, m_mobs[id]->GetPosition()) <= range)
+            {
+                expected.push_back(id);
+            }
+        }
+        // the entry without mobility model is always within range
+        expected.push_back(m_mobs.size());
+        NS_TEST_EXPECT_MSG_EQ((ids == expected), true, "Unexpected entries within range");
+        m_queries++;
+    }
+}
+
+void
+SpatialGridTestCase::ChangeCourses()
+{
+    for (uint32_t id = 0; id < m_mobs.size(); id += 5)
+    {
+        m_mobs[id]->SetPosition(Vector(1000 - id * 3.0, id * 2.0, 0));
+        m_mobs[id]->SetVelocity(Vector(-30, 10, 0));
+    }
+    for (uint32_t id = 1; id < m_mobs.size(); id += 11)
+    {
+        m_grid->Remove(id);
+        m_present[id] = false;
+    }
+}
+
+void
+SpatialGridTestCase::DoRun()
+{
+    m_grid = Create<SpatialGrid>(100);
+    for (uint32_t id = 0; id < 300; ++id)
+    {
+        Ptr<ConstantVelocityMobilityModel> mob = CreateObject<ConstantVelocityMobilityModel>();
+        mob->SetPosition(Vector((id * 389) % 1000, (id * 211) % 1000, 0));
+        if (id % 2 == 0)
+        {
+            mob->SetVelocity(Vector(20, (id % 3) * 5.0, 0));
+        }
+        m_mobs.push_back(mob);
+        m_present.push_back(true);
+        m_grid->Add(id, mob);
+    }
+    m_grid->Add(m_mobs.size(), nullptr);
+    NS_TEST_EXPECT_MSG_EQ(m_grid->GetN(), 301, "Unexpected number of entries");
+
+    for (double t : {0.0, 1.0, 2.5, 6.0, 11.0, 30.0})
+    {
+        Simulator::Schedule(Seconds(t), &SpatialGridTestCase::CheckWithinRange, this);
+    }
+    Simulator::Schedule(Seconds(10), &SpatialGridTestCase::ChangeCourses, this);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_EXPECT_MSG_EQ(m_queries, 6 * 43, "Unexpected number of queries");
+    NS_TEST_EXPECT_MSG_EQ(m_grid->GetN(), 301 - 28, "Unexpected number of entries");
+    m_grid = nullptr;
+    m_mobs.clear();
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Spatial grid TestSuite
+ */
+class SpatialGridTestSuite : public TestSuite
+{
+  public:
+    SpatialGridTestSuite()
+        : TestSuite("spatial-grid", UNIT)
+    {
+        AddTestCase(new SpatialGridTestCase(), TestCase::QUICK);
+    }
+};
+
+static SpatialGridTestSuite g_spatialGridTestSuite; //!< Static variable for test initialization
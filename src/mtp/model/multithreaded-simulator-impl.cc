@@ -0,0 +1,902 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/channel.h"
+#include "ns3/log.h"
+#include "ns3/net-device.h"
+#include "ns3/node-list.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+/**
+ * \file
+ * \ingroup mtp
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3
+{
+
+// Note: as in the DefaultSimulatorImpl, logging is avoided on the
+// per-event paths.
+NS_LOG_COMPONENT_DEFINE("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED(MultithreadedSimulatorImpl);
+
+namespace
+{
+
+/**
+ * The LP whose events the calling thread is processing, or \c nullptr
+ * when the calling thread is not processing a window.
+ */
+thread_local void* t_currentLp = nullptr;
+
+/** Number of times an idle worker polls for a new window before blocking. */
+const uint32_t SPIN_LIMIT = 1000;
+
+/** Timestep standing for "no event". */
+const uint64_t NO_EVENT = std::numeric_limits<uint64_t>::max();
+
+/**
+ * Find the representative of a node in a union-find forest.
+ *
+ * \param [in,out] parent The forest.
+ * \param [in] i The node.
+ * \returns The representative of the set of \pname{i}.
+ */
+uint32_t
+FindSet(std::vector<uint32_t>& parent, uint32_t i)
+{
+    while (parent[i] != i)
+    {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+} // unnamed namespace
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::MultithreadedSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Mtp")
+            .AddConstructor<MultithreadedSimulatorImpl>()
+            .AddAttribute("MaxThreads",
+                          "The maximum number of threads processing the LPs, "
+                          "including the main thread; 0 to use all hardware threads",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&MultithreadedSimulatorImpl::m_maxThreads),
+                          MakeUintegerChecker<uint32_t>());
+    return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl()
+    : m_eventsWithContext(EVENTS_WITH_CONTEXT_CAPACITY)
+{
+    NS_LOG_FUNCTION(this);
+    m_eventsWithContextOverflowing = false;
+    m_mainThreadId = std::this_thread::get_id();
+    m_stop = false;
+    m_partitioned = false;
+    m_lookAhead = GetMaximumSimulationTime();
+    m_maxThreads = 0;
+    m_windowEnd = 0;
+    m_nextActive = 0;
+    m_busyThreads = 0;
+    m_generation = 0;
+    m_workersExit = false;
+    m_sleepingWorkers = 0;
+
+    // The global LP
+    auto lp = std::make_unique<LogicalProcess>();
+    lp->index = 0;
+    lp->uid = EventId::UID::VALID;
+    lp->currentUid = EventId::UID::INVALID;
+    lp->currentTs = 0;
+    lp->currentContext = Simulator::NO_CONTEXT;
+    lp->eventCount = 0;
+    lp->packetUid = 0;
+    lp->unscheduledEvents = 0;
+    m_lps.push_back(std::move(lp));
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    StopWorkers();
+    ProcessEventsWithContext();
+    for (auto& lp : m_lps)
+    {
+        for (auto& message : lp->outbox)
+        {
+            message.ev.impl->Unref();
+        }
+        lp->outbox.clear();
+        while (lp->events && !lp->events->IsEmpty())
+        {
+            Scheduler::Event next = lp->events->RemoveNext();
+            next.impl->Unref();
+        }
+        lp->events = nullptr;
+    }
+    SimulatorImpl::DoDispose();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+    while (!m_destroyEvents.empty())
+    {
+        Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
+        m_destroyEvents.pop_front();
+        NS_LOG_LOGIC("handle destroy " << ev);
+        if (!ev->IsCancelled())
+        {
+            ev->Invoke();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    m_schedulerFactory = schedulerFactory;
+    for (auto& lp : m_lps)
+    {
+        Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler>();
+        if (lp->events)
+        {
+            while (!lp->events->IsEmpty())
+            {
+                scheduler->Insert(lp->events->RemoveNext());
+            }
+        }
+        lp->events = scheduler;
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsSimulationThread() const
+{
+    return t_currentLp != nullptr || m_mainThreadId == std::this_thread::get_id();
+}
+
+bool
+MultithreadedSimulatorImpl::CanAccess(const LogicalProcess* lp, bool readOnly) const
+{
+    if (t_currentLp == nullptr)
+    {
+        return m_mainThreadId == std::this_thread::get_id();
+    }
+    return lp == t_currentLp || (readOnly && lp == m_lps[0].get());
+}
+
+void
+MultithreadedSimulatorImpl::ProcessEventsWithContext()
+{
+    // Other threads do not know the time of the LPs: the delay is
+    // relative to the latest time reached by any LP, so that the event
+    // is not in the past of any of them.
+    uint64_t now = 0;
+    bool nowKnown = false;
+    auto insert = [this, &now, &nowKnown](const EventWithContext& event) {
+        if (!nowKnown)
+        {
+            for (const auto& lp : m_lps)
+            {
+                now = std::max(now, lp->currentTs);
+            }
+            nowKnown = true;
+        }
+        Scheduler::Event ev;
+        ev.impl = event.event;
+        ev.key.m_ts = now + event.timestamp;
+        ev.key.m_context = event.context;
+        Insert(GetLogicalProcess(event.context), ev);
+    };
+
+    // drain the lock-free queue in one batch
+    EventWithContext event;
+    while (m_eventsWithContext.TryPop(event))
+    {
+        insert(event);
+    }
+
+    // As in the DefaultSimulatorImpl, the overflow list must wait until
+    // the queue is fully drained.
+    if (!m_eventsWithContextOverflowing.load(std::memory_order_acquire) ||
+        !m_eventsWithContext.IsEmpty())
+    {
+        return;
+    }
+
+    EventsWithContext eventsWithContext;
+    {
+        std::unique_lock lock{m_eventsWithContextMutex};
+        m_eventsWithContextOverflow.swap(eventsWithContext);
+        m_eventsWithContextOverflowing.store(false, std::memory_order_release);
+    }
+    for (const auto& ev : eventsWithContext)
+    {
+        insert(ev);
+    }
+}
+
+MultithreadedSimulatorImpl::LogicalProcess*
+MultithreadedSimulatorImpl::GetCurrent() const
+{
+    if (t_currentLp != nullptr)
+    {
+        return static_cast<LogicalProcess*>(t_currentLp);
+    }
+    return m_lps[0].get();
+}
+
+MultithreadedSimulatorImpl::LogicalProcess*
+MultithreadedSimulatorImpl::GetLogicalProcess(uint32_t context) const
+{
+    if (context < m_lpOfNode.size())
+    {
+        return m_lps[m_lpOfNode[context]].get();
+    }
+    return m_lps[0].get();
+}
+
+void
+MultithreadedSimulatorImpl::Insert(LogicalProcess* lp, Scheduler::Event& ev)
+{
+    ev.key.m_uid = lp->uid;
+    lp->uid++;
+    lp->unscheduledEvents++;
+    lp->events->Insert(ev);
+}
+
+uint64_t
+MultithreadedSimulatorImpl::NextTs(const LogicalProcess* lp) const
+{
+    if (lp->events->IsEmpty())
+    {
+        return NO_EVENT;
+    }
+    return lp->events->PeekNext().key.m_ts;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessOneEvent(LogicalProcess* lp)
+{
+    Scheduler::Event next = lp->events->RemoveNext();
+
+    PreEventHook(EventId(next.impl, next.key.m_ts, next.key.m_context, next.key.m_uid));
+
+    NS_ASSERT(next.key.m_ts >= lp->currentTs);
+    lp->unscheduledEvents--;
+    lp->eventCount++;
+
+    lp->currentTs = next.key.m_ts;
+    lp->currentContext = next.key.m_context;
+    lp->currentUid = next.key.m_uid;
+    next.impl->Invoke();
+    next.impl->Unref();
+}
+
+void
+MultithreadedSimulatorImpl::Partition()
+{
+    NS_LOG_FUNCTION(this);
+    m_partitioned = true;
+
+    // Nodes which share a channel belong to the same LP, unless the
+    // channel is a point-to-point link with a positive delay.
+    uint32_t nNodes = NodeList::GetNNodes();
+    std::vector<uint32_t> parent(nNodes);
+    std::iota(parent.begin(), parent.end(), 0);
+    struct Link
+    {
+        uint32_t a; //!< Id of one end of the link.
+        uint32_t b; //!< Id of the other end of the link.
+        Time delay; //!< Delay of the link.
+    };
+
+    std::vector<Link> links;
+    for (auto node = NodeList::Begin(); node != NodeList::End(); ++node)
+    {
+        uint32_t id = (*node)->GetId();
+        for (uint32_t i = 0; i < (*node)->GetNDevices(); ++i)
+        {
+            Ptr<NetDevice> device = (*node)->GetDevice(i);
+            Ptr<Channel> channel = device->GetChannel();
+            if (!channel)
+            {
+                continue;
+            }
+            TimeValue delay;
+            bool cut = device->IsPointToPoint() && channel->GetNDevices() == 2 &&
+                       channel->GetAttributeFailSafe("Delay", delay) &&
+                       delay.Get().IsStrictlyPositive();
+            for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
+            {
+                uint32_t other = channel->GetDevice(j)->GetNode()->GetId();
+                if (other >= nNodes || other == id)
+                {
+                    continue;
+                }
+                if (cut)
+                {
+                    links.push_back({id, other, delay.Get()});
+                }
+                else
+                {
+                    parent[FindSet(parent, id)] = FindSet(parent, other);
+                }
+            }
+        }
+    }
+
+    // Number the LPs in the order of their first node, so that the
+    // partition only depends on the topology.
+    std::vector<uint32_t> lpOfSet(nNodes, 0);
+    m_lpOfNode.assign(nNodes, 0);
+    for (uint32_t id = 0; id < nNodes; ++id)
+    {
+        uint32_t set = FindSet(parent, id);
+        if (lpOfSet[set] == 0)
+        {
+            auto lp = std::make_unique<LogicalProcess>();
+            lp->index = m_lps.size();
+            lp->events = m_schedulerFactory.Create<Scheduler>();
+            lp->uid = m_lps[0]->uid;
+            lp->currentUid = EventId::UID::INVALID;
+            lp->currentTs = m_lps[0]->currentTs;
+            lp->currentContext = Simulator::NO_CONTEXT;
+            lp->eventCount = 0;
+            lp->packetUid = 0;
+            lp->unscheduledEvents = 0;
+            lpOfSet[set] = lp->index;
+            m_lps.push_back(std::move(lp));
+        }
+        m_lpOfNode[id] = lpOfSet[set];
+    }
+
+    for (const auto& link : links)
+    {
+        if (m_lpOfNode[link.a] != m_lpOfNode[link.b])
+        {
+            m_lookAhead = Min(m_lookAhead, link.delay);
+        }
+    }
+    NS_LOG_INFO(nNodes << " nodes in " << m_lps.size() - 1 << " LPs, lookahead " << m_lookAhead);
+
+    // Move the events scheduled so far to the LP of their context,
+    // keeping their uid so that their EventIds remain valid.
+    LogicalProcess* global = m_lps[0].get();
+    Ptr<Scheduler> events = m_schedulerFactory.Create<Scheduler>();
+    while (!global->events->IsEmpty())
+    {
+        Scheduler::Event ev = global->events->RemoveNext();
+        LogicalProcess* lp = GetLogicalProcess(ev.key.m_context);
+        if (lp == global)
+        {
+            events->Insert(ev);
+        }
+        else
+        {
+            global->unscheduledEvents--;
+            lp->unscheduledEvents++;
+            lp->events->Insert(ev);
+        }
+    }
+    global->events = events;
+}
+
+void
+MultithreadedSimulatorImpl::StartWorkers()
+{
+    NS_LOG_FUNCTION(this);
+    uint32_t threads = m_maxThreads;
+    if (threads == 0)
+    {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    // No point in having more threads than node LPs
+    threads = std::min<std::size_t>(threads, m_lps.size() - 1);
+    m_workersExit = false;
+    for (uint32_t i = 1; i < threads; ++i)
+    {
+        m_workers.emplace_back(&MultithreadedSimulatorImpl::WorkerLoop, this);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::StopWorkers()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_workers.empty())
+    {
+        return;
+    }
+    m_workersExit = true;
+    m_generation++;
+    if (m_sleepingWorkers > 0)
+    {
+        std::unique_lock lock{m_wakeUpMutex};
+        m_wakeUp.notify_all();
+    }
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+    m_workers.clear();
+}
+
+void
+MultithreadedSimulatorImpl::WorkerLoop()
+{
+    uint64_t seen = 0;
+    while (true)
+    {
+        // Wait for the next window: poll for a while, since windows are
+        // often short, then block.
+        uint32_t spins = 0;
+        while (m_generation.load(std::memory_order_acquire) == seen && spins < SPIN_LIMIT)
+        {
+            std::this_thread::yield();
+            spins++;
+        }
+        if (m_generation.load(std::memory_order_acquire) == seen)
+        {
+            std::unique_lock lock{m_wakeUpMutex};
+            m_sleepingWorkers++;
+            m_wakeUp.wait(lock, [this, seen]() { return m_generation.load() != seen; });
+            m_sleepingWorkers--;
+        }
+        seen = m_generation.load(std::memory_order_acquire);
+        if (m_workersExit)
+        {
+            return;
+        }
+        ProcessActiveLogicalProcesses();
+        m_busyThreads.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessActiveLogicalProcesses()
+{
+    while (true)
+    {
+        std::size_t i = m_nextActive.fetch_add(1, std::memory_order_relaxed);
+        if (i >= m_active.size())
+        {
+            return;
+        }
+        LogicalProcess* lp = m_active[i];
+        t_currentLp = lp;
+        // the uids of the packets only depend on the order of the events of the LP
+        Packet::SetThreadUidCounter(lp->index, &lp->packetUid);
+        while (!lp->events->IsEmpty() && lp->events->PeekNext().key.m_ts < m_windowEnd)
+        {
+            ProcessOneEvent(lp);
+        }
+        Packet::SetThreadUidCounter(0, nullptr);
+        t_currentLp = nullptr;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow(uint64_t windowEnd)
+{
+    m_windowEnd = windowEnd;
+    m_active.clear();
+    for (std::size_t i = 1; i < m_lps.size(); ++i)
+    {
+        if (NextTs(m_lps[i].get()) < windowEnd)
+        {
+            m_active.push_back(m_lps[i].get());
+        }
+    }
+    m_nextActive = 0;
+
+    if (m_workers.empty() || m_active.size() == 1)
+    {
+        ProcessActiveLogicalProcesses();
+        return;
+    }
+
+    m_busyThreads = m_workers.size() + 1;
+    // sequentially consistent, as a worker which goes to sleep increments
+    // m_sleepingWorkers then reads m_generation: one of them must see the
+    // other's increment, or the worker is never woken up
+    m_generation.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleepingWorkers > 0)
+    {
+        std::unique_lock lock{m_wakeUpMutex};
+        m_wakeUp.notify_all();
+    }
+    ProcessActiveLogicalProcesses();
+    m_busyThreads.fetch_sub(1, std::memory_order_acq_rel);
+    // barrier
+    while (m_busyThreads.load(std::memory_order_acquire) != 0)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::DeliverMessages()
+{
+    for (auto& lp : m_lps)
+    {
+        for (auto& message : lp->outbox)
+        {
+            Insert(m_lps[message.lp].get(), message.ev);
+        }
+        lp->outbox.clear();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished() const
+{
+    if (m_stop)
+    {
+        return true;
+    }
+    for (const auto& lp : m_lps)
+    {
+        if (!lp->events->IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+MultithreadedSimulatorImpl::Run()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_partitioned)
+    {
+        Partition();
+    }
+    m_mainThreadId = std::this_thread::get_id();
+    m_stop = false;
+    StartWorkers();
+
+    LogicalProcess* global = m_lps[0].get();
+    uint64_t lookAhead = m_lookAhead.GetTimeStep();
+    while (!m_stop)
+    {
+        ProcessEventsWithContext();
+        uint64_t nextGlobal = NextTs(global);
+        uint64_t nextLocal = NO_EVENT;
+        for (std::size_t i = 1; i < m_lps.size(); ++i)
+        {
+            nextLocal = std::min(nextLocal, NextTs(m_lps[i].get()));
+        }
+        if (nextGlobal == NO_EVENT && nextLocal == NO_EVENT)
+        {
+            break;
+        }
+        if (nextGlobal <= nextLocal)
+        {
+            // Global events may access any node: process them alone,
+            // before the events of the node LPs at the same time.
+            ProcessOneEvent(global);
+            continue;
+        }
+        uint64_t windowEnd = nextGlobal;
+        if (nextLocal < NO_EVENT - lookAhead)
+        {
+            windowEnd = std::min(windowEnd, nextLocal + lookAhead);
+        }
+        ProcessWindow(windowEnd);
+        DeliverMessages();
+    }
+
+    StopWorkers();
+
+    // Leave the clock of the main thread at the latest processed event.
+    for (const auto& lp : m_lps)
+    {
+        global->currentTs = std::max(global->currentTs, lp->currentTs);
+    }
+
+    // If the simulator stopped naturally by lack of events, make a
+    // consistency test to check that we didn't lose any events along the way.
+    NS_ASSERT(!IsFinished() || m_stop ||
+              std::all_of(m_lps.begin(), m_lps.end(), [](const auto& lp) {
+                  return lp->unscheduledEvents == 0;
+              }));
+}
+
+void
+MultithreadedSimulatorImpl::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    m_stop = true;
+}
+
+void
+MultithreadedSimulatorImpl::Stop(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep());
+    Simulator::Schedule(delay, &Simulator::Stop);
+}
+
+EventId
+MultithreadedSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    NS_ASSERT_MSG(IsSimulationThread(), "Simulator::Schedule Thread-unsafe invocation!");
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+    LogicalProcess* lp = GetCurrent();
+    Time tAbsolute = delay + TimeStep(lp->currentTs);
+
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = (uint64_t)tAbsolute.GetTimeStep();
+    ev.key.m_context = lp->currentContext;
+    Insert(lp, ev);
+    return EventId(event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                const Time& delay,
+                                                EventImpl* event)
+{
+    if (!IsSimulationThread())
+    {
+        EventWithContext ev;
+        ev.context = context;
+        // Current time added in ProcessEventsWithContext()
+        ev.timestamp = delay.GetTimeStep();
+        ev.event = event;
+        if (m_eventsWithContextOverflowing.load(std::memory_order_acquire) ||
+            !m_eventsWithContext.TryPush(ev))
+        {
+            std::unique_lock lock{m_eventsWithContextMutex};
+            m_eventsWithContextOverflow.push_back(ev);
+            m_eventsWithContextOverflowing.store(true, std::memory_order_release);
+        }
+        return;
+    }
+
+    LogicalProcess* lp = GetCurrent();
+    LogicalProcess* target = GetLogicalProcess(context);
+    Time tAbsolute = delay + TimeStep(lp->currentTs);
+
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = (uint64_t)tAbsolute.GetTimeStep();
+    ev.key.m_context = context;
+    if (target == lp || t_currentLp == nullptr)
+    {
+        // Same LP, or no window being processed: no other thread can
+        // access the event list of the target.
+        Insert(target, ev);
+        return;
+    }
+    NS_ABORT_MSG_IF(ev.key.m_ts < m_windowEnd,
+                    "Event for context " << context << " at " << tAbsolute
+                                         << " breaks the lookahead of " << m_lookAhead
+                                         << "; use BoundLookAhead()");
+    lp->outbox.push_back({target->index, ev});
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    return Schedule(Time(0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy(EventImpl* event)
+{
+    NS_ASSERT_MSG(IsSimulationThread(), "Simulator::ScheduleDestroy Thread-unsafe invocation!");
+    EventId id(Ptr<EventImpl>(event, false), GetCurrent()->currentTs, 0xffffffff, 2);
+    std::unique_lock lock{m_destroyEventsMutex};
+    m_destroyEvents.push_back(id);
+    return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now() const
+{
+    // Do not add function logging here, to avoid stack overflow
+    return TimeStep(GetCurrent()->currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft(const EventId& id) const
+{
+    if (IsExpired(id))
+    {
+        return TimeStep(0);
+    }
+    else
+    {
+        return TimeStep(id.GetTs() - GetCurrent()->currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove(const EventId& id)
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        // destroy events.
+        std::unique_lock lock{m_destroyEventsMutex};
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                m_destroyEvents.erase(i);
+                break;
+            }
+        }
+        return;
+    }
+    if (IsExpired(id))
+    {
+        return;
+    }
+    LogicalProcess* lp = GetLogicalProcess(id.GetContext());
+    NS_ASSERT_MSG(CanAccess(lp, false), "Cannot remove an event of another LP");
+    Scheduler::Event event;
+    event.impl = id.PeekEventImpl();
+    event.key.m_ts = id.GetTs();
+    event.key.m_context = id.GetContext();
+    event.key.m_uid = id.GetUid();
+    lp->events->Remove(event);
+    event.impl->Cancel();
+    // whenever we remove an event from the event list, we have to unref it.
+    event.impl->Unref();
+
+    lp->unscheduledEvents--;
+}
+
+void
+MultithreadedSimulatorImpl::Cancel(const EventId& id)
+{
+    NS_ASSERT_MSG(id.PeekEventImpl() == nullptr || id.GetUid() == EventId::UID::DESTROY ||
+                      CanAccess(GetLogicalProcess(id.GetContext()), false),
+                  "Cannot cancel an event of another LP");
+    if (!IsExpired(id))
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired(const EventId& id) const
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+        {
+            return true;
+        }
+        // destroy events.
+        std::unique_lock lock{m_destroyEventsMutex};
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (id.PeekEventImpl() == nullptr)
+    {
+        return true;
+    }
+    const LogicalProcess* lp = GetLogicalProcess(id.GetContext());
+    NS_ASSERT_MSG(CanAccess(lp, true), "Cannot access an event of another LP");
+    if (id.GetTs() < lp->currentTs ||
+        (id.GetTs() == lp->currentTs && id.GetUid() <= lp->currentUid) ||
+        id.PeekEventImpl()->IsCancelled())
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime() const
+{
+    return TimeStep(0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId() const
+{
+    return 0;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext() const
+{
+    return GetCurrent()->currentContext;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount() const
+{
+    uint64_t count = 0;
+    for (const auto& lp : m_lps)
+    {
+        count += lp->eventCount;
+    }
+    return count;
+}
+
+void
+MultithreadedSimulatorImpl::BoundLookAhead(const Time lookAhead)
+{
+    if (lookAhead.IsStrictlyPositive())
+    {
+        NS_LOG_FUNCTION(this << lookAhead);
+        m_lookAhead = Min(m_lookAhead, lookAhead);
+    }
+    else
+    {
+        NS_LOG_WARN("attempted to set lookahead to a non-positive time: " << lookAhead);
+    }
+}
+
+Time
+MultithreadedSimulatorImpl::GetLookAhead() const
+{
+    return m_lookAhead;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetLogicalProcessCount() const
+{
+    return m_lps.size() - 1;
+}
+
+} // namespace ns3
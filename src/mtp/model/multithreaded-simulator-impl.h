@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_MULTITHREADED_SIMULATOR_IMPL_H
+#define NS3_MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "ns3/event-impl.h"
+#include "ns3/mpsc-queue.h"
+#include "ns3/object-factory.h"
+#include "ns3/ptr.h"
+#include "ns3/scheduler.h"
+#include "ns3/simulator-impl.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mtp
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup simulator
+ * \ingroup mtp
+ * \brief Conservative parallel simulator implementation using threads
+ * of a single process.
+ *
+ * When Run() is first called, the nodes are partitioned into logical
+ * processes (LPs): nodes connected by a point-to-point link with a
+ * positive \c Delay attribute may belong to different LPs, all other
+ * nodes sharing a channel belong to the same LP. Each LP has its own
+ * event list, and the events of a node, identified by the node id
+ * used as the event context, are processed by the LP of that node.
+ * Events without a node context belong to a global LP.
+ *
+ * As in the DistributedSimulatorImpl, the lookahead is the smallest
+ * delay of the point-to-point links between different LPs, and may be
+ * further constrained with BoundLookAhead(). The simulation advances
+ * in time windows: if the earliest pending event of the node LPs is at
+ * time \f$t\f$, all the events before \f$t + lookahead\f$ (and before the
+ * next global event) are processed in parallel by a pool of threads,
+ * which then synchronize at a barrier. Events scheduled for a different
+ * LP are buffered by the sender and delivered at the barrier, in LP
+ * order, so the outcome of a simulation does not depend on the number
+ * of threads or on their timing. Global events are processed by the
+ * main thread alone, while all other LPs are waiting.
+ *
+ * This implementation is only available when ns-3 is built with
+ * multithreaded parallel simulation support (\c NS3_MTP), which makes
+ * reference counts and the internal storage of packets safe to share
+ * between threads. Models used in the simulation must not share other
+ * mutable state between nodes of different LPs; in particular, trace
+ * sinks connected to several nodes may be called concurrently.
+ *
+ * Simultaneous events of different LPs are not ordered as with the
+ * DefaultSimulatorImpl.
+ *
+ * The simulation threads are the thread which calls Run(), and the
+ * worker threads while they process the events of an LP. Only
+ * ScheduleWithContext() may be called from other threads: such events
+ * go through a lock-free queue, and are inserted by the main thread
+ * between windows, relative to the latest time reached by any LP.
+ * During a window, Remove() and Cancel() only accept the events of
+ * the LP of the calling thread, and IsExpired() and GetDelayLeft()
+ * also accept the events of the global LP, which are not processed
+ * during windows.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Default constructor. */
+    MultithreadedSimulatorImpl();
+    /** Destructor. */
+    ~MultithreadedSimulatorImpl() override;
+
+    // Inherited
+    void Destroy() override;
+    bool IsFinished() const override;
+    void Stop() override;
+    void Stop(const Time& delay) override;
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    EventId ScheduleDestroy(EventImpl* event) override;
+    void Remove(const EventId& id) override;
+    void Cancel(const EventId& id) override;
+    bool IsExpired(const EventId& id) const override;
+    void Run() override;
+    Time Now() const override;
+    Time GetDelayLeft(const EventId& id) const override;
+    Time GetMaximumSimulationTime() const override;
+    void SetScheduler(ObjectFactory schedulerFactory) override;
+    uint32_t GetSystemId() const override;
+    uint32_t GetContext() const override;
+    uint64_t GetEventCount() const override;
+
+    /**
+     * Add additional bound to lookahead constraints.
+     * This may be used if models exchange events between nodes of
+     * different LPs through other means than point-to-point links.
+     * The method may be invoked more than once, the minimum time will
+     * be used to constrain lookahead.
+     * \param [in] lookAhead The maximum lookahead; must be > 0.
+     */
+    void BoundLookAhead(const Time lookAhead);
+
+    /**
+     * Get the lookahead.
+     * Before the first call to Run(), this is only the bound set by
+     * BoundLookAhead().
+     * \returns The lookahead.
+     */
+    Time GetLookAhead() const;
+
+    /**
+     * Get the number of LPs the nodes were partitioned into, not
+     * counting the global LP.
+     * \returns The number of LPs, zero before the first call to Run().
+     */
+    uint32_t GetLogicalProcessCount() const;
+
+  private:
+    // Inherited from Object
+    void DoDispose() override;
+
+    /** An event scheduled for a different LP, delivered at the barrier. */
+    struct Message
+    {
+        uint32_t lp;         //!< Index of the destination LP.
+        Scheduler::Event ev; //!< The event; the uid is set at delivery.
+    };
+
+    /** A logical process: an event list and the state of its current event. */
+    struct LogicalProcess
+    {
+        /** Index of this LP in m_lps. */
+        uint32_t index;
+        /** The event priority queue. */
+        Ptr<Scheduler> events;
+        /** Next event unique id. */
+        uint32_t uid;
+        /** Unique id of the current event. */
+        uint32_t currentUid;
+        /** Timestamp of the current event. */
+        uint64_t currentTs;
+        /** Execution context of the current event. */
+        uint32_t currentContext;
+        /** The event count. */
+        uint64_t eventCount;
+        /** Next packet uid, below the index of the LP in the upper bits. */
+        uint32_t packetUid;
+        /**
+         * Number of events that have been inserted but not yet scheduled,
+         * not counting the Destroy events; this is used for validation
+         */
+        int unscheduledEvents;
+        /** Events scheduled for other LPs during the current window. */
+        std::vector<Message> outbox;
+    };
+
+    /**
+     * Check whether the calling thread is a simulation thread.
+     * \returns \c true if the calling thread is the main thread, or a
+     *          worker thread processing the events of an LP.
+     */
+    bool IsSimulationThread() const;
+    /**
+     * Check whether the calling thread may access the events of an LP.
+     * \param [in] lp The LP.
+     * \param [in] readOnly Whether the events are only read.
+     * \returns \c true if no window is being processed by the calling
+     *          thread, or if \pname{lp} is the LP of the calling thread,
+     *          or if \pname{readOnly} and \pname{lp} is the global LP.
+     */
+    bool CanAccess(const LogicalProcess* lp, bool readOnly) const;
+    /**
+     * Insert the events scheduled from threads other than the simulation
+     * threads, from the main thread, while no window is being processed.
+     */
+    void ProcessEventsWithContext();
+    /**
+     * Get the LP of the calling thread.
+     * \returns The LP of the event being processed by the calling thread,
+     *          or the global LP.
+     */
+    LogicalProcess* GetCurrent() const;
+    /**
+     * Get the LP which processes the events of a context.
+     * \param [in] context The context.
+     * \returns The LP.
+     */
+    LogicalProcess* GetLogicalProcess(uint32_t context) const;
+    /**
+     * Insert an event in the event list of an LP.
+     * \param [in] lp The LP.
+     * \param [in] ev The event, whose uid is set by this method.
+     */
+    void Insert(LogicalProcess* lp, Scheduler::Event& ev);
+    /**
+     * Get the timestep of the next event of an LP.
+     * \param [in] lp The LP.
+     * \returns The next event timestep, or the maximum timestep if
+     *          the LP has no events.
+     */
+    uint64_t NextTs(const LogicalProcess* lp) const;
+    /**
+     * Process the next event of an LP.
+     * \param [in] lp The LP.
+     */
+    void ProcessOneEvent(LogicalProcess* lp);
+
+    /**
+     * Partition the nodes into LPs, compute the lookahead, and move the
+     * events scheduled so far to their LP.
+     */
+    void Partition();
+    /** Start the worker threads. */
+    void StartWorkers();
+    /** Stop the worker threads. */
+    void StopWorkers();
+    /**
+     * Process the events of the node LPs before the end of a window,
+     * in parallel.
+     * \param [in] windowEnd The end of the window.
+     */
+    void ProcessWindow(uint64_t windowEnd);
+    /** Process the active LPs of the current window, from any thread. */
+    void ProcessActiveLogicalProcesses();
+    /** Deliver the events scheduled for other LPs during the window. */
+    void DeliverMessages();
+    /** The main loop of a worker thread. */
+    void WorkerLoop();
+
+    /** Container type for the events to run at Simulator::Destroy() */
+    typedef std::list<EventId> DestroyEvents;
+    /** The container of events to run at Destroy. */
+    DestroyEvents m_destroyEvents;
+    /** Mutex to control access to m_destroyEvents. */
+    mutable std::mutex m_destroyEventsMutex;
+
+    /** Wrap an event scheduled from another thread with its execution context. */
+    struct EventWithContext
+    {
+        /** The event context. */
+        uint32_t context;
+        /** Event delay. */
+        uint64_t timestamp;
+        /** The event implementation. */
+        EventImpl* event;
+    };
+
+    /** Capacity of the lock-free queue of events from other threads. */
+    static const std::size_t EVENTS_WITH_CONTEXT_CAPACITY = 4096;
+    /** The lock-free queue of events from other threads. */
+    MpscQueue<EventWithContext> m_eventsWithContext;
+    /** Container type for the events which did not fit in m_eventsWithContext. */
+    typedef std::list<EventWithContext> EventsWithContext;
+    /** The container of events which did not fit in m_eventsWithContext. */
+    EventsWithContext m_eventsWithContextOverflow;
+    /** Flag \c true if m_eventsWithContextOverflow may hold events. */
+    std::atomic<bool> m_eventsWithContextOverflowing;
+    /** Mutex to control access to m_eventsWithContextOverflow. */
+    std::mutex m_eventsWithContextMutex;
+    /** The thread which created the simulator, or which called Run(). */
+    std::thread::id m_mainThreadId;
+
+    /** Flag calling for the end of the simulation. */
+    std::atomic<bool> m_stop;
+    /** The factory of the event lists. */
+    ObjectFactory m_schedulerFactory;
+    /** The LPs; the first one is the global LP. */
+    std::vector<std::unique_ptr<LogicalProcess>> m_lps;
+    /** Index in m_lps of the LP of each node. */
+    std::vector<uint32_t> m_lpOfNode;
+    /** Whether the nodes have been partitioned. */
+    bool m_partitioned;
+    /** The lookahead. */
+    Time m_lookAhead;
+    /** The maximum number of threads, including the main thread. */
+    uint32_t m_maxThreads;
+
+    /** The worker threads. */
+    std::vector<std::thread> m_workers;
+    /** The LPs with events in the current window. */
+    std::vector<LogicalProcess*> m_active;
+    /** The end of the current window. */
+    uint64_t m_windowEnd;
+    /** Index in m_active of the next LP to process. */
+    std::atomic<std::size_t> m_nextActive;
+    /** Number of threads still processing the current window. */
+    std::atomic<uint32_t> m_busyThreads;
+    /** Incremented to start a window, and to stop the workers. */
+    std::atomic<uint64_t> m_generation;
+    /** Flag asking the workers to exit. */
+    std::atomic<bool> m_workersExit;
+    /** Number of workers blocked on m_wakeUp. */
+    std::atomic<uint32_t> m_sleepingWorkers;
+    /** Mutex protecting the blocking of the workers. */
+    std::mutex m_wakeUpMutex;
+    /** Condition variable to wake up blocked workers. */
+    std::condition_variable m_wakeUp;
+};
+
+} // namespace ns3
+
+#endif /* NS3_MULTITHREADED_SIMULATOR_IMPL_H */
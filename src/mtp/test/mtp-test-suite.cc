@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/node-container.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <atomic>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mtp-tests
+ * MultithreadedSimulatorImpl test suite.
+ */
+
+/**
+ * \ingroup mtp
+ * \defgroup mtp-tests MultithreadedSimulatorImpl tests
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup mtp-tests
+ * Forward tokens around a ring of nodes, logging their arrivals.
+ */
+class TokenForwarder
+{
+  public:
+    /** A token arrival: time, token and hop count. */
+    typedef std::tuple<int64_t, uint32_t, uint32_t> Arrival;
+
+    /**
+     * Constructor.
+     * \param [in] next The device to the next node of the ring.
+     * \param [in] maxHops The number of hops of each token.
+     */
+    TokenForwarder(Ptr<NetDevice> next, uint32_t maxHops)
+        : m_next(next),
+          m_maxHops(maxHops)
+    {
+    }
+
+    /**
+     * Send a new token.
+     * \param [in] token The token.
+     */
+    void Inject(uint32_t token)
+    {
+        Send(token, 0);
+    }
+
+    /**
+     * Receive a token.
+     * \param [in] device The receiving device.
+     * \param [in] packet The packet.
+     * \param [in] protocol The protocol number.
+     * \param [in] from The sender address.
+     * \returns \c true.
+     */
+    bool Receive(Ptr<NetDevice> device,
+                 Ptr<const Packet> packet,
+                 uint16_t protocol,
+                 const Address& from)
+    {
+        uint32_t data[2];
+        packet->CopyData(reinterpret_cast<uint8_t*>(data), sizeof(data));
+        m_arrivals.emplace_back(Simulator::Now().GetTimeStep(), data[0], data[1]);
+        m_uids.push_back(packet->GetUid());
+        m_contextOk &= Simulator::GetContext() == device->GetNode()->GetId();
+        if (data[1] < m_maxHops)
+        {
+            Send(data[0], data[1] + 1);
+        }
+        return true;
+    }
+
+    /** The arrivals, in order. */
+    std::vector<Arrival> m_arrivals;
+    /** The uids of the packets received, in order. */
+    std::vector<uint64_t> m_uids;
+    /** Whether all tokens were received with the context of this node. */
+    bool m_contextOk{true};
+
+  private:
+    /**
+     * Send a token to the next node.
+     * \param [in] token The token.
+     * \param [in] hops The number of hops of the token so far.
+     */
+    void Send(uint32_t token, uint32_t hops)
+    {
+        uint32_t data[2] = {token, hops};
+        Ptr<Packet> packet = Create<Packet>(reinterpret_cast<uint8_t*>(data), sizeof(data));
+        m_next->Send(packet, m_next->GetBroadcast(), 0);
+    }
+
+    Ptr<NetDevice> m_next; //!< The device to the next node.
+    uint32_t m_maxHops;    //!< The number of hops of each token.
+};
+
+/**
+ * \ingroup mtp-tests
+ * Check that a ring of point-to-point links gives the same results
+ * with the MultithreadedSimulatorImpl as with the DefaultSimulatorImpl.
+ */
+class MultithreadedRingTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    MultithreadedRingTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** The results of a simulation. */
+    struct Results
+    {
+        /** The arrivals of each node. */
+        std::vector<std::vector<TokenForwarder::Arrival>> arrivals;
+        /** The uids of the packets received by each node. */
+        std::vector<std::vector<uint64_t>> uids;
+        /** The simulation time at the end. */
+        Time end;
+        /** Number of LPs, for the MultithreadedSimulatorImpl. */
+        uint32_t lps{0};
+        /** Lookahead, for the MultithreadedSimulatorImpl. */
+        Time lookAhead;
+        /** Whether all events had the right context. */
+        bool contextOk{true};
+    };
+
+    /**
+     * Run the simulation.
+     * \param [in] maxThreads The maximum number of threads of the
+     *             MultithreadedSimulatorImpl, 0 for the DefaultSimulatorImpl.
+     * \returns The results.
+     */
+    Results RunRing(uint32_t maxThreads);
+
+    /** Number of nodes of the ring. */
+    static constexpr uint32_t NODES = 8;
+    /** Number of tokens injected by each node. */
+    static constexpr uint32_t TOKENS = 10;
+    /** Number of hops of each token. */
+    static constexpr uint32_t HOPS = 20;
+};
+
+MultithreadedRingTestCase::MultithreadedRingTestCase()
+    : TestCase("Check that a ring of point-to-point links gives the same results as sequentially")
+{
+}
+
+MultithreadedRingTestCase::Results
+MultithreadedRingTestCase::RunRing(uint32_t maxThreads)
+{
+    ObjectFactory factory;
+    if (maxThreads == 0)
+    {
+        factory.SetTypeId("ns3::DefaultSimulatorImpl");
+    }
+    else
+    {
+        factory.SetTypeId("ns3::MultithreadedSimulatorImpl");
+        factory.Set("MaxThreads", UintegerValue(maxThreads));
+    }
+    Ptr<SimulatorImpl> impl = factory.Create<SimulatorImpl>();
+    Simulator::SetImplementation(impl);
+
+    NodeContainer nodes;
+    nodes.Create(NODES);
+
+    // Links of increasing delay: node i sends to node i + 1 in i + 1 ms
+    SimpleNetDeviceHelper helper;
+    helper.SetNetDevicePointToPointMode(true);
+    std::vector<Ptr<NetDevice>> next(NODES);
+    std::vector<Ptr<NetDevice>> previous(NODES);
+    for (uint32_t i = 0; i < NODES; i++)
+    {
+        helper.SetChannelAttribute("Delay", TimeValue(MilliSeconds(i + 1)));
+        NodeContainer pair(nodes.Get(i), nodes.Get((i + 1) % NODES));
+        NetDeviceContainer devices = helper.Install(pair);
+        next[i] = devices.Get(0);
+        previous[(i + 1) % NODES] = devices.Get(1);
+    }
+    // A broadcast channel joins nodes 0 and 4 in a single LP
+    SimpleNetDeviceHelper broadcast;
+    broadcast.Install(NodeContainer(nodes.Get(0), nodes.Get(NODES / 2)));
+
+    std::vector<TokenForwarder> forwarders;
+    forwarders.reserve(NODES);
+    for (uint32_t i = 0; i < NODES; i++)
+    {
+        forwarders.emplace_back(next[i], HOPS);
+        previous[i]->SetReceiveCallback(MakeCallback(&TokenForwarder::Receive, &forwarders[i]));
+        for (uint32_t token = 0; token < TOKENS; token++)
+        {
+            Time at = MicroSeconds(1000 * token + 100 * i + 50);
+            Simulator::ScheduleWithContext(i,
+                                           at,
+                                           &TokenForwarder::Inject,
+                                           &forwarders[i],
+                                           i * TOKENS + token);
+        }
+    }
+
+    Simulator::Run();
+
+    Results results;
+    results.end = Simulator::Now();
+    for (const auto& forwarder : forwarders)
+    {
+        results.arrivals.push_back(forwarder.m_arrivals);
+        results.uids.push_back(forwarder.m_uids);
+        results.contextOk &= forwarder.m_contextOk;
+    }
+    Ptr<MultithreadedSimulatorImpl> mtp = DynamicCast<MultithreadedSimulatorImpl>(impl);
+    if (mtp)
+    {
+        results.lps = mtp->GetLogicalProcessCount();
+        results.lookAhead = mtp->GetLookAhead();
+    }
+    Simulator::Destroy();
+    return results;
+}
+
+void
+MultithreadedRingTestCase::DoRun()
+{
+    Results expected = RunRing(0);
+    uint32_t arrivals = 0;
+    for (const auto& node : expected.arrivals)
+    {
+        arrivals += node.size();
+    }
+    NS_TEST_ASSERT_MSG_EQ(arrivals, NODES * TOKENS * (HOPS + 1), "Tokens lost sequentially");
+
+    // the packet uids differ from the sequential ones, but not with the number of threads
+    Results oneThread;
+    for (uint32_t threads : {1, 2, 4})
+    {
+        Results results = RunRing(threads);
+        if (threads == 1)
+        {
+            oneThread = results;
+        }
+        NS_TEST_EXPECT_MSG_EQ(results.lps, NODES - 1, "Wrong number of LPs");
+        NS_TEST_EXPECT_MSG_EQ(results.lookAhead, MilliSeconds(1), "Wrong lookahead");
+        NS_TEST_EXPECT_MSG_EQ(results.contextOk, true, "Events run with the wrong context");
+        NS_TEST_EXPECT_MSG_EQ(results.end, expected.end, "Wrong end time");
+        for (uint32_t i = 0; i < NODES; i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ((results.arrivals[i] == expected.arrivals[i]),
+                                  true,
+                                  "Different arrivals at node " << i << " with " << threads
+                                                                << " threads");
+            NS_TEST_EXPECT_MSG_EQ((results.uids[i] == oneThread.uids[i]),
+                                  true,
+                                  "Different packet uids at node " << i << " with " << threads
+                                                                   << " threads");
+        }
+    }
+}
+
+/**
+ * \ingroup mtp-tests
+ * Check global events, Stop() and BoundLookAhead().
+ */
+class MultithreadedGlobalEventsTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    MultithreadedGlobalEventsTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Node event: record the time, and reschedule on the same node and
+     * on the next node.
+     * \param [in] node The node id.
+     * \param [in] remaining The number of events left in this chain.
+     */
+    void NodeEvent(uint32_t node, uint32_t remaining);
+    /** Global event: check that no node event ran past it. */
+    void GlobalEvent();
+
+    /** Number of nodes. */
+    static constexpr uint32_t NODES = 4;
+    /** Node event counts. */
+    std::vector<uint32_t> m_counts;
+    /** Latest time of a node event, per node. */
+    std::vector<Time> m_latest;
+    /** Number of global events which saw node events in their future. */
+    uint32_t m_globalErrors{0};
+    /** Number of global events. */
+    uint32_t m_globalEvents{0};
+};
+
+MultithreadedGlobalEventsTestCase::MultithreadedGlobalEventsTestCase()
+    : TestCase("Check global events, Stop and BoundLookAhead")
+{
+}
+
+void
+MultithreadedGlobalEventsTestCase::NodeEvent(uint32_t node, uint32_t remaining)
+{
+    m_counts[node]++;
+    m_latest[node] = Simulator::Now();
+    if (remaining == 0)
+    {
+        return;
+    }
+    Simulator::Schedule(MicroSeconds(300),
+                        &MultithreadedGlobalEventsTestCase::NodeEvent,
+                        this,
+                        node,
+                        remaining - 1);
+    if (remaining % 4 == 0)
+    {
+        // To another LP: must respect the bounded lookahead
+        Simulator::ScheduleWithContext((node + 1) % NODES,
+                                       MilliSeconds(1),
+                                       &MultithreadedGlobalEventsTestCase::NodeEvent,
+                                       this,
+                                       (node + 1) % NODES,
+                                       0);
+    }
+}
+
+void
+MultithreadedGlobalEventsTestCase::GlobalEvent()
+{
+    m_globalEvents++;
+    for (const auto& latest : m_latest)
+    {
+        if (latest > Simulator::Now())
+        {
+            m_globalErrors++;
+        }
+    }
+}
+
+void
+MultithreadedGlobalEventsTestCase::DoRun()
+{
+    ObjectFactory factory;
+    factory.SetTypeId("ns3::MultithreadedSimulatorImpl");
+    factory.Set("MaxThreads", UintegerValue(3));
+    Ptr<MultithreadedSimulatorImpl> impl = factory.Create<MultithreadedSimulatorImpl>();
+    Simulator::SetImplementation(impl);
+    impl->BoundLookAhead(MilliSeconds(1));
+
+    // Nodes without devices: one LP each
+    NodeContainer nodes;
+    nodes.Create(NODES);
+    m_counts.assign(NODES, 0);
+    m_latest.assign(NODES, Seconds(0));
+
+    for (uint32_t i = 0; i < NODES; i++)
+    {
+        Simulator::ScheduleWithContext(i,
+                                       MicroSeconds(10 * i),
+                                       &MultithreadedGlobalEventsTestCase::NodeEvent,
+                                       this,
+                                       i,
+                                       1000);
+    }
+    for (uint32_t i = 1; i <= 10; i++)
+    {
+        Simulator::Schedule(MilliSeconds(7 * i),
+                            &MultithreadedGlobalEventsTestCase::GlobalEvent,
+                            this);
+    }
+    Simulator::Stop(MilliSeconds(100));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcessCount(), NODES, "Wrong number of LPs");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MilliSeconds(1), "Wrong lookahead");
+    NS_TEST_EXPECT_MSG_EQ(m_globalEvents, 10, "Global events lost");
+    NS_TEST_EXPECT_MSG_EQ(m_globalErrors, 0, "Node events ran ahead of global events");
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), MilliSeconds(100), "Wrong stop time");
+    for (uint32_t i = 0; i < NODES; i++)
+    {
+        // The Stop event is a global event: no node event runs past it
+        NS_TEST_EXPECT_MSG_LT(m_latest[i], MilliSeconds(100), "Node " << i << " ran past Stop");
+        NS_TEST_EXPECT_MSG_GT(m_counts[i], 300, "Too few events on node " << i);
+    }
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup mtp-tests
+ * Check events scheduled from a thread other than the simulation threads.
+ */
+class MultithreadedOtherThreadTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    MultithreadedOtherThreadTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Node event: keep the simulation running until the other thread
+     * is done.
+     * \param [in] node The node id.
+     */
+    void KeepAlive(uint32_t node);
+    /**
+     * Node event scheduled by the other thread: count it if it runs in
+     * the context of its node.
+     * \param [in] node The node id.
+     */
+    void ThreadEvent(uint32_t node);
+    /** Body of the other thread. */
+    void ScheduleEvents();
+
+    /** Number of nodes. */
+    static constexpr uint32_t NODES = 4;
+    /** Number of events scheduled by the other thread. */
+    static constexpr uint32_t EVENTS = 10000;
+    /** Events received from the other thread, per node. */
+    std::vector<uint32_t> m_received;
+    /** Whether the other thread scheduled all its events. */
+    std::atomic<bool> m_done{false};
+};
+
+MultithreadedOtherThreadTestCase::MultithreadedOtherThreadTestCase()
+    : TestCase("Check ScheduleWithContext from another thread")
+{
+}
+
+void
+MultithreadedOtherThreadTestCase::KeepAlive(uint32_t node)
+{
+    if (!m_done.load(std::memory_order_acquire))
+    {
+        Simulator::Schedule(MicroSeconds(10),
+                            &MultithreadedOtherThreadTestCase::KeepAlive,
+                            this,
+                            node);
+    }
+}
+
+void
+MultithreadedOtherThreadTestCase::ThreadEvent(uint32_t node)
+{
+    if (Simulator::GetContext() == node)
+    {
+        m_received[node]++;
+    }
+}
+
+void
+MultithreadedOtherThreadTestCase::ScheduleEvents()
+{
+    for (uint32_t i = 0; i < EVENTS; i++)
+    {
+        Simulator::ScheduleWithContext(i % NODES,
+                                       MicroSeconds(1),
+                                       &MultithreadedOtherThreadTestCase::ThreadEvent,
+                                       this,
+                                       i % NODES);
+    }
+    m_done.store(true, std::memory_order_release);
+}
+
+void
+MultithreadedOtherThreadTestCase::DoRun()
+{
+    ObjectFactory factory;
+    factory.SetTypeId("ns3::MultithreadedSimulatorImpl");
+    factory.Set("MaxThreads", UintegerValue(3));
+    Ptr<MultithreadedSimulatorImpl> impl = factory.Create<MultithreadedSimulatorImpl>();
+    Simulator::SetImplementation(impl);
+    impl->BoundLookAhead(MilliSeconds(1));
+
+    NodeContainer nodes;
+    nodes.Create(NODES);
+    m_received.assign(NODES, 0);
+    for (uint32_t i = 0; i < NODES; i++)
+    {
+        Simulator::ScheduleWithContext(i,
+                                       Seconds(0),
+                                       &MultithreadedOtherThreadTestCase::KeepAlive,
+                                       this,
+                                       i);
+    }
+
+    std::thread thread(&MultithreadedOtherThreadTestCase::ScheduleEvents, this);
+    Simulator::Run();
+    thread.join();
+
+    for (uint32_t i = 0; i < NODES; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_received[i], EVENTS / NODES, "Events lost on node " << i);
+    }
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup mtp-tests
+ * MultithreadedSimulatorImpl test suite.
+ */
+class MtpTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    MtpTestSuite()
+        : TestSuite("mtp")
+    {
+        AddTestCase(new MultithreadedRingTestCase());
+        AddTestCase(new MultithreadedGlobalEventsTestCase());
+        AddTestCase(new MultithreadedOtherThreadTestCase());
+    }
+};
+
+/**
+ * \ingroup mtp-tests
+ * MtpTestSuite instance variable.
+ */
+static MtpTestSuite g_mtpTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
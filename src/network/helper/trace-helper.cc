@@ -23,8 +23,11 @@
 #include "ns3/names.h"
 #include "ns3/net-device.h"
 #include "ns3/node.h"
+#include "ns3/packet-sampler.h"
 #include "ns3/pcap-file-wrapper.h"
+#include "ns3/pcapng-file.h"
 #include "ns3/ptr.h"
+#include "ns3/simulator.h"
 
 #include <fstream>
 #include <stdint.h>
@@ -35,6 +38,9 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("TraceHelper");
 
+/// The pcapng file holding the files created by PcapHelper, if enabled
+static Ptr<PcapngFile> g_pcapngFile;
+
 PcapHelper::PcapHelper()
 {
     NS_LOG_FUNCTION_NOARGS();
@@ -55,6 +61,19 @@ PcapHelper::CreateFile(std::string filename,
     NS_LOG_FUNCTION(filename << filemode << dataLinkType << snapLen << tzCorrection);
 
     Ptr<PcapFileWrapper> file = CreateObject<PcapFileWrapper>();
+    if (g_pcapngFile)
+    {
+        std::string name = filename.substr(filename.find_last_of('/') + 1);
+        std::string::size_type extension = name.rfind(".pcap");
+        if (extension != std::string::npos && extension + 5 == name.size())
+        {
+            name.erase(extension);
+        }
+        file->InitPcapng(g_pcapngFile, dataLinkType, name, snapLen);
+        NS_ABORT_MSG_IF(file->Fail(), "Unable to add " << name << " to the pcapng file");
+        return file;
+    }
+
     file->Open(filename, filemode);
     NS_ABORT_MSG_IF(file->Fail(), "Unable to Open " << filename << " for mode " << filemode);
 
@@ -75,6 +94,30 @@ PcapHelper::CreateFile(std::string filename,
     return file;
 }
 
+void
+PcapHelper::EnablePcapng(std::string filename, bool compress)
+{
+    NS_LOG_FUNCTION(filename << compress);
+    NS_ABORT_MSG_IF(compress && !PcapngFile::IsCompressionSupported(),
+                    "Unable to compress " << filename << ": ns-3 was built without zlib");
+    DisablePcapng();
+    g_pcapngFile = Create<PcapngFile>();
+    g_pcapngFile->Open(filename, compress);
+    NS_ABORT_MSG_IF(g_pcapngFile->Fail(), "Unable to Open " << filename);
+    Simulator::ScheduleDestroy(&PcapHelper::DisablePcapng);
+}
+
+void
+PcapHelper::DisablePcapng()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    if (g_pcapngFile)
+    {
+        g_pcapngFile->Close();
+        g_pcapngFile = nullptr;
+    }
+}
+
 std::string
 PcapHelper::GetFilenameFromDevice(std::string prefix, Ptr<NetDevice> device, bool useObjectNames)
 {
@@ -210,6 +253,17 @@ AsciiTraceHelper::CreateFileStream(std::string filename, std::ios::openmode file
     return StreamWrapper;
 }
 
+Ptr<OutputStreamWrapper>
+AsciiTraceHelper::CreateBinaryFileStream(std::string filename)
+{
+    NS_LOG_FUNCTION(filename);
+
+    Ptr<OutputStreamWrapper> StreamWrapper =
+        Create<OutputStreamWrapper>(filename, std::ios::out | std::ios::binary);
+    StreamWrapper->SetBinaryTrace(Create<BinaryTraceWriter>(StreamWrapper->GetStream()));
+    return StreamWrapper;
+}
+
 std::string
 AsciiTraceHelper::GetFilenameFromDevice(std::string prefix,
                                         Ptr<NetDevice> device,
@@ -298,6 +352,32 @@ AsciiTraceHelper::GetFilenameFromInterfacePair(std::string prefix,
     return oss.str();
 }
 
+bool
+AsciiTraceHelper::WriteRecord(Ptr<OutputStreamWrapper> stream,
+                              BinaryTraceWriter::EventKind kind,
+                              const std::string* context,
+                              Ptr<const Packet> p)
+{
+    if (stream->IsPacketSampling() && !PacketSampler::IsSampled(p))
+    {
+        return true;
+    }
+    Ptr<BinaryTraceWriter> binary = stream->GetBinaryTrace();
+    if (!binary)
+    {
+        return false;
+    }
+    if (context)
+    {
+        binary->Write(kind, *context, p);
+    }
+    else
+    {
+        binary->Write(kind, p);
+    }
+    return true;
+}
+
 //
 // One of the basic default trace sink sets.  Enqueue:
 //
@@ -314,6 +394,10 @@ AsciiTraceHelper::DefaultEnqueueSinkWithoutContext(Ptr<OutputStreamWrapper> stre
                                                    Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(stream << p);
+    if (WriteRecord(stream, BinaryTraceWriter::ENQUEUE, nullptr, p))
+    {
+        return;
+    }
     *stream->GetStream() << "+ " << Simulator::Now().GetSeconds() << " " << *p << std::endl;
 }
 
@@ -323,6 +407,10 @@ AsciiTraceHelper::DefaultEnqueueSinkWithContext(Ptr<OutputStreamWrapper> stream,
                                                 Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(stream << p);
+    if (WriteRecord(stream, BinaryTraceWriter::ENQUEUE, &context, p))
+    {
+        return;
+    }
     *stream->GetStream() << "+ " << Simulator::Now().GetSeconds() << " " << context << " " << *p
                          << std::endl;
 }
@@ -344,6 +432,10 @@ AsciiTraceHelper::DefaultDropSinkWithoutContext(Ptr<OutputStreamWrapper> stream,
                                                 Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(stream << p);
+    if (WriteRecord(stream, BinaryTraceWriter::DROP, nullptr, p))
+    {
+        return;
+    }
     *stream->GetStream() << "d " << Simulator::Now().GetSeconds() << " " << *p << std::endl;
 }
 
@@ -353,6 +445,10 @@ AsciiTraceHelper::DefaultDropSinkWithContext(Ptr<OutputStreamWrapper> stream,
                                              Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(stream << p);
+    if (WriteRecord(stream, BinaryTraceWriter::DROP, &context, p))
+    {
+        return;
+    }
     *stream->GetStream() << "d " << Simulator::Now().GetSeconds() << " " << context << " " << *p
                          << std::endl;
 }
@@ -375,6 +471,10 @@ AsciiTraceHelper::DefaultDequeueSinkWithoutContext(Ptr<OutputStreamWrapper> stre
                                                    Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(stream << p);
+    if (WriteRecord(stream, BinaryTraceWriter::DEQUEUE, nullptr, p))
+    {
+        return;
+    }
     *stream->GetStream() << "- " << Simulator::Now().GetSeconds() << " " << *p << std::endl;
 }
 
@@ -384,6 +484,10 @@ AsciiTraceHelper::DefaultDequeueSinkWithContext(Ptr<OutputStreamWrapper> stream,
                                                 Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(stream << p);
+    if (WriteRecord(stream, BinaryTraceWriter::DEQUEUE, &context, p))
+    {
+        return;
+    }
     *stream->GetStream() << "- " << Simulator::Now().GetSeconds() << " " << context << " " << *p
                          << std::endl;
 }
@@ -403,6 +507,10 @@ AsciiTraceHelper::DefaultReceiveSinkWithoutContext(Ptr<OutputStreamWrapper> stre
                                                    Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(stream << p);
+    if (WriteRecord(stream, BinaryTraceWriter::RECEIVE, nullptr, p))
+    {
+        return;
+    }
     *stream->GetStream() << "r " << Simulator::Now().GetSeconds() << " " << *p << std::endl;
 }
 
@@ -412,6 +520,10 @@ AsciiTraceHelper::DefaultReceiveSinkWithContext(Ptr<OutputStreamWrapper> stream,
                                                 Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(stream << p);
+    if (WriteRecord(stream, BinaryTraceWriter::RECEIVE, &context, p))
+    {
+        return;
+    }
     *stream->GetStream() << "r " << Simulator::Now().GetSeconds() << " " << context << " " << *p
                          << std::endl;
 }
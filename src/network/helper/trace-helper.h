@@ -115,6 +115,26 @@ class PcapHelper
                                     DataLinkType dataLinkType,
                                     uint32_t snapLen = std::numeric_limits<uint32_t>::max(),
                                     int32_t tzCorrection = 0);
+
+    /**
+     * @brief Write the pcap files subsequently created as the interfaces
+     * of a single pcapng file.
+     *
+     * Each call to CreateFile then adds to \pname{filename} an interface,
+     * named after the requested file name without its directory and its
+     * ".pcap" extension, rather than creating a file; the file mode and
+     * the time zone correction are ignored.  The pcapng file is closed
+     * when the simulator is destroyed, or by DisablePcapng.
+     *
+     * @param filename file name of the pcapng file
+     * @param compress whether to compress the file with gzip, which
+     *        requires ns-3 to be built with zlib
+     */
+    static void EnablePcapng(std::string filename, bool compress = false);
+    /**
+     * @brief Close the pcapng file, if any: CreateFile creates pcap files again.
+     */
+    static void DisablePcapng();
     /**
      * @brief Hook a trace source to the default trace sink
      *
@@ -237,6 +257,24 @@ class AsciiTraceHelper
     Ptr<OutputStreamWrapper> CreateFileStream(std::string filename,
                                               std::ios::openmode filemode = std::ios::out);
 
+    /**
+     * @brief Create and initialize an output stream object to which the default
+     * trace sinks write binary records rather than text.
+     *
+     * The binary records hold the time, the node, the device, the kind of
+     * event and the uid and size of the packet, and are much cheaper to
+     * write than the text, which prints the packet.  The utils/binary-trace-to-ascii
+     * program converts them to text.  Only the default trace sinks support
+     * binary streams: the helpers which hook their own sinks, such as the
+     * wifi and internet helpers, abort when they are given one.
+     *
+     * @see BinaryTraceWriter
+     *
+     * @param filename file name
+     * @returns a smart pointer to the output stream
+     */
+    Ptr<OutputStreamWrapper> CreateBinaryFileStream(std::string filename);
+
     /**
      * @brief Hook a trace source to the default enqueue operation trace sink that
      * does not accept nor log a trace context.
@@ -497,6 +535,22 @@ class AsciiTraceHelper
     static void DefaultReceiveSinkWithContext(Ptr<OutputStreamWrapper> file,
                                               std::string context,
                                               Ptr<const Packet> p);
+
+  private:
+    /**
+     * @brief Handle the sampling and the binary records of the default trace sinks.
+     *
+     * @param stream the output stream
+     * @param kind the kind of event
+     * @param context the context, or nullptr for the sinks without context
+     * @param p the packet
+     * @returns true if the sink must not print the packet, because the packet
+     *          is not sampled or its record was written to the binary stream
+     */
+    static bool WriteRecord(Ptr<OutputStreamWrapper> stream,
+                            BinaryTraceWriter::EventKind kind,
+                            const std::string* context,
+                            Ptr<const Packet> p);
 };
 
 template <typename T>
@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "buffer-pool.h"
+
+#include "ns3/boolean.h"
+#include "ns3/global-value.h"
+#include "ns3/log.h"
+
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::BufferPool implementation.
+ */
+
+namespace ns3
+{
+
+// Note: logging is only done on the arena allocation path, the
+// per-packet paths are far too hot.
+NS_LOG_COMPONENT_DEFINE("BufferPool");
+
+/**
+ * \ingroup packet
+ * \anchor GlobalValueBufferHugePages
+ * Whether the arenas of the BufferPool are backed by huge pages.
+ */
+static GlobalValue g_bufferHugePages("BufferHugePages",
+                                     "Advise the kernel to back the packet buffer arenas "
+                                     "with transparent huge pages.",
+                                     BooleanValue(false),
+                                     MakeBooleanChecker());
+
+namespace
+{
+
+/** Number of size classes per power of two. */
+constexpr std::size_t CLASSES_PER_DOUBLING = 4;
+
+/**
+ * Get the base 2 logarithm of a number, rounded down.
+ *
+ * \param [in] n The number, which must be positive.
+ * \returns The logarithm.
+ */
+constexpr uint32_t
+Log2(std::size_t n)
+{
+    uint32_t log = 0;
+    while (n >>= 1)
+    {
+        log++;
+    }
+    return log;
+}
+
+/** Base 2 logarithm of MIN_BLOCK_SIZE. */
+constexpr uint32_t MIN_LOG = Log2(BufferPool::MIN_BLOCK_SIZE);
+
+/**
+ * Get the size class of a block size.
+ *
+ * Class 0 holds the blocks of MIN_BLOCK_SIZE bytes. The sizes from
+ * 2^e + 1 to 2^(e+1) are split in CLASSES_PER_DOUBLING classes of
+ * 5, 6, 7 and 8 times 2^(e-2) bytes.
+ *
+ * \param [in] size The requested size, at most MAX_POOLED_SIZE.
+ * \returns The size class.
+ */
+constexpr std::size_t
+GetSizeClass(std::size_t size)
+{
+    if (size <= BufferPool::MIN_BLOCK_SIZE)
+    {
+        return 0;
+    }
+    std::size_t n = size - 1;
+    uint32_t e = Log2(n);
+    std::size_t sub = (n >> (e - 2)) & (CLASSES_PER_DOUBLING - 1);
+    return 1 + (e - MIN_LOG) * CLASSES_PER_DOUBLING + sub;
+}
+
+/**
+ * Get the block size of a size class.
+ *
+ * \param [in] cls The size class.
+ * \returns The block size.
+ */
+constexpr std::size_t
+GetClassSize(std::size_t cls)
+{
+    if (cls == 0)
+    {
+        return BufferPool::MIN_BLOCK_SIZE;
+    }
+    uint32_t e = MIN_LOG + (cls - 1) / CLASSES_PER_DOUBLING;
+    std::size_t sub = (cls - 1) % CLASSES_PER_DOUBLING;
+    return (CLASSES_PER_DOUBLING + 1 + sub) << (e - 2);
+}
+
+/** Number of size classes. */
+constexpr std::size_t N_CLASSES = GetSizeClass(BufferPool::MAX_POOLED_SIZE) + 1;
+
+/** A free block, linked through its first bytes. */
+struct FreeBlock
+{
+    FreeBlock* next; //!< Next free block of the same size class.
+};
+
+/** A singly-linked list of free blocks of one size class. */
+struct FreeList
+{
+    FreeBlock* head; //!< First free block.
+    uint32_t count;  //!< Number of blocks in the list.
+};
+
+/** Blocks shared between threads, and ownership of all arenas. */
+struct Depot
+{
+    std::mutex mutex;          //!< Protects all the fields below.
+    FreeList lists[N_CLASSES]; //!< Free lists, one per size class.
+    std::vector<void*> arenas; //!< All arenas ever allocated.
+    char* arenaNext;           //!< Start of the unused part of the last arena.
+    std::size_t arenaLeft;     //!< Size of the unused part of the last arena.
+    uint64_t reservedBytes;    //!< Total size of the arenas.
+};
+
+/**
+ * Get the depot.
+ *
+ * The depot is intentionally never destroyed, so that buffers released
+ * during static destruction can still be returned to it.
+ *
+ * \returns The depot.
+ */
+Depot&
+GetDepot()
+{
+    static Depot* depot = new Depot();
+    return *depot;
+}
+
+/**
+ * The free lists and counters of one thread.
+ *
+ * This is trivially destructible, so it stays usable until the thread
+ * terminates, even after ThreadCacheFlusher ran.
+ */
+struct ThreadCache
+{
+    FreeList lists[N_CLASSES];    //!< Free lists, one per size class.
+    BufferPool::Statistics stats; //!< Allocation counters.
+    bool registered;              //!< Whether the ThreadCacheFlusher was constructed.
+    bool exited;                  //!< Whether the ThreadCacheFlusher was destroyed.
+};
+
+/** The cache of the calling thread. */
+thread_local ThreadCache t_cache;
+
+/**
+ * Get the number of blocks moved at once for a size class.
+ *
+ * \param [in] cls The size class.
+ * \returns The number of blocks.
+ */
+inline uint32_t
+GetRefillCount(std::size_t cls)
+{
+    std::size_t count = BufferPool::REFILL_BYTES / GetClassSize(cls);
+    return count > 0 ? count : 1;
+}
+
+/**
+ * Move up to \pname{n} blocks from one free list to another.
+ *
+ * \param [in,out] from The source list.
+ * \param [in,out] to The destination list.
+ * \param [in] n The maximum number of blocks to move.
+ */
+void
+MoveBlocks(FreeList& from, FreeList& to, uint32_t n)
+{
+    while (n > 0 && from.head != nullptr)
+    {
+        FreeBlock* block = from.head;
+        from.head = block->next;
+        from.count--;
+        block->next = to.head;
+        to.head = block;
+        to.count++;
+        n--;
+    }
+}
+
+/** Return the blocks cached by a thread to the depot when it exits. */
+struct ThreadCacheFlusher
+{
+    ~ThreadCacheFlusher()
+    {
+        Depot& depot = GetDepot();
+        std::unique_lock lock{depot.mutex};
+        for (std::size_t cls = 0; cls < N_CLASSES; cls++)
+        {
+            MoveBlocks(t_cache.lists[cls], depot.lists[cls], t_cache.lists[cls].count);
+        }
+        t_cache.exited = true;
+    }
+};
+
+/** Flushes t_cache at thread exit. */
+thread_local ThreadCacheFlusher t_flusher;
+
+/** Make sure t_flusher is constructed for the calling thread. */
+void
+RegisterThreadCache()
+{
+    if (!t_cache.registered)
+    {
+        t_cache.registered = true;
+        [[maybe_unused]] ThreadCacheFlusher* flusher = &t_flusher;
+    }
+}
+
+/**
+ * Allocate a new arena.
+ *
+ * \param [in,out] depot The depot, whose mutex is held.
+ */
+void
+NewArena(Depot& depot)
+{
+    auto arena = static_cast<char*>(
+        ::operator new(BufferPool::ARENA_SIZE, std::align_val_t(BufferPool::ARENA_SIZE)));
+    BooleanValue hugePages(false);
+    GlobalValue::GetValueByNameFailSafe("BufferHugePages", hugePages);
+#ifdef MADV_HUGEPAGE
+    if (hugePages.Get() && madvise(arena, BufferPool::ARENA_SIZE, MADV_HUGEPAGE) != 0)
+    {
+        NS_LOG_WARN("Huge pages are not available for the packet buffers");
+    }
+#else
+    NS_LOG_LOGIC("Huge pages are not supported, ignoring BufferHugePages=" << hugePages.Get());
+#endif
+    NS_LOG_LOGIC("new arena " << static_cast<void*>(arena) << " of " << BufferPool::ARENA_SIZE
+                              << " bytes");
+    depot.arenas.push_back(arena);
+    depot.reservedBytes += BufferPool::ARENA_SIZE;
+    depot.arenaNext = arena;
+    depot.arenaLeft = BufferPool::ARENA_SIZE;
+}
+
+/**
+ * Refill the free list of the calling thread for one size class,
+ * from the depot if possible, from the arenas otherwise.
+ *
+ * \param [in] cls The size class.
+ * \returns true if new blocks had to be carved.
+ */
+bool
+Refill(std::size_t cls)
+{
+    RegisterThreadCache();
+    FreeList& list = t_cache.lists[cls];
+    uint32_t count = GetRefillCount(cls);
+    Depot& depot = GetDepot();
+    std::unique_lock lock{depot.mutex};
+    if (depot.lists[cls].head != nullptr)
+    {
+        MoveBlocks(depot.lists[cls], list, count);
+        return false;
+    }
+
+    std::size_t blockSize = GetClassSize(cls);
+    if (depot.arenaLeft < blockSize)
+    {
+        // The end of the last arena is lost.
+        NewArena(depot);
+    }
+    for (uint32_t i = 0; i < count && depot.arenaLeft >= blockSize; i++)
+    {
+        auto block = reinterpret_cast<FreeBlock*>(depot.arenaNext);
+        depot.arenaNext += blockSize;
+        depot.arenaLeft -= blockSize;
+        block->next = list.head;
+        list.head = block;
+        list.count++;
+    }
+    return true;
+}
+
+} // unnamed namespace
+
+std::size_t
+BufferPool::GetBlockSize(std::size_t size)
+{
+    if (size > MAX_POOLED_SIZE)
+    {
+        return size;
+    }
+    return GetClassSize(GetSizeClass(size));
+}
+
+void*
+BufferPool::Allocate(std::size_t blockSize)
+{
+    t_cache.stats.outstandingBytes += blockSize;
+    if (blockSize > MAX_POOLED_SIZE)
+    {
+        t_cache.stats.oversize++;
+        return ::operator new(blockSize);
+    }
+    std::size_t cls = GetSizeClass(blockSize);
+    FreeList& list = t_cache.lists[cls];
+    if (list.head == nullptr && Refill(cls))
+    {
+        t_cache.stats.misses++;
+    }
+    else
+    {
+        t_cache.stats.hits++;
+    }
+    FreeBlock* block = list.head;
+    list.head = block->next;
+    list.count--;
+    return block;
+}
+
+void
+BufferPool::Deallocate(void* p, std::size_t blockSize)
+{
+    if (p == nullptr)
+    {
+        return;
+    }
+    t_cache.stats.frees++;
+    t_cache.stats.outstandingBytes -= blockSize;
+    if (blockSize > MAX_POOLED_SIZE)
+    {
+        ::operator delete(p);
+        return;
+    }
+    std::size_t cls = GetSizeClass(blockSize);
+    auto block = static_cast<FreeBlock*>(p);
+    if (t_cache.exited)
+    {
+        // The thread cache was flushed already: bypass it.
+        Depot& depot = GetDepot();
+        std::unique_lock lock{depot.mutex};
+        block->next = depot.lists[cls].head;
+        depot.lists[cls].head = block;
+        depot.lists[cls].count++;
+        return;
+    }
+    FreeList& list = t_cache.lists[cls];
+    block->next = list.head;
+    list.head = block;
+    list.count++;
+    uint32_t count = GetRefillCount(cls);
+    if (list.count > 2 * count)
+    {
+        RegisterThreadCache();
+        Depot& depot = GetDepot();
+        std::unique_lock lock{depot.mutex};
+        MoveBlocks(list, depot.lists[cls], count);
+    }
+}
+
+BufferPool::Statistics
+BufferPool::GetStatistics()
+{
+    return t_cache.stats;
+}
+
+void
+BufferPool::ResetStatistics()
+{
+    t_cache.stats = Statistics{};
+}
+
+uint64_t
+BufferPool::GetReservedBytes()
+{
+    Depot& depot = GetDepot();
+    std::unique_lock lock{depot.mutex};
+    return depot.reservedBytes;
+}
+
+} // namespace ns3
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::BufferPool declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup packet
+ * \brief Size-class pool backing the byte buffers of the packets.
+ *
+ * Simulations mix packets of very different sizes, such as 64-byte
+ * acknowledgments, 1500-byte frames and 65 kB aggregates. The pool
+ * rounds the requested sizes up to size classes, four per power of two
+ * from MIN_BLOCK_SIZE to MAX_POOLED_SIZE bytes, so that no block wastes
+ * more than a fifth of its size, and recycles the freed blocks through
+ * per-thread free lists, one per size class.
+ *
+ * Blocks are carved, REFILL_BYTES at a time, from arenas of ARENA_SIZE
+ * bytes. When the \c BufferHugePages global value is true at the time
+ * an arena is allocated, the arena is advised to be backed by
+ * transparent huge pages, on systems which support them. As in the
+ * EventImplPool, a thread whose free list grows beyond twice the refill
+ * size hands the excess back to a shared, mutex-protected depot, and
+ * arenas are never released to the system.
+ *
+ * Requests larger than MAX_POOLED_SIZE bytes are forwarded to the global
+ * operator new.
+ */
+class BufferPool
+{
+  public:
+    /** Allocation counters of the calling thread. */
+    struct Statistics
+    {
+        uint64_t hits;            //!< Allocations served from a free list.
+        uint64_t misses;          //!< Allocations which required carving new blocks.
+        uint64_t oversize;        //!< Allocations forwarded to the global operator new.
+        uint64_t frees;           //!< Blocks released, including the oversize ones.
+        int64_t outstandingBytes; //!< Bytes allocated minus bytes released.
+    };
+
+    /** Smallest block size, in bytes. */
+    static const std::size_t MIN_BLOCK_SIZE = 64;
+    /** Largest block size served by the pool, in bytes. */
+    static const std::size_t MAX_POOLED_SIZE = 128 * 1024;
+    /** Number of bytes carved at once for a size class. */
+    static const std::size_t REFILL_BYTES = 64 * 1024;
+    /** Size of the arenas, in bytes, which is also their alignment. */
+    static const std::size_t ARENA_SIZE = 2 * 1024 * 1024;
+
+    /**
+     * Get the size of the block which holds a request.
+     *
+     * \param [in] size The requested size.
+     * \returns The size of the size class of \pname{size}, or
+     *          \pname{size} if it is larger than MAX_POOLED_SIZE.
+     */
+    static std::size_t GetBlockSize(std::size_t size);
+    /**
+     * Allocate a block.
+     *
+     * \param [in] blockSize The block size, as returned by GetBlockSize().
+     * \returns The block.
+     */
+    static void* Allocate(std::size_t blockSize);
+    /**
+     * Release a block obtained from Allocate().
+     *
+     * \param [in] p The block.
+     * \param [in] blockSize The size passed to Allocate().
+     */
+    static void Deallocate(void* p, std::size_t blockSize);
+
+    /**
+     * Get the allocation counters of the calling thread.
+     *
+     * With several threads, the blocks released by another thread than
+     * the one which allocated them make the outstanding bytes of the
+     * threads differ: only their sum is meaningful.
+     *
+     * \returns The counters accumulated since the last ResetStatistics().
+     */
+    static Statistics GetStatistics();
+    /** Reset the allocation counters of the calling thread. */
+    static void ResetStatistics();
+    /**
+     * Get the total size of the arenas allocated by all threads.
+     *
+     * \returns The number of bytes.
+     */
+    static uint64_t GetReservedBytes();
+};
+
+} // namespace ns3
+
+#endif /* BUFFER_POOL_H */
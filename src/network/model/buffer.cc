@@ -18,6 +18,8 @@
  */
 #include "buffer.h"
 
+#include "buffer-pool.h"
+#include "packet-accounting.h"
 #include "ns3/assert.h"
 #include "ns3/log.h"
 
@@ -54,112 +56,11 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("Buffer");
 
+#ifdef NS3_MTP
+thread_local uint32_t Buffer::g_recommendedStart = 0;
+#else
 uint32_t Buffer::g_recommendedStart = 0;
-#ifdef BUFFER_FREE_LIST
-/* The following macros are pretty evil but they are needed to allow us to
- * keep track of 3 possible states for the g_freeList variable:
- *  - uninitialized means that no one has created a buffer yet
- *    so no one has created the associated free list (it is created
- *    on-demand when the first buffer is created)
- *  - initialized means that the free list exists and is valid
- *  - destroyed means that the static destructors of this compilation unit
- *    have run so, the free list has been cleared from its content
- * The key is that in destroyed state, we are careful not re-create it
- * which is a typical weakness of lazy evaluation schemes which use
- * '0' as a special value to indicate both un-initialized and destroyed.
- * Note that it is important to use '0' as the marker for un-initialized state
- * because the variable holding this state information is initialized to zero
- * which the compiler assigns to zero-memory which is initialized to _zero_
- * before the constructors run so this ensures perfect handling of crazy
- * constructor orderings.
- */
-#define MAGIC_DESTROYED (~(long)0)
-#define IS_UNINITIALIZED(x) (x == (Buffer::FreeList*)0)
-#define IS_DESTROYED(x) (x == (Buffer::FreeList*)MAGIC_DESTROYED)
-#define IS_INITIALIZED(x) (!IS_UNINITIALIZED(x) && !IS_DESTROYED(x))
-#define DESTROYED ((Buffer::FreeList*)MAGIC_DESTROYED)
-#define UNINITIALIZED ((Buffer::FreeList*)0)
-uint32_t Buffer::g_maxSize = 0;
-Buffer::FreeList* Buffer::g_freeList = nullptr;
-struct Buffer::LocalStaticDestructor Buffer::g_localStaticDestructor;
-
-Buffer::LocalStaticDestructor::~LocalStaticDestructor()
-{
-    NS_LOG_FUNCTION(this);
-    if (IS_INITIALIZED(g_freeList))
-    {
-        for (Buffer::FreeList::iterator i = g_freeList->begin(); i != g_freeList->end(); i++)
-        {
-            Buffer::Deallocate(*i);
-        }
-        delete g_freeList;
-        g_freeList = DESTROYED;
-    }
-}
-
-void
-Buffer::Recycle(struct Buffer::Data* data)
-{
-    NS_LOG_FUNCTION(data);
-    NS_ASSERT(data->m_count == 0);
-    NS_ASSERT(!IS_UNINITIALIZED(g_freeList));
-    g_maxSize = std::max(g_maxSize, data->m_size);
-    /* feed into free list */
-    if (data->m_size < g_maxSize || IS_DESTROYED(g_freeList) || g_freeList->size() > 1000)
-    {
-        Buffer::Deallocate(data);
-    }
-    else
-    {
-        NS_ASSERT(IS_INITIALIZED(g_freeList));
-        g_freeList->push_back(data);
-    }
-}
-
-Buffer::Data*
-Buffer::Create(uint32_t dataSize)
-{
-    NS_LOG_FUNCTION(dataSize);
-    /* try to find a buffer correctly sized. */
-    if (IS_UNINITIALIZED(g_freeList))
-    {
-        g_freeList = new Buffer::FreeList();
-    }
-    else if (IS_INITIALIZED(g_freeList))
-    {
-        while (!g_freeList->empty())
-        {
-            struct Buffer::Data* data = g_freeList->back();
-            g_freeList->pop_back();
-            if (data->m_size >= dataSize)
-            {
-                data->m_count = 1;
-                return data;
-            }
-            Buffer::Deallocate(data);
-        }
-    }
-    struct Buffer::Data* data = Buffer::Allocate(dataSize);
-    NS_ASSERT(data->m_count == 1);
-    return data;
-}
-#else  /* BUFFER_FREE_LIST */
-void
-Buffer::Recycle(struct Buffer::Data* data)
-{
-    NS_LOG_FUNCTION(data);
-    NS_ASSERT(data->m_count == 0);
-    Deallocate(data);
-}
-
-Buffer::Data*
-Buffer::Create(uint32_t size)
-{
-    NS_LOG_FUNCTION(size);
-    return Allocate(size);
-}
-#endif /* BUFFER_FREE_LIST */
-
+#endif
 struct Buffer::Data*
 Buffer::Allocate(uint32_t reqSize)
 {
@@ -169,11 +70,11 @@ Buffer::Allocate(uint32_t reqSize)
         reqSize = 1;
     }
     NS_ASSERT(reqSize >= 1);
-    uint32_t size = reqSize - 1 + sizeof(struct Buffer::Data);
-    uint8_t* b = new uint8_t[size];
-    struct Buffer::Data* data = reinterpret_cast<struct Buffer::Data*>(b);
-    data->m_size = reqSize;
+    std::size_t blockSize = BufferPool::GetBlockSize(reqSize - 1 + sizeof(struct Buffer::Data));
+    struct Buffer::Data* data = static_cast<struct Buffer::Data*>(BufferPool::Allocate(blockSize));
+    data->m_size = blockSize + 1 - sizeof(struct Buffer::Data);
     data->m_count = 1;
+    PacketAccounting::NotifyAllocated(data->m_size);
     return data;
 }
 
@@ -182,8 +83,8 @@ Buffer::Deallocate(struct Buffer::Data* data)
 {
     NS_LOG_FUNCTION(data);
     NS_ASSERT(data->m_count == 0);
-    uint8_t* buf = reinterpret_cast<uint8_t*>(data);
-    delete[] buf;
+    PacketAccounting::NotifyDeallocated(data->m_size);
+    BufferPool::Deallocate(data, data->m_size - 1 + sizeof(struct Buffer::Data));
 }
 
 Buffer::Buffer()
@@ -207,6 +108,25 @@ Buffer::Buffer(uint32_t dataSize, bool initialize)
     }
 }
 
+Buffer::Buffer(Ptr<const SharedPayload> payload, uint32_t start, uint32_t size)
+{
+    NS_LOG_FUNCTION(this << payload << start << size);
+    NS_ASSERT(start + size <= payload->GetSize());
+    Initialize(size);
+    if (size > 0)
+    {
+        m_payload = payload;
+        m_payloadStart = start;
+    }
+}
+
+Ptr<const SharedPayload>
+Buffer::GetSharedPayload() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_payload;
+}
+
 bool
 Buffer::CheckInternalState() const
 {
@@ -245,7 +165,7 @@ void
 Buffer::Initialize(uint32_t zeroSize)
 {
     NS_LOG_FUNCTION(this << zeroSize);
-    m_data = Buffer::Create(0);
+    m_data = Buffer::Allocate(0);
     m_start = std::min(m_data->m_size, g_recommendedStart);
     m_maxZeroAreaStart = m_start;
     m_zeroAreaStart = m_start;
@@ -253,6 +173,8 @@ Buffer::Initialize(uint32_t zeroSize)
     m_end = m_zeroAreaEnd;
     m_data->m_dirtyStart = m_start;
     m_data->m_dirtyEnd = m_end;
+    m_payload = nullptr;
+    m_payloadStart = 0;
     NS_ASSERT(CheckInternalState());
 }
 
@@ -263,10 +185,9 @@ Buffer::operator=(const Buffer& o)
     if (m_data != o.m_data)
     {
         // not assignment to self.
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        if (--m_data->m_count == 0)
         {
-            Recycle(m_data);
+            Deallocate(m_data);
         }
         m_data = o.m_data;
         m_data->m_count++;
@@ -277,6 +198,8 @@ Buffer::operator=(const Buffer& o)
     m_zeroAreaEnd = o.m_zeroAreaEnd;
     m_start = o.m_start;
     m_end = o.m_end;
+    m_payload = o.m_payload;
+    m_payloadStart = o.m_payloadStart;
     NS_ASSERT(CheckInternalState());
     return *this;
 }
@@ -286,10 +209,9 @@ Buffer::~Buffer()
     NS_LOG_FUNCTION(this);
     NS_ASSERT(CheckInternalState());
     g_recommendedStart = std::max(g_recommendedStart, m_maxZeroAreaStart);
-    m_data->m_count--;
-    if (m_data->m_count == 0)
+    if (--m_data->m_count == 0)
     {
-        Recycle(m_data);
+        Deallocate(m_data);
     }
 }
 
@@ -312,7 +234,11 @@ Buffer::AddAtStart(uint32_t start)
 {
     NS_LOG_FUNCTION(this << start);
     NS_ASSERT(CheckInternalState());
+#ifdef NS3_MTP
+    bool isDirty = m_data->m_count > 1;
+#else
     bool isDirty = m_data->m_count > 1 && m_start > m_data->m_dirtyStart;
+#endif
     if (m_start >= start && !isDirty)
     {
         /* enough space in the buffer and not dirty.
@@ -328,16 +254,18 @@ Buffer::AddAtStart(uint32_t start)
     else
     {
         uint32_t newSize = GetInternalSize() + start;
-        struct Buffer::Data* newData = Buffer::Create(newSize);
-        memcpy(newData->m_data + start, m_data->m_data + m_start, GetInternalSize());
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        struct Buffer::Data* newData = Buffer::Allocate(newSize);
+        // The block is rounded up to its size class: keep the spare bytes
+        // in front of the data, for the next headers.
+        uint32_t headroom = newData->m_size - newSize;
+        memcpy(newData->m_data + headroom + start, m_data->m_data + m_start, GetInternalSize());
+        if (--m_data->m_count == 0)
         {
-            Buffer::Recycle(m_data);
+            Buffer::Deallocate(m_data);
         }
         m_data = newData;
 
-        int32_t delta = start - m_start;
+        int32_t delta = headroom + start - m_start;
         m_start += delta;
         m_zeroAreaStart += delta;
         m_zeroAreaEnd += delta;
@@ -358,7 +286,11 @@ Buffer::AddAtEnd(uint32_t end)
 {
     NS_LOG_FUNCTION(this << end);
     NS_ASSERT(CheckInternalState());
+#ifdef NS3_MTP
+    bool isDirty = m_data->m_count > 1;
+#else
     bool isDirty = m_data->m_count > 1 && m_end < m_data->m_dirtyEnd;
+#endif
     if (GetInternalEnd() + end <= m_data->m_size && !isDirty)
     {
         /* enough space in buffer and not dirty
@@ -374,12 +306,11 @@ Buffer::AddAtEnd(uint32_t end)
     else
     {
         uint32_t newSize = GetInternalSize() + end;
-        struct Buffer::Data* newData = Buffer::Create(newSize);
+        struct Buffer::Data* newData = Buffer::Allocate(newSize);
         memcpy(newData->m_data, m_data->m_data + m_start, GetInternalSize());
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        if (--m_data->m_count == 0)
         {
-            Buffer::Recycle(m_data);
+            Buffer::Deallocate(m_data);
         }
         m_data = newData;
 
@@ -404,21 +335,51 @@ Buffer::AddAtEnd(const Buffer& o)
 {
     NS_LOG_FUNCTION(this << &o);
 
-    if (m_data->m_count == 1 && (m_end == m_zeroAreaEnd || m_zeroAreaStart == m_zeroAreaEnd) &&
-        m_end == m_data->m_dirtyEnd && o.m_start == o.m_zeroAreaStart &&
-        o.m_zeroAreaEnd - o.m_zeroAreaStart > 0)
+    uint32_t zeroSize = m_zeroAreaEnd - m_zeroAreaStart;
+    // The zero areas can be merged if one is empty, or if both hold zero
+    // bytes, or if both hold adjacent slices of the same payload.
+    bool mergeable =
+        zeroSize == 0 ||
+        (m_payload == o.m_payload && (!m_payload || m_payloadStart + zeroSize == o.m_payloadStart));
+    if ((m_data->m_count > 1 || m_end == m_data->m_dirtyEnd) &&
+        (m_end == m_zeroAreaEnd || zeroSize == 0) && o.m_start == o.m_zeroAreaStart &&
+        o.m_zeroAreaEnd - o.m_zeroAreaStart > 0 && mergeable)
     {
         /**
          * This is an optimization which kicks in when
          * we attempt to aggregate two buffers which contain
          * adjacent zero areas.
          */
-        if (m_zeroAreaStart == m_zeroAreaEnd)
+        if (m_data->m_count > 1)
+        {
+            /* m_data is shared, for instance with the other fragments
+             * of a packet: copy only the real bytes, and keep the zero
+             * area virtual.
+             */
+            struct Buffer::Data* newData = Buffer::Allocate(GetInternalSize());
+            memcpy(newData->m_data, m_data->m_data + m_start, GetInternalSize());
+            if (--m_data->m_count == 0)
+            {
+                Buffer::Deallocate(m_data);
+            }
+            m_data = newData;
+
+            int32_t delta = -m_start;
+            m_zeroAreaStart += delta;
+            m_zeroAreaEnd += delta;
+            m_end += delta;
+            m_start += delta;
+
+            m_data->m_dirtyStart = m_start;
+            m_data->m_dirtyEnd = m_end;
+        }
+        if (zeroSize == 0)
         {
             m_zeroAreaStart = m_end;
+            m_payload = o.m_payload;
+            m_payloadStart = o.m_payloadStart;
         }
-        uint32_t zeroSize = o.m_zeroAreaEnd - o.m_zeroAreaStart;
-        m_zeroAreaEnd = m_end + zeroSize;
+        m_zeroAreaEnd = m_end + o.m_zeroAreaEnd - o.m_zeroAreaStart;
         m_end = m_zeroAreaEnd;
         m_data->m_dirtyEnd = m_zeroAreaEnd;
         uint32_t endData = o.m_end - o.m_zeroAreaEnd;
@@ -432,6 +393,33 @@ Buffer::AddAtEnd(const Buffer& o)
         return;
     }
 
+    if (o.m_zeroAreaStart == o.m_zeroAreaEnd && m_payload && m_data != o.m_data)
+    {
+        /**
+         * Append the real bytes of o after our payload, which
+         * is not copied.
+         */
+        AddAtEnd(o.GetSize());
+        Buffer::Iterator destStart = End();
+        destStart.Prev(o.GetSize());
+        destStart.Write(o.Begin(), o.End());
+        NS_ASSERT(CheckInternalState());
+        return;
+    }
+    if (zeroSize == 0 && o.m_payload && m_data != o.m_data)
+    {
+        /**
+         * Prepend our real bytes before the payload of o, which
+         * is not copied.
+         */
+        Buffer tmp = o;
+        tmp.AddAtStart(GetSize());
+        tmp.Begin().Write(Begin(), End());
+        *this = tmp;
+        NS_ASSERT(CheckInternalState());
+        return;
+    }
+
     *this = CreateFullCopy();
     AddAtEnd(o.GetSize());
     Buffer::Iterator destStart = End();
@@ -460,6 +448,7 @@ Buffer::RemoveAtStart(uint32_t start)
         m_start = m_zeroAreaStart;
         m_zeroAreaEnd -= delta;
         m_end -= delta;
+        m_payloadStart += delta;
     }
     else if (newStart <= m_end)
     {
@@ -481,6 +470,10 @@ Buffer::RemoveAtStart(uint32_t start)
         m_zeroAreaEnd = m_end;
         m_zeroAreaStart = m_end;
     }
+    if (m_zeroAreaStart == m_zeroAreaEnd)
+    {
+        m_payload = nullptr;
+    }
     m_maxZeroAreaStart = std::max(m_maxZeroAreaStart, m_zeroAreaStart);
     LOG_INTERNAL_STATE("rem start=" << start << ", ");
     NS_ASSERT(CheckInternalState());
@@ -517,6 +510,10 @@ Buffer::RemoveAtEnd(uint32_t end)
         m_zeroAreaEnd = m_start;
         m_zeroAreaStart = m_start;
     }
+    if (m_zeroAreaStart == m_zeroAreaEnd)
+    {
+        m_payload = nullptr;
+    }
     m_maxZeroAreaStart = std::max(m_maxZeroAreaStart, m_zeroAreaStart);
     LOG_INTERNAL_STATE("rem end=" << end << ", ");
     NS_ASSERT(CheckInternalState());
@@ -543,7 +540,15 @@ Buffer::CreateFullCopy() const
     {
         Buffer tmp;
         tmp.AddAtStart(m_zeroAreaEnd - m_zeroAreaStart);
-        tmp.Begin().WriteU8(0, m_zeroAreaEnd - m_zeroAreaStart);
+        if (m_payload)
+        {
+            tmp.Begin().Write(m_payload->GetData() + m_payloadStart,
+                              m_zeroAreaEnd - m_zeroAreaStart);
+        }
+        else
+        {
+            tmp.Begin().WriteU8(0, m_zeroAreaEnd - m_zeroAreaStart);
+        }
         uint32_t dataStart = m_zeroAreaStart - m_start;
         tmp.AddAtStart(dataStart);
         tmp.Begin().Write(m_data->m_data + m_start, dataStart);
@@ -563,6 +568,10 @@ uint32_t
 Buffer::GetSerializedSize() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_payload)
+    {
+        return CreateFullCopy().GetSerializedSize();
+    }
     uint32_t dataStart = (m_zeroAreaStart - m_start + 3) & (~0x3);
     uint32_t dataEnd = (m_end - m_zeroAreaEnd + 3) & (~0x3);
 
@@ -579,6 +588,10 @@ uint32_t
 Buffer::Serialize(uint8_t* buffer, uint32_t maxSize) const
 {
     NS_LOG_FUNCTION(this << &buffer << maxSize);
+    if (m_payload)
+    {
+        return CreateFullCopy().Serialize(buffer, maxSize);
+    }
     uint32_t* p = reinterpret_cast<uint32_t*>(buffer);
     uint32_t size = 0;
 
@@ -725,6 +738,11 @@ Buffer::CopyData(std::ostream* os, uint32_t size) const
             size -= m_zeroAreaStart - m_start;
             tmpsize = std::min(m_zeroAreaEnd - m_zeroAreaStart, size);
             uint32_t left = tmpsize;
+            if (m_payload)
+            {
+                os->write((const char*)(m_payload->GetData() + m_payloadStart), left);
+                left = 0;
+            }
             while (left > 0)
             {
                 uint32_t toWrite = std::min(left, g_zeroes.size);
@@ -756,6 +774,12 @@ Buffer::CopyData(uint8_t* buffer, uint32_t size) const
         {
             tmpsize = std::min(m_zeroAreaEnd - m_zeroAreaStart, size);
             uint32_t left = tmpsize;
+            if (m_payload)
+            {
+                memcpy(buffer, m_payload->GetData() + m_payloadStart, left);
+                buffer += left;
+                left = 0;
+            }
             while (left > 0)
             {
                 uint32_t toWrite = std::min(left, g_zeroes.size);
@@ -835,27 +859,42 @@ Buffer::Iterator::Write(Iterator start, Iterator end)
     NS_ASSERT(m_data != start.m_data);
     uint32_t size = end.m_current - start.m_current;
     NS_ASSERT_MSG(CheckNoZero(m_current, m_current + size), GetWriteErrorMessage());
+    uint8_t* to;
+    if (m_current <= m_zeroStart)
+    {
+        to = &m_data[m_current];
+    }
+    else
+    {
+        to = &m_data[m_current - (m_zeroEnd - m_zeroStart)];
+    }
+    m_current += size;
     if (start.m_current <= start.m_zeroStart)
     {
         uint32_t toCopy = std::min(size, start.m_zeroStart - start.m_current);
-        memcpy(&m_data[m_current], &start.m_data[start.m_current], toCopy);
+        memcpy(to, &start.m_data[start.m_current], toCopy);
         start.m_current += toCopy;
-        m_current += toCopy;
+        to += toCopy;
         size -= toCopy;
     }
     if (start.m_current <= start.m_zeroEnd)
     {
         uint32_t toCopy = std::min(size, start.m_zeroEnd - start.m_current);
-        memset(&m_data[m_current], 0, toCopy);
+        if (start.m_payload)
+        {
+            memcpy(to, &start.m_payload[start.m_current - start.m_zeroStart], toCopy);
+        }
+        else
+        {
+            memset(to, 0, toCopy);
+        }
         start.m_current += toCopy;
-        m_current += toCopy;
+        to += toCopy;
         size -= toCopy;
     }
     uint32_t toCopy = std::min(size, start.m_dataEnd - start.m_current);
     uint8_t* from = &start.m_data[start.m_current - (start.m_zeroEnd - start.m_zeroStart)];
-    uint8_t* to = &m_data[m_current];
     memcpy(to, from, toCopy);
-    m_current += toCopy;
 }
 
 void
@@ -19,13 +19,18 @@
 #ifndef BUFFER_H
 #define BUFFER_H
 
+#include "shared-payload.h"
+
 #include "ns3/assert.h"
+#include "ns3/ptr.h"
 
 #include <ostream>
 #include <stdint.h>
 #include <vector>
 
-#define BUFFER_FREE_LIST 1
+#ifdef NS3_MTP
+#include <atomic>
+#endif
 
 namespace ns3
 {
@@ -89,6 +94,12 @@ namespace ns3
  * \endverbatim
  *
  * A simple state invariant is that m_start <= m_zeroStart <= m_zeroEnd <= m_end
+ *
+ * A Buffer created from a SharedPayload uses its virtual zero area to
+ * reference a slice of the SharedPayload, starting at m_payloadStart,
+ * instead of zero bytes. As the zero bytes, the payload bytes are never
+ * written, and never copied when the Buffer is copied, fragmented or
+ * when headers and trailers are added or removed.
  */
 class Buffer
 {
@@ -250,6 +261,18 @@ class Buffer
          * in debug builds by asserts.
          */
         void Write(Iterator start, Iterator end);
+        /**
+         * \param size number of bytes to write.
+         * \return a pointer to the size bytes at the iterator position.
+         *
+         * Reserve the next size bytes of the buffer, in which a
+         * fixed-layout header can then be written at once, with
+         * HeaderField, instead of field by field, and advance the
+         * iterator position by size bytes.  The bytes are contiguous,
+         * since they cannot be in the "virtual zero area", and are not
+         * initialized.
+         */
+        inline uint8_t* WriteSpan(uint32_t size);
 
         /**
          * \return the byte read in the buffer.
@@ -356,6 +379,18 @@ class Buffer
          * read.
          */
         inline void Read(Iterator start, uint32_t size);
+        /**
+         * \param scratch buffer of at least size bytes
+         * \param size number of bytes to read
+         * \return a pointer to the size bytes at the iterator position.
+         *
+         * Return the next size bytes of the buffer, from which a
+         * fixed-layout header can then be read at once, with HeaderField,
+         * instead of field by field, and advance the iterator position by
+         * size bytes.  The bytes are returned in place when they are
+         * contiguous, and copied to scratch otherwise.
+         */
+        inline const uint8_t* ReadSpan(uint8_t* scratch, uint32_t size);
 
         /**
          * \brief Calculate the checksum.
@@ -452,6 +487,11 @@ class Buffer
          * \returns the error message
          */
         std::string GetWriteErrorMessage() const;
+        /**
+         * \param i buffer position, in the "virtual zero area"
+         * \returns the byte at this position.
+         */
+        inline uint8_t PeekZeroArea(uint32_t i) const;
 
         /**
          * offset in virtual bytes from the start of the data buffer to the
@@ -483,6 +523,11 @@ class Buffer
          * to this pointer.
          */
         uint8_t* m_data;
+        /**
+         * a pointer to the payload bytes of the "virtual zero area", or
+         * nullptr if this area holds zero bytes.
+         */
+        const uint8_t* m_payload;
     };
 
     /**
@@ -581,7 +626,8 @@ class Buffer
      * This buffer's contents are serialized into the raw
      * character buffer parameter. Note: The zero length
      * data is not copied entirely. Only the length of
-     * zero byte data is serialized.
+     * zero byte data is serialized. The bytes of a
+     * SharedPayload are serialized.
      */
     uint32_t Serialize(uint8_t* buffer, uint32_t maxSize) const;
 
@@ -642,8 +688,24 @@ class Buffer
      * \param initialize initialize the buffer with zeroes.
      */
     Buffer(uint32_t dataSize, bool initialize);
+    /**
+     * \brief Constructor
+     *
+     * The buffer will hold a slice of a SharedPayload, which is not copied.
+     *
+     * \param payload the payload
+     * \param start the offset of the slice in the payload
+     * \param size the size of the slice
+     */
+    Buffer(Ptr<const SharedPayload> payload, uint32_t start, uint32_t size);
     ~Buffer();
 
+    /**
+     * \returns the SharedPayload whose bytes this buffer holds, or nullptr
+     *          if it holds none.
+     */
+    Ptr<const SharedPayload> GetSharedPayload() const;
+
   private:
     /**
      * This data structure is variable-sized through its last member whose size
@@ -658,6 +720,9 @@ class Buffer
      * New user data can be safely written only outside of the "dirty
      * area" if the reference count is higher than 1 (that is, if
      * more than one Buffer instance references the same BufferData).
+     * With multithreaded parallel simulation support (\c NS3_MTP), the
+     * Buffer instances may live in different threads, so new user data
+     * is only written in place if the reference count is 1.
      */
     struct Data
     {
@@ -665,7 +730,11 @@ class Buffer
          * The reference count of an instance of this data structure.
          * Each buffer which references an instance holds a count.
          */
+#ifdef NS3_MTP
+        std::atomic<uint32_t> m_count;
+#else
         uint32_t m_count;
+#endif
         /**
          * the size of the m_data field below.
          */
@@ -729,24 +798,16 @@ class Buffer
     uint32_t GetInternalEnd() const;
 
     /**
-     * \brief Recycle the buffer memory
-     * \param data the buffer data storage
-     */
-    static void Recycle(struct Buffer::Data* data);
-    /**
-     * \brief Create a buffer data storage
-     * \param size the storage size to create
-     * \returns a pointer to the created buffer storage
-     */
-    static struct Buffer::Data* Create(uint32_t size);
-    /**
-     * \brief Allocate a buffer data storage
+     * \brief Allocate a buffer data storage from the BufferPool
+     *
+     * The size of the storage is rounded up to the BufferPool size class.
+     *
      * \param reqSize the storage size to create
      * \returns a pointer to the allocated buffer storage
      */
     static struct Buffer::Data* Allocate(uint32_t reqSize);
     /**
-     * \brief Deallocate the buffer memory
+     * \brief Return the buffer memory to the BufferPool
      * \param data the buffer data storage
      */
     static void Deallocate(struct Buffer::Data* data);
@@ -769,7 +830,11 @@ class Buffer
      * writing data. i.e., m_start should be initialized to this
      * value.
      */
+#ifdef NS3_MTP
+    static thread_local uint32_t g_recommendedStart;
+#else
     static uint32_t g_recommendedStart;
+#endif
 
     /**
      * offset to the start of the virtual zero area from the start
@@ -791,21 +856,15 @@ class Buffer
      * instance from the start of m_data->m_data
      */
     uint32_t m_end;
-
-#ifdef BUFFER_FREE_LIST
-    /// Container for buffer data
-    typedef std::vector<struct Buffer::Data*> FreeList;
-
-    /// Local static destructor structure
-    struct LocalStaticDestructor
-    {
-        ~LocalStaticDestructor();
-    };
-
-    static uint32_t g_maxSize;                            //!< Max observed data size
-    static FreeList* g_freeList;                          //!< Buffer data container
-    static LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
-#endif
+    /**
+     * the payload referenced by the virtual zero area, if any.
+     */
+    Ptr<const SharedPayload> m_payload;
+    /**
+     * offset to the start of the virtual zero area from the start
+     * of the bytes of m_payload
+     */
+    uint32_t m_payloadStart;
 };
 
 } // namespace ns3
@@ -823,7 +882,8 @@ Buffer::Iterator::Iterator()
       m_dataStart(0),
       m_dataEnd(0),
       m_current(0),
-      m_data(nullptr)
+      m_data(nullptr),
+      m_payload(nullptr)
 {
 }
 
@@ -847,6 +907,7 @@ Buffer::Iterator::Construct(const Buffer* buffer)
     m_dataStart = buffer->m_start;
     m_dataEnd = buffer->m_end;
     m_data = buffer->m_data->m_data;
+    m_payload = buffer->m_payload ? buffer->m_payload->GetData() + buffer->m_payloadStart : nullptr;
 }
 
 void
@@ -950,6 +1011,46 @@ Buffer::Iterator::WriteHtonU32(uint32_t data)
     m_current += 4;
 }
 
+uint8_t*
+Buffer::Iterator::WriteSpan(uint32_t size)
+{
+    NS_ASSERT_MSG(CheckNoZero(m_current, m_current + size), GetWriteErrorMessage());
+    uint8_t* buffer;
+    if (m_current + size <= m_zeroStart)
+    {
+        buffer = &m_data[m_current];
+    }
+    else
+    {
+        buffer = &m_data[m_current - (m_zeroEnd - m_zeroStart)];
+    }
+    m_current += size;
+    return buffer;
+}
+
+const uint8_t*
+Buffer::Iterator::ReadSpan(uint8_t* scratch, uint32_t size)
+{
+    NS_ASSERT_MSG(m_current >= m_dataStart && m_current + size <= m_dataEnd,
+                  GetReadErrorMessage());
+    const uint8_t* buffer;
+    if (m_current + size <= m_zeroStart)
+    {
+        buffer = &m_data[m_current];
+    }
+    else if (m_current >= m_zeroEnd)
+    {
+        buffer = &m_data[m_current - (m_zeroEnd - m_zeroStart)];
+    }
+    else
+    {
+        Read(scratch, size);
+        return scratch;
+    }
+    m_current += size;
+    return buffer;
+}
+
 uint16_t
 Buffer::Iterator::ReadNtohU16()
 {
@@ -1014,7 +1115,7 @@ Buffer::Iterator::PeekU8()
     }
     else if (m_current < m_zeroEnd)
     {
-        return 0;
+        return PeekZeroArea(m_current);
     }
     else
     {
@@ -1023,6 +1124,12 @@ Buffer::Iterator::PeekU8()
     }
 }
 
+uint8_t
+Buffer::Iterator::PeekZeroArea(uint32_t i) const
+{
+    return m_payload == nullptr ? 0 : m_payload[i - m_zeroStart];
+}
+
 uint8_t
 Buffer::Iterator::ReadU8()
 {
@@ -1058,7 +1165,9 @@ Buffer::Buffer(const Buffer& o)
       m_zeroAreaStart(o.m_zeroAreaStart),
       m_zeroAreaEnd(o.m_zeroAreaEnd),
       m_start(o.m_start),
-      m_end(o.m_end)
+      m_end(o.m_end),
+      m_payload(o.m_payload),
+      m_payloadStart(o.m_payloadStart)
 {
     m_data->m_count++;
     NS_ASSERT(CheckInternalState());
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef HEADER_FIELD_H
+#define HEADER_FIELD_H
+
+#include <stdint.h>
+#include <type_traits>
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::HeaderField declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup packet
+ * \brief A field of a fixed-layout header.
+ *
+ * A header whose layout is fixed can write all its fields at once in the
+ * span returned by Buffer::Iterator::WriteSpan, and read them from the
+ * span returned by Buffer::Iterator::ReadSpan, instead of calling the
+ * Buffer::Iterator methods, which check the position of the iterator,
+ * for each field:
+ *
+ * \code
+ *   using SourcePort = HeaderField<0, uint16_t>;
+ *   using DestinationPort = HeaderField<SourcePort::END, uint16_t>;
+ *
+ *   uint8_t* header = start.WriteSpan(DestinationPort::END);
+ *   SourcePort::Write(header, m_sourcePort);
+ *   DestinationPort::Write(header, m_destinationPort);
+ * \endcode
+ *
+ * As the offsets and sizes of the fields are known at compile time, the
+ * compiler merges the byte order conversions and the accesses to the
+ * bytes of each field into a single load or store.
+ *
+ * \tparam OFFSET the offset of the field from the start of the header.
+ * \tparam T the unsigned integer type of the field.
+ * \tparam NETWORK_ORDER whether the field is in network byte order, as
+ *         written by Buffer::Iterator::WriteHtonU16, or in least
+ *         significant byte order, as written by Buffer::Iterator::WriteU16.
+ */
+template <uint32_t OFFSET, typename T, bool NETWORK_ORDER = true>
+struct HeaderField
+{
+    static_assert(std::is_unsigned_v<T>, "A header field must be an unsigned integer");
+
+    /// The offset following the field
+    static const uint32_t END = OFFSET + sizeof(T);
+
+    /**
+     * \param header the start of the header.
+     * \param value the value of the field, in host byte order.
+     */
+    static inline void Write(uint8_t* header, T value);
+    /**
+     * \param header the start of the header.
+     * \returns the value of the field, in host byte order.
+     */
+    static inline T Read(const uint8_t* header);
+};
+
+/*************************************************
+ *  Inline implementations
+ ************************************************/
+
+template <uint32_t OFFSET, typename T, bool NETWORK_ORDER>
+void
+HeaderField<OFFSET, T, NETWORK_ORDER>::Write(uint8_t* header, T value)
+{
+    for (uint32_t k = 0; k < sizeof(T); ++k)
+    {
+        uint32_t shift = 8 * (NETWORK_ORDER ? sizeof(T) - 1 - k : k);
+        header[OFFSET + k] = static_cast<uint8_t>(value >> shift);
+    }
+}
+
+template <uint32_t OFFSET, typename T, bool NETWORK_ORDER>
+T
+HeaderField<OFFSET, T, NETWORK_ORDER>::Read(const uint8_t* header)
+{
+    T value = 0;
+    for (uint32_t k = 0; k < sizeof(T); ++k)
+    {
+        uint32_t shift = 8 * (NETWORK_ORDER ? sizeof(T) - 1 - k : k);
+        value |= static_cast<T>(static_cast<T>(header[OFFSET + k]) << shift);
+    }
+    return value;
+}
+
+} // namespace ns3
+
+#endif /* HEADER_FIELD_H */
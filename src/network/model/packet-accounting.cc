@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "packet-accounting.h"
+
+#include "packet.h"
+
+#include "ns3/log.h"
+#include "ns3/object.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#ifdef NS3_MTP
+#include <mutex>
+#endif
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::PacketAccounting implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PacketAccounting");
+
+bool PacketAccounting::m_enabled = false;
+
+namespace
+{
+
+/// The record of a live packet
+struct PacketRecord
+{
+    Time created;         //!< The creation time
+    uint32_t node;        //!< The creation node
+    const Object* holder; //!< The holder, or nullptr
+};
+
+/// The record of a holder of live packets
+struct HolderRecord
+{
+    std::string name; //!< The type of the holder
+    uint32_t node;    //!< The node of the holder
+    uint64_t packets; //!< The number of packets held
+};
+
+/// The live packets and their holders
+struct AccountingState
+{
+    std::unordered_map<const Packet*, PacketRecord> packets; //!< The live packets
+    std::unordered_map<const Object*, HolderRecord> holders; //!< The holders of live packets
+    int64_t bufferBytes{0};                                  //!< The allocated buffer bytes
+#ifdef NS3_MTP
+    std::mutex mutex; //!< Serializes the notifications of the threads
+#endif
+};
+
+} // namespace
+
+/**
+ * \returns The state of the accounting, which is never destroyed, as the
+ * static packets may be destroyed after the static variables of this file.
+ */
+static AccountingState&
+GetState()
+{
+    static AccountingState* state = new AccountingState;
+    return *state;
+}
+
+/**
+ * \brief Add a packet to a usage.
+ * \param usage The usage.
+ * \param bytes The size of the packet.
+ * \param age The age of the packet.
+ */
+static void
+AddPacket(PacketAccounting::Usage& usage, uint32_t bytes, Time age)
+{
+    usage.packets++;
+    usage.bytes += bytes;
+    usage.maxAge = std::max(usage.maxAge, age);
+}
+
+/**
+ * \brief Print a usage.
+ * \param os The output stream.
+ * \param usage The usage.
+ */
+static void
+PrintUsage(std::ostream& os, const PacketAccounting::Usage& usage)
+{
+    os << usage.packets << " packets, " << usage.bytes << " bytes, oldest "
+       << usage.maxAge.As(Time::S);
+}
+
+/**
+ * \brief Print a node.
+ * \param os The output stream.
+ * \param node The node, or Simulator::NO_CONTEXT.
+ */
+static void
+PrintNode(std::ostream& os, uint32_t node)
+{
+    if (node == Simulator::NO_CONTEXT)
+    {
+        os << "no node";
+    }
+    else
+    {
+        os << "node " << node;
+    }
+}
+
+void
+PacketAccounting::Enable()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    m_enabled = true;
+}
+
+void
+PacketAccounting::Disable()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    AccountingState& state = GetState();
+#ifdef NS3_MTP
+    std::lock_guard<std::mutex> lock(state.mutex);
+#endif
+    m_enabled = false;
+    state.packets.clear();
+    state.holders.clear();
+    state.bufferBytes = 0;
+}
+
+void
+PacketAccounting::DoNotifyCreated(const Packet* p)
+{
+    AccountingState& state = GetState();
+    PacketRecord record{Simulator::Now(), Simulator::GetContext(), nullptr};
+#ifdef NS3_MTP
+    std::lock_guard<std::mutex> lock(state.mutex);
+#endif
+    state.packets[p] = record;
+}
+
+void
+PacketAccounting::DoNotifyDestroyed(const Packet* p)
+{
+    AccountingState& state = GetState();
+#ifdef NS3_MTP
+    std::lock_guard<std::mutex> lock(state.mutex);
+#endif
+    auto it = state.packets.find(p);
+    if (it == state.packets.end())
+    {
+        // created before the accounting was enabled
+        return;
+    }
+    if (it->second.holder)
+    {
+        auto holder = state.holders.find(it->second.holder);
+        if (--holder->second.packets == 0)
+        {
+            state.holders.erase(holder);
+        }
+    }
+    state.packets.erase(it);
+}
+
+void
+PacketAccounting::DoNotifyBuffer(int64_t delta)
+{
+    AccountingState& state = GetState();
+#ifdef NS3_MTP
+    std::lock_guard<std::mutex> lock(state.mutex);
+#endif
+    state.bufferBytes += delta;
+}
+
+void
+PacketAccounting::DoNotifyHeld(const Packet* p, const Object* holder)
+{
+    AccountingState& state = GetState();
+#ifdef NS3_MTP
+    std::lock_guard<std::mutex> lock(state.mutex);
+#endif
+    auto it = state.packets.find(p);
+    if (it == state.packets.end() || it->second.holder == holder)
+    {
+        return;
+    }
+    if (it->second.holder)
+    {
+        auto previous = state.holders.find(it->second.holder);
+        if (--previous->second.packets == 0)
+        {
+            state.holders.erase(previous);
+        }
+    }
+    it->second.holder = holder;
+    auto [entry, inserted] = state.holders.try_emplace(holder);
+    if (inserted)
+    {
+        // the holders are named when they start holding packets, as they
+        // may be destroyed before the report
+        entry->second.name = holder->GetInstanceTypeId().GetName();
+        entry->second.node = Simulator::GetContext();
+        entry->second.packets = 0;
+    }
+    entry->second.packets++;
+}
+
+void
+PacketAccounting::DoNotifyReleased(const Packet* p, const Object* holder)
+{
+    AccountingState& state = GetState();
+#ifdef NS3_MTP
+    std::lock_guard<std::mutex> lock(state.mutex);
+#endif
+    auto it = state.packets.find(p);
+    if (it == state.packets.end() || it->second.holder != holder)
+    {
+        return;
+    }
+    it->second.holder = nullptr;
+    auto entry = state.holders.find(holder);
+    if (--entry->second.packets == 0)
+    {
+        state.holders.erase(entry);
+    }
+}
+
+PacketAccounting::Snapshot
+PacketAccounting::GetSnapshot()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    AccountingState& state = GetState();
+#ifdef NS3_MTP
+    std::lock_guard<std::mutex> lock(state.mutex);
+#endif
+    Snapshot snapshot;
+    snapshot.time = Simulator::Now();
+    snapshot.bufferBytes = std::max<int64_t>(state.bufferBytes, 0);
+
+    std::unordered_map<const Object*, Usage> holders;
+    for (const auto& [p, record] : state.packets)
+    {
+        uint32_t bytes = p->GetSize();
+        Time age = snapshot.time - record.created;
+        AddPacket(snapshot.total, bytes, age);
+        AddPacket(snapshot.nodes[record.node], bytes, age);
+        AddPacket(record.holder ? holders[record.holder] : snapshot.unheld, bytes, age);
+    }
+    for (const auto& [holder, usage] : holders)
+    {
+        const HolderRecord& record = state.holders.at(holder);
+        snapshot.holders.push_back({record.name, record.node, usage});
+    }
+    std::sort(snapshot.holders.begin(),
+              snapshot.holders.end(),
+              [](const HolderUsage& a, const HolderUsage& b) {
+                  return a.usage.bytes > b.usage.bytes;
+              });
+    return snapshot;
+}
+
+void
+PacketAccounting::Report(std::ostream& os, uint32_t n)
+{
+    NS_LOG_FUNCTION(&os << n);
+    Snapshot snapshot = GetSnapshot();
+
+    os << "Live packets at " << snapshot.time.As(Time::S) << ": ";
+    PrintUsage(os, snapshot.total);
+    os << ", in " << snapshot.bufferBytes << " buffer bytes" << std::endl;
+    os << "  Not held: ";
+    PrintUsage(os, snapshot.unheld);
+    os << std::endl;
+
+    std::vector<HolderUsage> holders = snapshot.holders;
+    std::size_t count = std::min<std::size_t>(n, holders.size());
+    std::partial_sort(holders.begin(),
+                      holders.begin() + count,
+                      holders.end(),
+                      [](const HolderUsage& a, const HolderUsage& b) {
+                          return a.usage.maxAge > b.usage.maxAge;
+                      });
+    os << "  Oldest holders:" << std::endl;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        os << "    " << holders[i].name << " on ";
+        PrintNode(os, holders[i].node);
+        os << ": ";
+        PrintUsage(os, holders[i].usage);
+        os << std::endl;
+    }
+    os << "  Largest holders:" << std::endl;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        os << "    " << snapshot.holders[i].name << " on ";
+        PrintNode(os, snapshot.holders[i].node);
+        os << ": ";
+        PrintUsage(os, snapshot.holders[i].usage);
+        os << std::endl;
+    }
+
+    using NodeUsage = std::pair<uint32_t, Usage>;
+    std::vector<NodeUsage> nodes(snapshot.nodes.begin(), snapshot.nodes.end());
+    count = std::min<std::size_t>(n, nodes.size());
+    std::partial_sort(nodes.begin(),
+                      nodes.begin() + count,
+                      nodes.end(),
+                      [](const NodeUsage& a, const NodeUsage& b) {
+                          return a.second.bytes > b.second.bytes;
+                      });
+    os << "  Largest creation nodes:" << std::endl;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        os << "    ";
+        PrintNode(os, nodes[i].first);
+        os << ": ";
+        PrintUsage(os, nodes[i].second);
+        os << std::endl;
+    }
+}
+
+void
+PacketAccounting::EnablePeriodicReport(Time interval, std::ostream& os, uint32_t n)
+{
+    NS_LOG_FUNCTION(interval << &os << n);
+    Simulator::Schedule(interval, &PacketAccounting::PeriodicReport, interval, &os, n);
+}
+
+void
+PacketAccounting::PeriodicReport(Time interval, std::ostream* os, uint32_t n)
+{
+    Report(*os, n);
+    if (!Simulator::IsFinished())
+    {
+        Simulator::Schedule(interval, &PacketAccounting::PeriodicReport, interval, os, n);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PACKET_ACCOUNTING_H
+#define PACKET_ACCOUNTING_H
+
+#include "ns3/nstime.h"
+
+#include <map>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::PacketAccounting declaration.
+ */
+
+namespace ns3
+{
+
+class Object;
+class Packet;
+
+/**
+ * \ingroup packet
+ * \brief Accounting of the live packets, to find where memory accumulates.
+ *
+ * Once enabled, the accounting records the creation time and the creation
+ * node, the context of the simulator, of each packet created, until the
+ * packet is destroyed, as well as the bytes of the packet buffers which
+ * are allocated.  The objects which store packets, such as the Queue, the
+ * TcpTxBuffer and the LteRlcAm, notify the accounting of the packets they
+ * hold, so that the live packets are reported by holder: a queue whose
+ * packets grow old or numerous points at the leak.  The live packets that
+ * no holder reports are carried by the pending events, the applications
+ * or the other objects of the models.
+ *
+ * GetSnapshot returns the usage of the live packets, Report prints the
+ * totals and the N holders with the oldest and the most bytes, and
+ * EnablePeriodicReport prints the report at regular intervals of the
+ * simulation.
+ *
+ * The accounting costs a test of a flag per packet when it is disabled,
+ * and a hash table update per packet created, held or destroyed when it
+ * is enabled.
+ */
+class PacketAccounting
+{
+  public:
+    /// The usage of a set of live packets
+    struct Usage
+    {
+        uint64_t packets{0}; //!< The number of packets
+        uint64_t bytes{0};   //!< The number of bytes of the packets
+        Time maxAge;         //!< The age of the oldest packet
+    };
+
+    /// The usage of the packets of a holder
+    struct HolderUsage
+    {
+        std::string name; //!< The type of the holder
+        uint32_t node;    //!< The node of the holder, or Simulator::NO_CONTEXT
+        Usage usage;      //!< The packets held
+    };
+
+    /// A snapshot of the live packets
+    struct Snapshot
+    {
+        Time time;                        //!< The time of the snapshot
+        Usage total;                      //!< All the live packets
+        Usage unheld;                     //!< The live packets which no holder reports
+        uint64_t bufferBytes{0};          //!< The bytes of the allocated packet buffers
+        std::map<uint32_t, Usage> nodes;  //!< The live packets by creation node
+        std::vector<HolderUsage> holders; //!< The live packets by holder
+    };
+
+    /**
+     * \brief Enable the accounting.
+     *
+     * The packets created before the accounting is enabled are not
+     * accounted for, so that it should be enabled before the simulation
+     * starts.
+     */
+    static void Enable();
+    /**
+     * \brief Disable the accounting, and forget the live packets.
+     */
+    static void Disable();
+    /**
+     * \returns true if the accounting is enabled.
+     */
+    static inline bool IsEnabled();
+
+    /**
+     * \brief Notify the creation of a packet.
+     * \param p The packet.
+     */
+    static inline void NotifyCreated(const Packet* p);
+    /**
+     * \brief Notify the destruction of a packet.
+     * \param p The packet.
+     */
+    static inline void NotifyDestroyed(const Packet* p);
+    /**
+     * \brief Notify the allocation of a packet buffer.
+     * \param size The size of the buffer.
+     */
+    static inline void NotifyAllocated(uint32_t size);
+    /**
+     * \brief Notify the deallocation of a packet buffer.
+     * \param size The size of the buffer.
+     */
+    static inline void NotifyDeallocated(uint32_t size);
+    /**
+     * \brief Notify that a holder stores a packet, until it releases it
+     * or the packet is destroyed.
+     *
+     * \param p The packet.
+     * \param holder The holder, which is named after its type.
+     */
+    static inline void NotifyHeld(const Packet* p, const Object* holder);
+    /**
+     * \brief Notify that a holder no longer stores a packet.
+     * \param p The packet.
+     * \param holder The holder.
+     */
+    static inline void NotifyReleased(const Packet* p, const Object* holder);
+
+    /**
+     * \returns The usage of the live packets, with the holders sorted by
+     * decreasing bytes.
+     */
+    static Snapshot GetSnapshot();
+    /**
+     * \brief Print the usage of the live packets.
+     * \param os The output stream.
+     * \param n The number of holders and nodes listed.
+     */
+    static void Report(std::ostream& os, uint32_t n = 10);
+    /**
+     * \brief Print the usage of the live packets at regular intervals, as
+     * long as events remain scheduled.
+     *
+     * \param interval The interval between the reports.
+     * \param os The output stream, which must outlive the simulation.
+     * \param n The number of holders and nodes listed.
+     */
+    static void EnablePeriodicReport(Time interval, std::ostream& os, uint32_t n = 10);
+
+  private:
+    /**
+     * \copydoc NotifyCreated
+     */
+    static void DoNotifyCreated(const Packet* p);
+    /**
+     * \copydoc NotifyDestroyed
+     */
+    static void DoNotifyDestroyed(const Packet* p);
+    /**
+     * \brief Notify the allocation or deallocation of a packet buffer.
+     * \param delta The size of the allocated buffer, or the opposite of the
+     * size of the deallocated buffer.
+     */
+    static void DoNotifyBuffer(int64_t delta);
+    /**
+     * \copydoc NotifyHeld
+     */
+    static void DoNotifyHeld(const Packet* p, const Object* holder);
+    /**
+     * \copydoc NotifyReleased
+     */
+    static void DoNotifyReleased(const Packet* p, const Object* holder);
+    /**
+     * \brief Print the report and schedule the next one.
+     * \param interval The interval between the reports.
+     * \param os The output stream.
+     * \param n The number of holders and nodes listed.
+     */
+    static void PeriodicReport(Time interval, std::ostream* os, uint32_t n);
+
+    static bool m_enabled; //!< Whether the accounting is enabled
+};
+
+/*************************************************
+ *  Inline implementations
+ ************************************************/
+
+bool
+PacketAccounting::IsEnabled()
+{
+    return m_enabled;
+}
+
+void
+PacketAccounting::NotifyCreated(const Packet* p)
+{
+    if (m_enabled)
+    {
+        DoNotifyCreated(p);
+    }
+}
+
+void
+PacketAccounting::NotifyDestroyed(const Packet* p)
+{
+    if (m_enabled)
+    {
+        DoNotifyDestroyed(p);
+    }
+}
+
+void
+PacketAccounting::NotifyAllocated(uint32_t size)
+{
+    if (m_enabled)
+    {
+        DoNotifyBuffer(size);
+    }
+}
+
+void
+PacketAccounting::NotifyDeallocated(uint32_t size)
+{
+    if (m_enabled)
+    {
+        DoNotifyBuffer(-static_cast<int64_t>(size));
+    }
+}
+
+void
+PacketAccounting::NotifyHeld(const Packet* p, const Object* holder)
+{
+    if (m_enabled)
+    {
+        DoNotifyHeld(p, holder);
+    }
+}
+
+void
+PacketAccounting::NotifyReleased(const Packet* p, const Object* holder)
+{
+    if (m_enabled)
+    {
+        DoNotifyReleased(p, holder);
+    }
+}
+
+} // namespace ns3
+
+#endif /* PACKET_ACCOUNTING_H */
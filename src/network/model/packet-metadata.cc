@@ -36,8 +36,14 @@ NS_LOG_COMPONENT_DEFINE("PacketMetadata");
 
 bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
+bool PacketMetadata::m_enableCompact = false;
+#ifdef NS3_MTP
+std::atomic<bool> PacketMetadata::m_metadataSkipped = false;
+thread_local uint32_t PacketMetadata::m_maxSize = 0;
+#else
 bool PacketMetadata::m_metadataSkipped = false;
 uint32_t PacketMetadata::m_maxSize = 0;
+#endif
 uint16_t PacketMetadata::m_chunkUid = 0;
 PacketMetadata::DataFreeList PacketMetadata::m_freeList;
 
@@ -73,6 +79,126 @@ PacketMetadata::EnableChecking()
     m_enableChecking = true;
 }
 
+void
+PacketMetadata::EnableCompact()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    Enable();
+#ifndef NS3_MTP
+    m_enableCompact = true;
+#endif
+}
+
+void
+PacketMetadata::DisableCompact()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    m_enableCompact = false;
+}
+
+bool
+PacketMetadata::IsCompactEnabled()
+{
+    return m_enableCompact;
+}
+
+bool
+PacketMetadata::AddCompact(uint32_t uid, uint32_t size, bool atStart)
+{
+    NS_LOG_FUNCTION(this << uid << size << atStart);
+    if (m_compact == nullptr || m_compact->m_count > 1)
+    {
+        // allocate the array, or copy it if it is shared
+        auto compact = new PacketMetadata::CompactData;
+        compact->m_count = 1;
+        if (m_compact != nullptr)
+        {
+            std::copy(&m_compact->m_items[m_compactStart],
+                      &m_compact->m_items[m_compactEnd],
+                      &compact->m_items[m_compactStart]);
+        }
+        ReleaseCompact();
+        m_compact = compact;
+    }
+    CompactItem* items = m_compact->m_items;
+    if (atStart ? m_compactStart == 0 : m_compactEnd == COMPACT_SIZE)
+    {
+        uint8_t count = m_compactEnd - m_compactStart;
+        if (count == COMPACT_SIZE)
+        {
+            return false;
+        }
+        // move the items to the other end of the array
+        uint8_t newStart = atStart ? COMPACT_SIZE - count : 0;
+        std::memmove(&items[newStart], &items[m_compactStart], count * sizeof(CompactItem));
+        m_compactStart = newStart;
+        m_compactEnd = newStart + count;
+    }
+    struct PacketMetadata::CompactItem& item =
+        atStart ? items[--m_compactStart] : items[m_compactEnd++];
+    item.typeUid = uid >> 1;
+    item.chunkUid = m_chunkUid;
+    item.size = size;
+    m_chunkUid++;
+    return true;
+}
+
+bool
+PacketMetadata::RemoveCompact(uint32_t uid, uint32_t size, bool atStart)
+{
+    NS_LOG_FUNCTION(this << uid << size << atStart);
+    if (m_compactStart == m_compactEnd)
+    {
+        return false;
+    }
+    const struct PacketMetadata::CompactItem& item =
+        atStart ? m_compact->m_items[m_compactStart] : m_compact->m_items[m_compactEnd - 1];
+    if (item.typeUid != uid >> 1 || item.size != size)
+    {
+        return false;
+    }
+    if (atStart)
+    {
+        m_compactStart++;
+    }
+    else
+    {
+        m_compactEnd--;
+    }
+    if (m_compactStart == m_compactEnd)
+    {
+        m_compactStart = COMPACT_START;
+        m_compactEnd = COMPACT_START;
+    }
+    return true;
+}
+
+void
+PacketMetadata::Materialize() const
+{
+    if (m_data != nullptr)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+    auto self = const_cast<PacketMetadata*>(this);
+    self->m_data = PacketMetadata::Create(10);
+    memset(m_data->m_data, 0xff, 4);
+    for (uint8_t i = m_compactStart; i < m_compactEnd; i++)
+    {
+        struct PacketMetadata::SmallItem item;
+        item.next = 0xffff;
+        item.prev = m_tail;
+        item.typeUid = m_compact->m_items[i].typeUid << 1;
+        item.size = m_compact->m_items[i].size;
+        item.chunkUid = m_compact->m_items[i].chunkUid;
+        uint16_t written = self->AddSmall(&item);
+        self->UpdateTail(written);
+    }
+    self->ReleaseCompact();
+    NS_ASSERT(IsStateOk());
+}
+
 void
 PacketMetadata::ReserveCopy(uint32_t size)
 {
@@ -80,8 +206,7 @@ PacketMetadata::ReserveCopy(uint32_t size)
     struct PacketMetadata::Data* newData = PacketMetadata::Create(m_used + size);
     memcpy(newData->m_data, m_data->m_data, m_used);
     newData->m_dirtyEnd = m_used;
-    m_data->m_count--;
-    if (m_data->m_count == 0)
+    if (--m_data->m_count == 0)
     {
         PacketMetadata::Recycle(m_data);
     }
@@ -104,8 +229,7 @@ PacketMetadata::Reserve(uint32_t size)
 {
     NS_LOG_FUNCTION(this << size);
     NS_ASSERT(m_data != nullptr);
-    if (m_data->m_size >= m_used + size &&
-        (m_head == 0xffff || m_data->m_count == 1 || m_data->m_dirtyEnd == m_used))
+    if (m_data->m_size >= m_used + size && CanAppendInPlace())
     {
         /* enough room, not dirty. */
     }
@@ -116,6 +240,16 @@ PacketMetadata::Reserve(uint32_t size)
     }
 }
 
+bool
+PacketMetadata::CanAppendInPlace() const
+{
+#ifdef NS3_MTP
+    return m_data->m_count == 1;
+#else
+    return m_head == 0xffff || m_data->m_count == 1 || m_data->m_dirtyEnd == m_used;
+#endif
+}
+
 bool
 PacketMetadata::IsSharedPointerOk(uint16_t pointer) const
 {
@@ -136,6 +270,10 @@ bool
 PacketMetadata::IsStateOk() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_data == nullptr)
+    {
+        return m_compactStart <= m_compactEnd && m_compactEnd <= COMPACT_SIZE;
+    }
     bool ok = m_used <= m_data->m_size;
     ok &= IsPointerOk(m_head);
     ok &= IsPointerOk(m_tail);
@@ -384,8 +522,7 @@ PacketMetadata::AddSmall(const struct PacketMetadata::SmallItem* item)
     uint32_t typeUidSize = GetUleb128Size(item->typeUid);
     uint32_t sizeSize = GetUleb128Size(item->size);
     uint32_t n = 2 + 2 + typeUidSize + sizeSize + 2;
-    if (m_used + n > m_data->m_size ||
-        (m_head != 0xffff && m_data->m_count != 1 && m_used != m_data->m_dirtyEnd))
+    if (m_used + n > m_data->m_size || !CanAppendInPlace())
     {
         ReserveCopy(n);
     }
@@ -421,8 +558,7 @@ PacketMetadata::AddBig(uint32_t next,
     uint32_t fragEndSize = GetUleb128Size(extraItem->fragmentEnd);
     uint32_t n = 2 + 2 + typeUidSize + sizeSize + 2 + fragStartSize + fragEndSize + 4;
 
-    if (m_used + n > m_data->m_size ||
-        (m_head != 0xffff && m_data->m_count != 1 && m_used != m_data->m_dirtyEnd))
+    if (m_used + n > m_data->m_size || !CanAppendInPlace())
     {
         ReserveCopy(n);
     }
@@ -504,6 +640,7 @@ PacketMetadata::ReplaceTail(PacketMetadata::SmallItem* item,
 
     // create a copy of the packet without its tail.
     PacketMetadata h(m_packetUid, 0);
+    h.Materialize();
     uint16_t current = m_head;
     while (current != 0xffff && current != m_tail)
     {
@@ -572,6 +709,7 @@ PacketMetadata::Create(uint32_t size)
     {
         m_maxSize = size;
     }
+#ifndef NS3_MTP
     while (!m_freeList.empty())
     {
         struct PacketMetadata::Data* data = m_freeList.back();
@@ -585,6 +723,7 @@ PacketMetadata::Create(uint32_t size)
         NS_LOG_LOGIC("create dealloc size=" << data->m_size);
         PacketMetadata::Deallocate(data);
     }
+#endif
     NS_LOG_LOGIC("create alloc size=" << m_maxSize);
     return PacketMetadata::Allocate(m_maxSize);
 }
@@ -593,6 +732,11 @@ void
 PacketMetadata::Recycle(struct PacketMetadata::Data* data)
 {
     NS_LOG_FUNCTION(data);
+#ifdef NS3_MTP
+    // the free list is not shared between threads
+    PacketMetadata::Deallocate(data);
+    return;
+#endif
     if (!m_enable)
     {
         PacketMetadata::Deallocate(data);
@@ -665,6 +809,14 @@ PacketMetadata::DoAddHeader(uint32_t uid, uint32_t size)
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        if (AddCompact(uid, size, true))
+        {
+            return;
+        }
+        Materialize();
+    }
 
     struct PacketMetadata::SmallItem item;
     item.next = m_head;
@@ -688,6 +840,14 @@ PacketMetadata::RemoveHeader(const Header& header, uint32_t size)
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        if (RemoveCompact(uid, size, true))
+        {
+            return;
+        }
+        Materialize();
+    }
     struct PacketMetadata::SmallItem item;
     struct PacketMetadata::ExtraItem extraItem;
     uint32_t read = ReadItems(m_head, &item, &extraItem);
@@ -734,6 +894,14 @@ PacketMetadata::AddTrailer(const Trailer& trailer, uint32_t size)
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        if (AddCompact(uid, size, false))
+        {
+            return;
+        }
+        Materialize();
+    }
     struct PacketMetadata::SmallItem item;
     item.next = 0xffff;
     item.prev = m_tail;
@@ -757,6 +925,14 @@ PacketMetadata::RemoveTrailer(const Trailer& trailer, uint32_t size)
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        if (RemoveCompact(uid, size, false))
+        {
+            return;
+        }
+        Materialize();
+    }
     struct PacketMetadata::SmallItem item;
     struct PacketMetadata::ExtraItem extraItem;
     uint32_t read = ReadItems(m_tail, &item, &extraItem);
@@ -802,7 +978,7 @@ PacketMetadata::AddAtEnd(const PacketMetadata& o)
         m_metadataSkipped = true;
         return;
     }
-    if (m_tail == 0xffff)
+    if (m_data == nullptr ? m_compactStart == m_compactEnd : m_tail == 0xffff)
     {
         // We have no items so 'AddAtEnd' is
         // equivalent to self-assignment.
@@ -810,12 +986,14 @@ PacketMetadata::AddAtEnd(const PacketMetadata& o)
         NS_ASSERT(IsStateOk());
         return;
     }
-    if (o.m_head == 0xffff)
+    if (o.m_data == nullptr ? o.m_compactStart == o.m_compactEnd : o.m_head == 0xffff)
     {
-        NS_ASSERT(o.m_tail == 0xffff);
+        NS_ASSERT(o.m_data == nullptr || o.m_tail == 0xffff);
         // we have nothing to append.
         return;
     }
+    Materialize();
+    o.Materialize();
     NS_ASSERT(m_head != 0xffff && m_tail != 0xffff);
 
     // We read the current tail because we are going to append
@@ -890,7 +1068,21 @@ PacketMetadata::RemoveAtStart(uint32_t start)
         m_metadataSkipped = true;
         return;
     }
-    NS_ASSERT(m_data != nullptr);
+    if (m_data == nullptr)
+    {
+        // remove the whole items without leaving the compact representation
+        while (start > 0 && m_compactStart != m_compactEnd &&
+               m_compact->m_items[m_compactStart].size <= start)
+        {
+            start -= m_compact->m_items[m_compactStart].size;
+            m_compactStart++;
+        }
+        if (start == 0)
+        {
+            return;
+        }
+        Materialize();
+    }
     uint32_t leftToRemove = start;
     uint16_t current = m_head;
     while (current != 0xffff && leftToRemove > 0)
@@ -917,6 +1109,7 @@ PacketMetadata::RemoveAtStart(uint32_t start)
         {
             // fragment the list item.
             PacketMetadata fragment(m_packetUid, 0);
+            fragment.Materialize();
             extraItem.fragmentStart += leftToRemove;
             leftToRemove = 0;
             uint16_t written = fragment.AddBig(0xffff, fragment.m_tail, &item, &extraItem);
@@ -952,7 +1145,21 @@ PacketMetadata::RemoveAtEnd(uint32_t end)
         m_metadataSkipped = true;
         return;
     }
-    NS_ASSERT(m_data != nullptr);
+    if (m_data == nullptr)
+    {
+        // remove the whole items without leaving the compact representation
+        while (end > 0 && m_compactStart != m_compactEnd &&
+               m_compact->m_items[m_compactEnd - 1].size <= end)
+        {
+            end -= m_compact->m_items[m_compactEnd - 1].size;
+            m_compactEnd--;
+        }
+        if (end == 0)
+        {
+            return;
+        }
+        Materialize();
+    }
 
     uint32_t leftToRemove = end;
     uint16_t current = m_tail;
@@ -980,6 +1187,7 @@ PacketMetadata::RemoveAtEnd(uint32_t end)
         {
             // fragment the list item.
             PacketMetadata fragment(m_packetUid, 0);
+            fragment.Materialize();
             NS_ASSERT(extraItem.fragmentEnd > leftToRemove);
             extraItem.fragmentEnd -= leftToRemove;
             leftToRemove = 0;
@@ -1040,6 +1248,7 @@ PacketMetadata::ItemIterator
 PacketMetadata::BeginItem(Buffer buffer) const
 {
     NS_LOG_FUNCTION(this << &buffer);
+    Materialize();
     return ItemIterator(this, buffer);
 }
 
@@ -1142,6 +1351,7 @@ PacketMetadata::GetSerializedSize() const
     {
         return totalSize;
     }
+    Materialize();
 
     struct PacketMetadata::SmallItem item;
     struct PacketMetadata::ExtraItem extraItem;
@@ -1175,6 +1385,7 @@ uint32_t
 PacketMetadata::Serialize(uint8_t* buffer, uint32_t maxSize) const
 {
     NS_LOG_FUNCTION(this << &buffer << maxSize);
+    Materialize();
     uint8_t* start = buffer;
 
     buffer = AddToRawU64(m_packetUid, start, buffer, maxSize);
@@ -1281,6 +1492,7 @@ uint32_t
 PacketMetadata::Deserialize(const uint8_t* buffer, uint32_t size)
 {
     NS_LOG_FUNCTION(this << &buffer << size);
+    Materialize();
     const uint8_t* start = buffer;
     uint32_t desSize = size - 4;
 
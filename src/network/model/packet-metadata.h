@@ -25,10 +25,15 @@
 #include "ns3/callback.h"
 #include "ns3/type-id.h"
 
+#include <algorithm>
 #include <limits>
 #include <stdint.h>
 #include <vector>
 
+#ifdef NS3_MTP
+#include <atomic>
+#endif
+
 namespace ns3
 {
 
@@ -76,6 +81,16 @@ class Trailer;
  * integers, and some others as variable-size 32-bit integers.
  * The variable-size 32 bit integers are stored using the uleb128
  * encoding.
+ *
+ * In compact mode (see EnableCompact()), the items are first recorded
+ * in a small reference-counted array, struct PacketMetadata::CompactData,
+ * allocated with the first item and shared by the copies of the packet
+ * until one of them adds an item, instead of in a struct
+ * PacketMetadata::Data. This array can
+ * only describe whole headers, trailers and payload added to this
+ * packet: the items are moved to the linked list on demand, by the
+ * operations which need it (fragmentation, concatenation,
+ * serialization and iteration), or when the array is full.
  */
 class PacketMetadata
 {
@@ -169,6 +184,26 @@ class PacketMetadata
      * \brief Enable the packet metadata checking
      */
     static void EnableChecking();
+    /**
+     * \brief Enable the packet metadata, in compact mode
+     *
+     * With multithreaded parallel simulation support (\c NS3_MTP),
+     * this is equivalent to Enable(), since the threads which share a
+     * packet could move its items to the linked list concurrently.
+     */
+    static void EnableCompact();
+    /**
+     * \brief Disable the compact mode
+     *
+     * The metadata stays enabled, and the packets created from now on
+     * record their items in the linked list.
+     */
+    static void DisableCompact();
+    /**
+     * \brief Check if the compact mode is enabled
+     * \returns true if EnableCompact() was called, and not DisableCompact()
+     */
+    static bool IsCompactEnabled();
 
     /**
      * \brief Constructor
@@ -426,7 +461,11 @@ class PacketMetadata
     struct Data
     {
         /** number of references to this struct Data instance. */
+#ifdef NS3_MTP
+        std::atomic<uint32_t> m_count;
+#else
         uint32_t m_count;
+#endif
         /** size (in bytes) of m_data buffer below */
         uint16_t m_size;
         /** max of the m_used field over all objects which reference this struct Data instance */
@@ -509,6 +548,36 @@ class PacketMetadata
         uint64_t packetUid;
     };
 
+    /**
+     * \brief Item of the compact representation: a whole header,
+     * trailer or payload.
+     */
+    struct CompactItem
+    {
+        uint16_t typeUid;  //!< uid of the TypeId of the item, zero for payload
+        uint16_t chunkUid; //!< same as SmallItem::chunkUid
+        uint32_t size;     //!< size (in bytes) of the item
+    };
+
+    /** Number of items in the compact representation. */
+    static const uint8_t COMPACT_SIZE = 8;
+    /**
+     * Position of the first item added to an empty compact
+     * representation, which leaves more room for headers than for
+     * trailers.
+     */
+    static const uint8_t COMPACT_START = 6;
+
+    /**
+     * \brief Storage of the compact representation, shared by the
+     * copies of a packet.
+     */
+    struct CompactData
+    {
+        uint32_t m_count;                  //!< reference count
+        CompactItem m_items[COMPACT_SIZE]; //!< the items
+    };
+
     /**
      * \brief Class to hold all the metadata
      */
@@ -611,6 +680,18 @@ class PacketMetadata
      * \param n space to reserve
      */
     void ReserveCopy(uint32_t n);
+    /**
+     * \brief Check whether new items can be written in place in the
+     * metadata storage, that is, after the items of all the other
+     * PacketMetadata instances which share it.
+     *
+     * With multithreaded parallel simulation support (\c NS3_MTP),
+     * the other instances may live in different threads, so the
+     * storage must not be shared at all.
+     *
+     * \returns true if the storage can be written in place.
+     */
+    bool CanAppendInPlace() const;
 
     /**
      * \brief Get the total size used by the metadata
@@ -634,6 +715,34 @@ class PacketMetadata
      * \param size header serialized size
      */
     void DoAddHeader(uint32_t uid, uint32_t size);
+    /**
+     * \brief Add an item to the compact representation
+     * \param uid header's or trailer's uid to add
+     * \param size header or trailer serialized size
+     * \param atStart true to add a header, false to add a trailer
+     * \returns false if the compact representation is full
+     */
+    bool AddCompact(uint32_t uid, uint32_t size, bool atStart);
+    /**
+     * \brief Remove an item from the compact representation
+     * \param uid header's or trailer's uid to remove
+     * \param size header or trailer serialized size
+     * \param atStart true to remove a header, false to remove a trailer
+     * \returns false if the first (or last) item does not match
+     */
+    bool RemoveCompact(uint32_t uid, uint32_t size, bool atStart);
+    /**
+     * \brief Move the items of the compact representation, if any, to
+     * the linked list.
+     *
+     * The items themselves do not change, so this can be done from
+     * const methods, in the same way as Buffer::TransformIntoRealBuffer.
+     */
+    void Materialize() const;
+    /**
+     * \brief Release the storage of the compact representation, if any
+     */
+    inline void ReleaseCompact();
     /**
      * \brief Check if the metadata state is ok
      * \returns true if the internal state is ok
@@ -678,27 +787,47 @@ class PacketMetadata
     static DataFreeList m_freeList; //!< the metadata data storage
     static bool m_enable;           //!< Enable the packet metadata
     static bool m_enableChecking;   //!< Enable the packet metadata checking
+    static bool m_enableCompact;    //!< Enable the compact representation
 
     /**
      * Set to true when adding metadata to a packet is skipped because
      * m_enable is false; used to detect enabling of metadata in the
      * middle of a simulation, which isn't allowed.
      */
+#ifdef NS3_MTP
+    static std::atomic<bool> m_metadataSkipped;
+#else
     static bool m_metadataSkipped;
+#endif
 
-    static uint32_t m_maxSize;  //!< maximum metadata size
+#ifdef NS3_MTP
+    static thread_local uint32_t m_maxSize; //!< maximum metadata size
+#else
+    static uint32_t m_maxSize; //!< maximum metadata size
+#endif
     static uint16_t m_chunkUid; //!< Chunk Uid
 
-    struct Data* m_data; //!< Metadata storage
+    struct Data* m_data; //!< Metadata storage, nullptr for the compact representation
     /*
        head -(next)-> tail
          ^             |
           \---(prev)---|
      */
-    uint16_t m_head;      //!< list head
-    uint16_t m_tail;      //!< list tail
-    uint16_t m_used;      //!< used portion
+    uint16_t m_head; //!< list head
+    uint16_t m_tail; //!< list tail
+    uint16_t m_used; //!< used portion
+    /**
+     * first item of the compact representation, which is in use
+     * only if m_data is nullptr
+     */
+    uint8_t m_compactStart;
+    uint8_t m_compactEnd; //!< end of the compact representation
     uint64_t m_packetUid; //!< packet Uid
+    /**
+     * compact representation, allocated with its first item, and
+     * nullptr if m_data is not nullptr
+     */
+    struct CompactData* m_compact;
 };
 
 } // namespace ns3
@@ -707,13 +836,19 @@ namespace ns3
 {
 
 PacketMetadata::PacketMetadata(uint64_t uid, uint32_t size)
-    : m_data(PacketMetadata::Create(10)),
+    : m_data(m_enableCompact ? nullptr : PacketMetadata::Create(10)),
       m_head(0xffff),
       m_tail(0xffff),
       m_used(0),
-      m_packetUid(uid)
+      m_compactStart(COMPACT_START),
+      m_compactEnd(COMPACT_START),
+      m_packetUid(uid),
+      m_compact(nullptr)
 {
-    memset(m_data->m_data, 0xff, 4);
+    if (m_data != nullptr)
+    {
+        memset(m_data->m_data, 0xff, 4);
+    }
     if (size > 0)
     {
         DoAddHeader(0, size);
@@ -725,9 +860,19 @@ PacketMetadata::PacketMetadata(const PacketMetadata& o)
       m_head(o.m_head),
       m_tail(o.m_tail),
       m_used(o.m_used),
-      m_packetUid(o.m_packetUid)
+      m_compactStart(o.m_compactStart),
+      m_compactEnd(o.m_compactEnd),
+      m_packetUid(o.m_packetUid),
+      m_compact(o.m_compact)
 {
-    NS_ASSERT(m_data != nullptr);
+    if (m_data == nullptr)
+    {
+        if (m_compact != nullptr)
+        {
+            m_compact->m_count++;
+        }
+        return;
+    }
     NS_ASSERT(m_data->m_count < std::numeric_limits<uint32_t>::max());
     m_data->m_count++;
 }
@@ -738,33 +883,53 @@ PacketMetadata::operator=(const PacketMetadata& o)
     if (m_data != o.m_data)
     {
         // not self assignment
-        NS_ASSERT(m_data != nullptr);
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        if (m_data != nullptr && --m_data->m_count == 0)
         {
             PacketMetadata::Recycle(m_data);
         }
         m_data = o.m_data;
-        NS_ASSERT(m_data != nullptr);
-        m_data->m_count++;
+        if (m_data != nullptr)
+        {
+            m_data->m_count++;
+        }
     }
     m_head = o.m_head;
     m_tail = o.m_tail;
     m_used = o.m_used;
+    m_compactStart = o.m_compactStart;
+    m_compactEnd = o.m_compactEnd;
+    if (m_compact != o.m_compact)
+    {
+        ReleaseCompact();
+        m_compact = o.m_compact;
+        if (m_compact != nullptr)
+        {
+            m_compact->m_count++;
+        }
+    }
     m_packetUid = o.m_packetUid;
     return *this;
 }
 
 PacketMetadata::~PacketMetadata()
 {
-    NS_ASSERT(m_data != nullptr);
-    m_data->m_count--;
-    if (m_data->m_count == 0)
+    ReleaseCompact();
+    if (m_data != nullptr && --m_data->m_count == 0)
     {
         PacketMetadata::Recycle(m_data);
     }
 }
 
+void
+PacketMetadata::ReleaseCompact()
+{
+    if (m_compact != nullptr && --m_compact->m_count == 0)
+    {
+        delete m_compact;
+    }
+    m_compact = nullptr;
+}
+
 } // namespace ns3
 
 #endif /* PACKET_METADATA_H */
@@ -150,7 +150,6 @@ PacketTagList::COWTraverse(Tag& tag, PacketTagList::COWWriter Writer)
     {
         NS_ASSERT(cur != nullptr);
         NS_ASSERT(cur->count > 1);
-        cur->count--; // unmerge cur
         struct TagData* copy = CreateTagData(cur->size);
         copy->tid = cur->tid;
         copy->count = 1;
@@ -160,6 +159,7 @@ PacketTagList::COWTraverse(Tag& tag, PacketTagList::COWWriter Writer)
         copy->next->count++;    // mark new merge
         *prevNext = copy;       // point prior list at copy
         prevNext = &copy->next; // advance
+        Release(cur);           // unmerge cur
         cur = copy->next;
     }
     // Sanity check:
@@ -175,6 +175,16 @@ PacketTagList::COWTraverse(Tag& tag, PacketTagList::COWWriter Writer)
 bool
 PacketTagList::Remove(Tag& tag)
 {
+    TypeId tid = tag.GetInstanceTypeId();
+    uint8_t index = GetSlot(tid);
+    InlineTag& slot = m_inline[index];
+    if (IsUsed(index) && slot.tid == tid)
+    {
+        NS_LOG_INFO("found tid in inline slot");
+        tag.Deserialize(TagBuffer(slot.data, slot.data + slot.size));
+        m_inlineUsed &= ~(1 << index);
+        return true;
+    }
     return COWTraverse(tag, &PacketTagList::RemoveWriter);
 }
 
@@ -201,13 +211,13 @@ PacketTagList::RemoveWriter(Tag& tag,
     else
     {
         // cur is always a merge at this point
-        // unmerge cur, since we linked around it already
-        cur->count--;
         if (cur->next != nullptr)
         {
             // there's a next, so make it a merge
             cur->next->count++;
         }
+        // unmerge cur, since we linked around it already
+        Release(cur);
     }
     return found;
 }
@@ -215,6 +225,24 @@ PacketTagList::RemoveWriter(Tag& tag,
 bool
 PacketTagList::Replace(Tag& tag)
 {
+    TypeId tid = tag.GetInstanceTypeId();
+    uint8_t index = GetSlot(tid);
+    InlineTag& slot = m_inline[index];
+    if (IsUsed(index) && slot.tid == tid)
+    {
+        uint32_t size = tag.GetSerializedSize();
+        if (size <= INLINE_TAG_SIZE)
+        {
+            NS_LOG_INFO("found tid in inline slot, rewriting");
+            slot.size = size;
+            tag.Serialize(TagBuffer(slot.data, slot.data + size));
+            return true;
+        }
+        // the new value does not fit in the slot anymore
+        m_inlineUsed &= ~(1 << index);
+        Add(tag);
+        return true;
+    }
     bool found = COWTraverse(tag, &PacketTagList::ReplaceWriter);
     if (!found)
     {
@@ -243,7 +271,6 @@ PacketTagList::ReplaceWriter(Tag& tag,
     {
         // cur is always a merge at this point
         // need to copy, replace, and link past cur
-        cur->count--; // unmerge cur
         struct TagData* copy = CreateTagData(tag.GetSerializedSize());
         copy->tid = tag.GetInstanceTypeId();
         copy->count = 1;
@@ -254,6 +281,7 @@ PacketTagList::ReplaceWriter(Tag& tag,
             copy->next->count++; // mark new merge
         }
         *prevNext = copy; // point prior list at copy
+        Release(cur);     // unmerge cur
     }
     return found;
 }
@@ -261,17 +289,30 @@ PacketTagList::ReplaceWriter(Tag& tag,
 void
 PacketTagList::Add(const Tag& tag) const
 {
-    NS_LOG_FUNCTION(this << tag.GetInstanceTypeId());
+    TypeId tid = tag.GetInstanceTypeId();
+    NS_LOG_FUNCTION(this << tid);
     // ensure this id was not yet added
+    uint8_t index = GetSlot(tid);
+    InlineTag& slot = const_cast<PacketTagList*>(this)->m_inline[index];
+    NS_ASSERT_MSG(!IsUsed(index) || slot.tid != tid,
+                  "Error: cannot add the same kind of tag twice.");
     for (struct TagData* cur = m_next; cur != nullptr; cur = cur->next)
     {
-        NS_ASSERT_MSG(cur->tid != tag.GetInstanceTypeId(),
-                      "Error: cannot add the same kind of tag twice.");
+        NS_ASSERT_MSG(cur->tid != tid, "Error: cannot add the same kind of tag twice.");
+    }
+    uint32_t size = tag.GetSerializedSize();
+    if (size <= INLINE_TAG_SIZE && !IsUsed(index))
+    {
+        const_cast<PacketTagList*>(this)->m_inlineUsed |= 1 << index;
+        slot.tid = tid;
+        slot.size = size;
+        tag.Serialize(TagBuffer(slot.data, slot.data + size));
+        return;
     }
-    struct TagData* head = CreateTagData(tag.GetSerializedSize());
+    struct TagData* head = CreateTagData(size);
     head->count = 1;
     head->next = nullptr;
-    head->tid = tag.GetInstanceTypeId();
+    head->tid = tid;
     head->next = m_next;
     tag.Serialize(TagBuffer(head->data, head->data + head->size));
 
@@ -283,6 +324,14 @@ PacketTagList::Peek(Tag& tag) const
 {
     NS_LOG_FUNCTION(this << tag.GetInstanceTypeId());
     TypeId tid = tag.GetInstanceTypeId();
+    uint8_t index = GetSlot(tid);
+    const InlineTag& slot = m_inline[index];
+    if (IsUsed(index) && slot.tid == tid)
+    {
+        tag.Deserialize(TagBuffer(const_cast<uint8_t*>(slot.data),
+                                  const_cast<uint8_t*>(slot.data) + slot.size));
+        return true;
+    }
     for (struct TagData* cur = m_next; cur != nullptr; cur = cur->next)
     {
         if (cur->tid == tid)
@@ -311,12 +360,21 @@ PacketTagList::GetSerializedSize() const
 
     size = 4; // numberOfTags
 
+    // TypeId hash; ensure size is multiple of 4 bytes
+    uint32_t hashSize = (sizeof(TypeId::hash_t) + 3) & (~3);
+
+    for (uint8_t index = 0; index < INLINE_SLOTS; index++)
+    {
+        if (IsUsed(index))
+        {
+            size += 4 + hashSize + ((m_inline[index].size + 3) & (~3));
+        }
+    }
+
     for (struct TagData* cur = m_next; cur != nullptr; cur = cur->next)
     {
         size += 4; // TagData -> size
 
-        // TypeId hash; ensure size is multiple of 4 bytes
-        uint32_t hashSize = (sizeof(TypeId::hash_t) + 3) & (~3);
         size += hashSize;
 
         // TagData -> data; ensure size is multiple of 4 bytes
@@ -348,48 +406,67 @@ PacketTagList::Serialize(uint32_t* buffer, uint32_t maxSize) const
         return 0;
     }
 
-    for (struct TagData* cur = m_next; cur != nullptr; cur = cur->next)
-    {
+    auto serializeTag = [&p, &size, maxSize, numberOfTags](TypeId tagTid,
+                                                           const uint8_t* data,
+                                                           uint32_t dataSize) {
         if (size + 4 <= maxSize)
         {
-            *p++ = cur->size;
+            *p++ = dataSize;
             size += 4;
         }
         else
         {
-            return 0;
+            return false;
         }
 
-        NS_LOG_INFO("Serializing tag id " << cur->tid);
+        NS_LOG_INFO("Serializing tag id " << tagTid);
 
         // ensure size is multiple of 4 bytes for 4 byte boundaries
         uint32_t hashSize = (sizeof(TypeId::hash_t) + 3) & (~3);
         if (size + hashSize <= maxSize)
         {
-            TypeId::hash_t tid = cur->tid.GetHash();
+            TypeId::hash_t tid = tagTid.GetHash();
             memcpy(p, &tid, sizeof(TypeId::hash_t));
             p += hashSize / 4;
             size += hashSize;
         }
         else
         {
-            return 0;
+            return false;
         }
 
         // ensure size is multiple of 4 bytes for 4 byte boundaries
-        uint32_t tagWordSize = (cur->size + 3) & (~3);
+        uint32_t tagWordSize = (dataSize + 3) & (~3);
         if (size + tagWordSize <= maxSize)
         {
-            memcpy(p, cur->data, cur->size);
+            memcpy(p, data, dataSize);
             size += tagWordSize;
             p += tagWordSize / 4;
         }
         else
         {
-            return 0;
+            return false;
         }
 
         (*numberOfTags)++;
+        return true;
+    };
+
+    for (uint8_t index = 0; index < INLINE_SLOTS; index++)
+    {
+        const InlineTag& slot = m_inline[index];
+        if (IsUsed(index) && !serializeTag(slot.tid, slot.data, slot.size))
+        {
+            return 0;
+        }
+    }
+
+    for (struct TagData* cur = m_next; cur != nullptr; cur = cur->next)
+    {
+        if (!serializeTag(cur->tid, cur->data, cur->size))
+        {
+            return 0;
+        }
     }
 
     // Serialized successfully
@@ -427,6 +504,23 @@ PacketTagList::Deserialize(const uint32_t* buffer, uint32_t size)
 
         NS_LOG_INFO("Deserializing tag of type " << tid);
 
+        // ensure 4 byte boundary
+        uint32_t tagWordSize = (tagSize + 3) & (~3);
+
+        uint8_t index = GetSlot(tid);
+        if (tagSize <= INLINE_TAG_SIZE && !IsUsed(index))
+        {
+            NS_ASSERT(sizeCheck >= tagSize);
+            InlineTag& slot = m_inline[index];
+            m_inlineUsed |= 1 << index;
+            slot.tid = tid;
+            slot.size = tagSize;
+            memcpy(slot.data, p, tagSize);
+            p += tagWordSize / 4;
+            sizeCheck -= tagWordSize;
+            continue;
+        }
+
         struct TagData* newTag = CreateTagData(tagSize);
         newTag->count = 1;
         newTag->next = nullptr;
@@ -435,13 +529,11 @@ PacketTagList::Deserialize(const uint32_t* buffer, uint32_t size)
         NS_ASSERT(sizeCheck >= tagSize);
         memcpy(newTag->data, p, tagSize);
 
-        // ensure 4 byte boundary
-        uint32_t tagWordSize = (tagSize + 3) & (~3);
         p += tagWordSize / 4;
         sizeCheck -= tagWordSize;
 
         // Set link list pointers.
-        if (i == 0)
+        if (prevTag == nullptr)
         {
             m_next = newTag;
         }
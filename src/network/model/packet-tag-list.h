@@ -26,13 +26,19 @@
 
 #include "ns3/type-id.h"
 
+#include <array>
 #include <ostream>
 #include <stdint.h>
 
+#ifdef NS3_MTP
+#include <atomic>
+#endif
+
 namespace ns3
 {
 
 class Tag;
+class PacketTagIterator;
 
 /**
  * \ingroup packet
@@ -120,6 +126,24 @@ class Tag;
  *       The portion of the list between the first branch and the target is
  *       shared. This portion is copied before the #Remove or #Replace is
  *       performed.
+ *
+ * \par <b> Inline slots </b>
+ *
+ *   - Most tags are only a few bytes long, and a packet rarely carries
+ *     more than a few of them, so tags of at most #INLINE_TAG_SIZE bytes
+ *     are stored in one of #INLINE_SLOTS slots held by value in the
+ *     PacketTagList, rather than in a TagData.
+ *
+ *   - The slot of a tag is selected by the uid of its TypeId, so that a
+ *     tag stored inline is found, added or removed without walking the
+ *     list nor allocating memory.
+ *
+ *   - A tag which is too large, or whose slot is already used by a tag
+ *     of another type, is stored in the tree of TagData as above.
+ *
+ *   - The slots are copied with the PacketTagList: they are never shared.
+ *     A bit mask records the slots in use, so that the slots of a list
+ *     without inline tags are neither initialized nor copied.
  */
 class PacketTagList
 {
@@ -142,10 +166,31 @@ class PacketTagList
     struct TagData
     {
         struct TagData* next; //!< Pointer to next in list
-        uint32_t count;       //!< Number of incoming links
-        TypeId tid;           //!< Type of the tag serialized into #data
-        uint32_t size;        //!< Size of the \c data buffer
-        uint8_t data[1];      //!< Serialization buffer
+#ifdef NS3_MTP
+        std::atomic<uint32_t> count; //!< Number of incoming links
+#else
+        uint32_t count; //!< Number of incoming links
+#endif
+        TypeId tid;       //!< Type of the tag serialized into #data
+        uint32_t size;    //!< Size of the \c data buffer
+        uint8_t data[1];  //!< Serialization buffer
+    };
+
+    /** Number of inline slots. */
+    static const uint8_t INLINE_SLOTS = 4;
+    /** Largest serialized size of a tag stored in an inline slot. */
+    static const uint8_t INLINE_TAG_SIZE = 16;
+
+    /**
+     * Inline storage for one small tag.
+     *
+     * See PacketTagList for a discussion of the data structure.
+     */
+    struct InlineTag
+    {
+        TypeId tid;                    //!< Type of the tag, if the slot is used
+        uint8_t size;                  //!< Size of the serialized tag
+        uint8_t data[INLINE_TAG_SIZE]; //!< Serialization buffer
     };
 
     /**
@@ -157,8 +202,8 @@ class PacketTagList
      *
      * \param [in] o The PacketTagList to copy.
      *
-     * This makes a light-weight copy by #RemoveAll, then
-     * pointing to the same \ref TagData as \pname{o}.
+     * This makes a light-weight copy by copying the inline slots in use,
+     * then pointing to the same \ref TagData as \pname{o}.
      */
     inline PacketTagList(const PacketTagList& o);
     /**
@@ -167,14 +212,15 @@ class PacketTagList
      * \param [in] o The PacketTagList to copy.
      * \returns the copied object
      *
-     * This makes a light-weight copy by #RemoveAll, then
+     * This makes a light-weight copy by copying the inline slots in use and
+     * releasing the \ref TagData of this list, up to the first merge, then
      * pointing to the same \ref TagData as \pname{o}.
      */
     inline PacketTagList& operator=(const PacketTagList& o);
     /**
      * Destructor
      *
-     * #RemoveAll's the tags up to the first merge.
+     * Releases the \ref TagData up to the first merge.
      */
     inline ~PacketTagList();
 
@@ -215,7 +261,8 @@ class PacketTagList
      */
     inline void RemoveAll();
     /**
-     * \returns pointer to head of tag list
+     * \returns pointer to head of tag list, which holds the tags
+     *          not stored in the inline slots
      */
     const struct PacketTagList::TagData* Head() const;
     /**
@@ -244,6 +291,16 @@ class PacketTagList
     uint32_t Deserialize(const uint32_t* buffer, uint32_t size);
 
   private:
+    /// Friend class
+    friend class PacketTagIterator;
+
+    /**
+     * Get the inline slot of a tag type.
+     *
+     * \param [in] tid The type of the tag.
+     * \returns The index of the slot.
+     */
+    static inline uint8_t GetSlot(TypeId tid);
     /**
      * Allocate and construct a TagData struct, sizing the data area
      * large enough to serialize dataSize bytes from a Tag.
@@ -252,6 +309,17 @@ class PacketTagList
      * \returns The newly constructed TagData object.
      */
     static TagData* CreateTagData(size_t dataSize);
+    /**
+     * Drop one incoming link of a TagData, and free the nodes which
+     * are no longer linked, up to the first merge.
+     *
+     * When the node is shared with lists in other threads, the other
+     * lists may drop their links concurrently, so the caller must not
+     * access \pname{cur} afterwards.
+     *
+     * \param [in] cur The TagData.
+     */
+    static inline void Release(struct TagData* cur);
 
     /**
      * Typedef of method function pointer for copy-on-write operations
@@ -301,6 +369,23 @@ class PacketTagList
      */
     bool ReplaceWriter(Tag& tag, bool preMerge, struct TagData* cur, struct TagData** prevNext);
 
+    /**
+     * Check whether an inline slot holds a tag.
+     *
+     * \param [in] index The index of the slot.
+     * \returns True if the slot holds a tag.
+     */
+    inline bool IsUsed(uint8_t index) const;
+
+    /**
+     * Inline slots, indexed by the uid of the tag type modulo #INLINE_SLOTS.
+     * Only the slots in #m_inlineUsed are initialized.
+     */
+    std::array<InlineTag, INLINE_SLOTS> m_inline;
+    /**
+     * Bit mask of the inline slots which hold a tag.
+     */
+    uint8_t m_inlineUsed;
     /**
      * Pointer to first \ref TagData on the list
      */
@@ -317,13 +402,19 @@ namespace ns3
 {
 
 PacketTagList::PacketTagList()
-    : m_next()
+    : m_inlineUsed(0),
+      m_next()
 {
 }
 
 PacketTagList::PacketTagList(const PacketTagList& o)
-    : m_next(o.m_next)
+    : m_inlineUsed(o.m_inlineUsed),
+      m_next(o.m_next)
 {
+    if (m_inlineUsed != 0)
+    {
+        m_inline = o.m_inline;
+    }
     if (m_next != nullptr)
     {
         m_next->count++;
@@ -334,11 +425,20 @@ PacketTagList&
 PacketTagList::operator=(const PacketTagList& o)
 {
     // self assignment
+    if (this == &o)
+    {
+        return *this;
+    }
+    m_inlineUsed = o.m_inlineUsed;
+    if (m_inlineUsed != 0)
+    {
+        m_inline = o.m_inline;
+    }
     if (m_next == o.m_next)
     {
         return *this;
     }
-    RemoveAll();
+    Release(m_next);
     m_next = o.m_next;
     if (m_next != nullptr)
     {
@@ -349,17 +449,36 @@ PacketTagList::operator=(const PacketTagList& o)
 
 PacketTagList::~PacketTagList()
 {
-    RemoveAll();
+    Release(m_next);
 }
 
 void
 PacketTagList::RemoveAll()
+{
+    m_inlineUsed = 0;
+    Release(m_next);
+    m_next = nullptr;
+}
+
+uint8_t
+PacketTagList::GetSlot(TypeId tid)
+{
+    return tid.GetUid() % INLINE_SLOTS;
+}
+
+bool
+PacketTagList::IsUsed(uint8_t index) const
+{
+    return (m_inlineUsed & (1 << index)) != 0;
+}
+
+void
+PacketTagList::Release(struct TagData* cur)
 {
     struct TagData* prev = nullptr;
-    for (struct TagData* cur = m_next; cur != nullptr; cur = cur->next)
+    for (; cur != nullptr; cur = cur->next)
     {
-        cur->count--;
-        if (cur->count > 0)
+        if (--cur->count > 0)
         {
             break;
         }
@@ -375,7 +494,6 @@ PacketTagList::RemoveAll()
         prev->~TagData();
         std::free(prev);
     }
-    m_next = nullptr;
 }
 
 } // namespace ns3
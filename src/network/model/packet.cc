@@ -18,6 +18,8 @@
  */
 #include "packet.h"
 
+#include "packet-accounting.h"
+
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -30,7 +32,46 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("Packet");
 
+#ifdef NS3_MTP
+std::atomic<uint32_t> Packet::m_globalUid = 0;
+
+namespace
+{
+
+/// The upper 32 bits of the uids of the packets created by the calling thread
+thread_local uint32_t t_uidPrefix = 0;
+/// The counter of the uids of the packets created by the calling thread, or nullptr
+thread_local uint32_t* t_uidCounter = nullptr;
+
+} // namespace
+
+void
+Packet::SetThreadUidCounter(uint32_t prefix, uint32_t* counter)
+{
+    t_uidPrefix = prefix;
+    t_uidCounter = counter;
+}
+#else
 uint32_t Packet::m_globalUid = 0;
+#endif
+
+uint64_t
+Packet::AllocateUid()
+{
+#ifdef NS3_MTP
+    if (t_uidCounter)
+    {
+        return static_cast<uint64_t>(t_uidPrefix) << 32 | (*t_uidCounter)++;
+    }
+#endif
+    /* The upper 32 bits of the packet id in
+     * metadata is for the system id. For non-
+     * distributed simulations, this is simply
+     * zero.  The lower 32 bits are for the
+     * global UID
+     */
+    return static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid++;
+}
 
 TypeId
 ByteTagIterator::Item::GetTypeId() const
@@ -89,42 +130,62 @@ ByteTagIterator::ByteTagIterator(ByteTagList::Iterator i)
 {
 }
 
-PacketTagIterator::PacketTagIterator(const struct PacketTagList::TagData* head)
-    : m_current(head)
+PacketTagIterator::PacketTagIterator(const PacketTagList* list)
+    : m_list(list),
+      m_current(list->Head())
 {
+    SkipFreeSlots(0);
+}
+
+void
+PacketTagIterator::SkipFreeSlots(uint8_t slot)
+{
+    while (slot < PacketTagList::INLINE_SLOTS && !m_list->IsUsed(slot))
+    {
+        slot++;
+    }
+    m_slot = slot;
 }
 
 bool
 PacketTagIterator::HasNext() const
 {
-    return m_current != nullptr;
+    return m_slot < PacketTagList::INLINE_SLOTS || m_current != nullptr;
 }
 
 PacketTagIterator::Item
 PacketTagIterator::Next()
 {
     NS_ASSERT(HasNext());
+    if (m_slot < PacketTagList::INLINE_SLOTS)
+    {
+        const PacketTagList::InlineTag& slot = m_list->m_inline[m_slot];
+        SkipFreeSlots(m_slot + 1);
+        return PacketTagIterator::Item(slot.tid, slot.data, slot.size);
+    }
     const struct PacketTagList::TagData* prev = m_current;
     m_current = m_current->next;
-    return PacketTagIterator::Item(prev);
+    return PacketTagIterator::Item(prev->tid, prev->data, prev->size);
 }
 
-PacketTagIterator::Item::Item(const struct PacketTagList::TagData* data)
-    : m_data(data)
+PacketTagIterator::Item::Item(TypeId tid, const uint8_t* data, uint32_t size)
+    : m_tid(tid),
+      m_data(data),
+      m_size(size)
 {
 }
 
 TypeId
 PacketTagIterator::Item::GetTypeId() const
 {
-    return m_data->tid;
+    return m_tid;
 }
 
 void
 PacketTagIterator::Item::GetTag(Tag& tag) const
 {
-    NS_ASSERT(tag.GetInstanceTypeId() == m_data->tid);
-    tag.Deserialize(TagBuffer((uint8_t*)m_data->data, (uint8_t*)m_data->data + m_data->size));
+    NS_ASSERT(tag.GetInstanceTypeId() == m_tid);
+    tag.Deserialize(TagBuffer((uint8_t*)m_data, (uint8_t*)m_data + m_size));
 }
 
 Ptr<Packet>
@@ -140,16 +201,10 @@ Packet::Packet()
     : m_buffer(),
       m_byteTagList(),
       m_packetTagList(),
-      /* The upper 32 bits of the packet id in
-       * metadata is for the system id. For non-
-       * distributed simulations, this is simply
-       * zero.  The lower 32 bits are for the
-       * global UID
-       */
-      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid, 0),
+      m_metadata(AllocateUid(), 0),
       m_nixVector(nullptr)
 {
-    m_globalUid++;
+    PacketAccounting::NotifyCreated(this);
 }
 
 Packet::Packet(const Packet& o)
@@ -158,9 +213,15 @@ Packet::Packet(const Packet& o)
       m_packetTagList(o.m_packetTagList),
       m_metadata(o.m_metadata)
 {
+    PacketAccounting::NotifyCreated(this);
     o.m_nixVector ? m_nixVector = o.m_nixVector->Copy() : m_nixVector = nullptr;
 }
 
+Packet::~Packet()
+{
+    PacketAccounting::NotifyDestroyed(this);
+}
+
 Packet&
 Packet::operator=(const Packet& o)
 {
@@ -180,16 +241,10 @@ Packet::Packet(uint32_t size)
     : m_buffer(size),
       m_byteTagList(),
       m_packetTagList(),
-      /* The upper 32 bits of the packet id in
-       * metadata is for the system id. For non-
-       * distributed simulations, this is simply
-       * zero.  The lower 32 bits are for the
-       * global UID
-       */
-      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid, size),
+      m_metadata(AllocateUid(), size),
       m_nixVector(nullptr)
 {
-    m_globalUid++;
+    PacketAccounting::NotifyCreated(this);
 }
 
 Packet::Packet(const uint8_t* buffer, uint32_t size, bool magic)
@@ -199,6 +254,7 @@ Packet::Packet(const uint8_t* buffer, uint32_t size, bool magic)
       m_metadata(0, 0),
       m_nixVector(nullptr)
 {
+    PacketAccounting::NotifyCreated(this);
     NS_ASSERT(magic);
     Deserialize(buffer, size);
 }
@@ -207,21 +263,25 @@ Packet::Packet(const uint8_t* buffer, uint32_t size)
     : m_buffer(),
       m_byteTagList(),
       m_packetTagList(),
-      /* The upper 32 bits of the packet id in
-       * metadata is for the system id. For non-
-       * distributed simulations, this is simply
-       * zero.  The lower 32 bits are for the
-       * global UID
-       */
-      m_metadata(static_cast<uint64_t>(Simulator::GetSystemId()) << 32 | m_globalUid, size),
+      m_metadata(AllocateUid(), size),
       m_nixVector(nullptr)
 {
-    m_globalUid++;
+    PacketAccounting::NotifyCreated(this);
     m_buffer.AddAtStart(size);
     Buffer::Iterator i = m_buffer.Begin();
     i.Write(buffer, size);
 }
 
+Packet::Packet(Ptr<const SharedPayload> payload)
+    : m_buffer(payload, 0, payload->GetSize()),
+      m_byteTagList(),
+      m_packetTagList(),
+      m_metadata(AllocateUid(), payload->GetSize()),
+      m_nixVector(nullptr)
+{
+    PacketAccounting::NotifyCreated(this);
+}
+
 Packet::Packet(const Buffer& buffer,
                const ByteTagList& byteTagList,
                const PacketTagList& packetTagList,
@@ -232,6 +292,7 @@ Packet::Packet(const Buffer& buffer,
       m_metadata(metadata),
       m_nixVector(nullptr)
 {
+    PacketAccounting::NotifyCreated(this);
 }
 
 Ptr<Packet>
@@ -599,6 +660,13 @@ Packet::EnablePrinting()
     PacketMetadata::Enable();
 }
 
+void
+Packet::EnableCompactPrinting()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    PacketMetadata::EnableCompact();
+}
+
 void
 Packet::EnableChecking()
 {
@@ -1038,7 +1106,7 @@ Packet::PrintPacketTags(std::ostream& os) const
 PacketTagIterator
 Packet::GetPacketTagIterator() const
 {
-    return PacketTagIterator(m_packetTagList.Head());
+    return PacketTagIterator(&m_packetTagList);
 }
 
 std::ostream&
@@ -36,6 +36,10 @@
 
 #include <stdint.h>
 
+#ifdef NS3_MTP
+#include <atomic>
+#endif
+
 namespace ns3
 {
 
@@ -161,10 +165,14 @@ class PacketTagIterator
         friend class PacketTagIterator;
         /**
          * Constructor
-         * \param data the data to copy.
+         * \param tid the type of the tag.
+         * \param data the serialized tag.
+         * \param size the size of the serialized tag.
          */
-        Item(const struct PacketTagList::TagData* data);
-        const struct PacketTagList::TagData* m_data; //!< the tag data
+        Item(TypeId tid, const uint8_t* data, uint32_t size);
+        TypeId m_tid;          //!< the type of the tag
+        const uint8_t* m_data; //!< the serialized tag
+        uint32_t m_size;       //!< the size of the serialized tag
     };
 
     /**
@@ -181,11 +189,18 @@ class PacketTagIterator
     friend class Packet;
     /**
      * Constructor
-     * \param head head of the items
+     * \param list the tags of the packet
+     */
+    PacketTagIterator(const PacketTagList* list);
+    /**
+     * Move to the first used inline slot from \pname{slot}.
+     * \param slot the index of the first slot to check
      */
-    PacketTagIterator(const struct PacketTagList::TagData* head);
+    void SkipFreeSlots(uint8_t slot);
+    const PacketTagList* m_list; //!< the tags of the packet
+    uint8_t m_slot;              //!< the next inline slot, or INLINE_SLOTS when done
     const struct PacketTagList::TagData*
-        m_current; //!< actual position over the set of tags in a packet
+        m_current; //!< actual position over the list of tags in a packet
 };
 
 /**
@@ -250,6 +265,10 @@ class Packet : public SimpleRefCount<Packet>
      * \param o object to copy
      */
     Packet(const Packet& o);
+    /**
+     * \brief Destructor
+     */
+    ~Packet();
     /**
      * \brief Basic assignment
      * \param o object to copy
@@ -292,6 +311,17 @@ class Packet : public SimpleRefCount<Packet>
      * \param size the size of the input buffer.
      */
     Packet(const uint8_t* buffer, uint32_t size);
+    /**
+     * \brief Create a packet whose payload is a SharedPayload.
+     *
+     * The payload bytes are not copied: they are shared with the
+     * copies and the fragments of this packet, and with the packets
+     * they are concatenated with by AddAtEnd(). The packet is allocated
+     * with a new uid (as returned by getUid).
+     *
+     * \param payload the payload.
+     */
+    Packet(Ptr<const SharedPayload> payload);
     /**
      * \brief Create a new packet which contains a fragment of the original
      * packet.
@@ -527,6 +557,18 @@ class Packet : public SimpleRefCount<Packet>
      * simulation setup and before any packet is created.
      */
     static void EnablePrinting();
+    /**
+     * \brief Enable printing packets metadata, with a compact
+     * representation of the metadata.
+     *
+     * This is equivalent to EnablePrinting(), but the headers and
+     * trailers added to a packet are recorded in a small array shared
+     * by the copies of the packet, which is much cheaper to build than
+     * the full metadata, until the packet is fragmented, concatenated,
+     * serialized or printed. This makes the metadata much cheaper for the packets
+     * which are never printed.
+     */
+    static void EnableCompactPrinting();
     /**
      * \brief Enable packets metadata checking.
      *
@@ -539,6 +581,22 @@ class Packet : public SimpleRefCount<Packet>
      */
     static void EnableChecking();
 
+#ifdef NS3_MTP
+    /**
+     * \brief Set the counter of the uids of the packets created by the
+     * calling thread.
+     *
+     * The MultithreadedSimulatorImpl gives each logical process its own
+     * counter while a thread processes its events, so that the uids do not
+     * depend on the interleaving of the threads.
+     *
+     * \param prefix the upper 32 bits of the uids, which identify the counter
+     * \param counter the counter of the lower 32 bits of the uids, or nullptr
+     *        to use the global counter again
+     */
+    static void SetThreadUidCounter(uint32_t prefix, uint32_t* counter);
+#endif
+
     /**
      * \brief Returns number of bytes required for packet
      * serialization.
@@ -769,6 +827,12 @@ class Packet : public SimpleRefCount<Packet>
     typedef void (*SinrTracedCallback)(Ptr<const Packet> packet, double sinr);
 
   private:
+    /**
+     * \brief Allocate the uid of a new packet
+     * \returns the uid
+     */
+    static uint64_t AllocateUid();
+
     /**
      * \brief Constructor
      * \param buffer the packet buffer
@@ -797,7 +861,11 @@ class Packet : public SimpleRefCount<Packet>
     /* Please see comments above about nix-vector */
     mutable Ptr<NixVector> m_nixVector; //!< the packet's Nix vector
 
+#ifdef NS3_MTP
+    static std::atomic<uint32_t> m_globalUid; //!< Global counter of packets Uid
+#else
     static uint32_t m_globalUid; //!< Global counter of packets Uid
+#endif
 };
 
 /**
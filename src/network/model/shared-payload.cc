@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "shared-payload.h"
+
+#include "ns3/log.h"
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::SharedPayload implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SharedPayload");
+
+SharedPayload::SharedPayload(const uint8_t* data, uint32_t size)
+    : m_data(data, data + size)
+{
+    NS_LOG_FUNCTION(this << &data << size);
+}
+
+SharedPayload::SharedPayload(std::vector<uint8_t>&& data)
+    : m_data(std::move(data))
+{
+    NS_LOG_FUNCTION(this << m_data.size());
+}
+
+} // namespace ns3
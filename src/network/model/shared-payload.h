@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SHARED_PAYLOAD_H
+#define SHARED_PAYLOAD_H
+
+#include "ns3/simple-ref-count.h"
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup packet
+ * ns3::SharedPayload declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup packet
+ * \brief Immutable application bytes shared by packets.
+ *
+ * A Buffer normally stores the bytes written by the applications with
+ * its headers, so these bytes are copied again each time a shared
+ * buffer is modified, and when buffers are concatenated. A Buffer created
+ * from a SharedPayload instead references a slice of it in place of its
+ * "virtual zero area": the copies, fragments and reassemblies of the
+ * packet share the payload bytes, and only the headers and trailers are
+ * copied.
+ *
+ * The bytes cannot be modified once the SharedPayload is created.
+ */
+class SharedPayload : public SimpleRefCount<SharedPayload>
+{
+  public:
+    /**
+     * Create a payload with a copy of some bytes.
+     *
+     * \param [in] data The bytes.
+     * \param [in] size The number of bytes.
+     */
+    SharedPayload(const uint8_t* data, uint32_t size);
+    /**
+     * Create a payload which takes over the content of a vector.
+     *
+     * \param [in] data The bytes.
+     */
+    SharedPayload(std::vector<uint8_t>&& data);
+
+    /**
+     * \returns The bytes.
+     */
+    inline const uint8_t* GetData() const;
+    /**
+     * \returns The number of bytes.
+     */
+    inline uint32_t GetSize() const;
+
+  private:
+    const std::vector<uint8_t> m_data; //!< The bytes.
+};
+
+/*************************************************
+ *  Inline implementations
+ ************************************************/
+
+const uint8_t*
+SharedPayload::GetData() const
+{
+    return m_data.data();
+}
+
+uint32_t
+SharedPayload::GetSize() const
+{
+    return m_data.size();
+}
+
+} // namespace ns3
+
+#endif /* SHARED_PAYLOAD_H */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/binary-trace-writer.h"
+#include "ns3/output-stream-wrapper.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/trace-helper.h"
+
+#include <cstring>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Binary trace test: the default ascii trace sinks write binary
+ * records to a binary stream, which convert back to the ascii traces.
+ */
+class BinaryTraceTestCase : public TestCase
+{
+  public:
+    BinaryTraceTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Trace the events, with and without context.
+     *
+     * \param stream The stream to which the events are traced.
+     */
+    void TraceEvents(Ptr<OutputStreamWrapper> stream);
+
+    Ptr<Packet> m_first;  //!< The first packet traced
+    Ptr<Packet> m_second; //!< The second packet traced
+};
+
+BinaryTraceTestCase::BinaryTraceTestCase()
+    : TestCase("Check the binary records of the default ascii trace sinks")
+{
+}
+
+void
+BinaryTraceTestCase::TraceEvents(Ptr<OutputStreamWrapper> stream)
+{
+    std::string context = "/NodeList/3/DeviceList/1/$ns3::SimpleNetDevice/TxQueue/Enqueue";
+    std::string other = "/NodeList/4/$ns3::Ipv4L3Protocol/Drop";
+    AsciiTraceHelper::DefaultEnqueueSinkWithContext(stream, context, m_first);
+    AsciiTraceHelper::DefaultDequeueSinkWithContext(stream, context, m_first);
+    AsciiTraceHelper::DefaultDropSinkWithContext(stream, other, m_second);
+    AsciiTraceHelper::DefaultReceiveSinkWithContext(stream, context, m_second);
+    AsciiTraceHelper::DefaultEnqueueSinkWithoutContext(stream, m_first);
+    AsciiTraceHelper::DefaultDequeueSinkWithoutContext(stream, m_first);
+    AsciiTraceHelper::DefaultDropSinkWithoutContext(stream, m_second);
+    AsciiTraceHelper::DefaultReceiveSinkWithoutContext(stream, m_second);
+}
+
+void
+BinaryTraceTestCase::DoRun()
+{
+    m_first = Create<Packet>(100);
+    m_second = Create<Packet>(1000);
+
+    std::ostringstream binary;
+    Ptr<OutputStreamWrapper> stream = Create<OutputStreamWrapper>(&binary);
+    stream->SetBinaryTrace(Create<BinaryTraceWriter>(&binary));
+    Simulator::Schedule(MilliSeconds(1500), &BinaryTraceTestCase::TraceEvents, this, stream);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    //
+    // One record per event, plus one record and its characters per context.
+    //
+    std::string bytes = binary.str();
+    std::string context = "/NodeList/3/DeviceList/1/$ns3::SimpleNetDevice/TxQueue/Enqueue";
+    std::string other = "/NodeList/4/$ns3::Ipv4L3Protocol/Drop";
+    NS_TEST_ASSERT_MSG_EQ(bytes.size(),
+                          BinaryTraceWriter::HEADER_SIZE + 10 * BinaryTraceWriter::RECORD_SIZE +
+                              context.size() + other.size(),
+                          "Unexpected size of the binary trace");
+
+    uint32_t node;
+    uint16_t device;
+    const char* firstEvent = bytes.data() + BinaryTraceWriter::HEADER_SIZE +
+                             BinaryTraceWriter::RECORD_SIZE + context.size();
+    memcpy(&node, firstEvent + 24, 4);
+    memcpy(&device, firstEvent + 28, 2);
+    NS_TEST_EXPECT_MSG_EQ(node, 3, "The node must be parsed from the context");
+    NS_TEST_EXPECT_MSG_EQ(device, 1, "The device must be parsed from the context");
+
+    std::istringstream input(bytes);
+    std::ostringstream ascii;
+    NS_TEST_ASSERT_MSG_EQ(BinaryTraceWriter::ConvertToAscii(input, ascii),
+                          true,
+                          "The binary trace must be valid");
+    std::ostringstream expected;
+    std::string first = "uid=" + std::to_string(m_first->GetUid()) + " size=100\n";
+    std::string second = "uid=" + std::to_string(m_second->GetUid()) + " size=1000\n";
+    expected << "+ 1.5 " << context << " " << first << "- 1.5 " << context << " " << first
+             << "d 1.5 " << other << " " << second << "r 1.5 " << context << " " << second
+             << "+ 1.5 " << first << "- 1.5 " << first << "d 1.5 " << second << "r 1.5 "
+             << second;
+    NS_TEST_EXPECT_MSG_EQ(ascii.str(), expected.str(), "Unexpected conversion to ascii");
+
+    //
+    // A truncated trace is invalid.
+    //
+    std::istringstream truncated(bytes.substr(0, bytes.size() - 1));
+    std::ostringstream discarded;
+    NS_TEST_EXPECT_MSG_EQ(BinaryTraceWriter::ConvertToAscii(truncated, discarded),
+                          false,
+                          "A truncated binary trace must be invalid");
+
+    m_first = nullptr;
+    m_second = nullptr;
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Binary trace TestSuite
+ */
+class BinaryTraceTestSuite : public TestSuite
+{
+  public:
+    BinaryTraceTestSuite()
+        : TestSuite("binary-trace", UNIT)
+    {
+        AddTestCase(new BinaryTraceTestCase(), TestCase::QUICK);
+    }
+};
+
+static BinaryTraceTestSuite g_binaryTraceTestSuite; //!< Static variable for test initialization
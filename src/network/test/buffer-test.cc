@@ -17,11 +17,15 @@
  * Author: Mathieu Lacage <mathieu.lacage@cutebugs.net>
  */
 
+#include "ns3/buffer-pool.h"
 #include "ns3/buffer.h"
 #include "ns3/double.h"
+#include "ns3/header-field.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/test.h"
 
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -396,6 +400,263 @@ BufferTest::DoRun()
     NS_TEST_ASSERT_MSG_EQ(val1, val2, "Bad ReadNtohU16()");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * BufferPool unit tests.
+ */
+class BufferPoolTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    BufferPoolTest();
+};
+
+BufferPoolTest::BufferPoolTest()
+    : TestCase("BufferPool")
+{
+}
+
+void
+BufferPoolTest::DoRun()
+{
+    std::size_t previous = 0;
+    for (std::size_t size = 1; size <= BufferPool::MAX_POOLED_SIZE; size++)
+    {
+        std::size_t blockSize = BufferPool::GetBlockSize(size);
+        NS_TEST_ASSERT_MSG_GT_OR_EQ(blockSize, size, "Block too small for " << size);
+        NS_TEST_ASSERT_MSG_GT_OR_EQ(blockSize, previous, "Block sizes not sorted at " << size);
+        NS_TEST_ASSERT_MSG_EQ((blockSize <= BufferPool::MIN_BLOCK_SIZE || 4 * blockSize < 5 * size),
+                              true,
+                              "Block of " << blockSize << " bytes too large for " << size);
+        NS_TEST_ASSERT_MSG_EQ(BufferPool::GetBlockSize(blockSize),
+                              blockSize,
+                              "Block size " << blockSize << " not a size class");
+        previous = blockSize;
+    }
+    NS_TEST_EXPECT_MSG_EQ(BufferPool::GetBlockSize(BufferPool::MAX_POOLED_SIZE + 1),
+                          BufferPool::MAX_POOLED_SIZE + 1,
+                          "Oversize requests should not be rounded");
+
+    // Packets of mixed sizes are recycled once the pool is warm.
+    for (uint32_t round = 0; round < 2; round++)
+    {
+        BufferPool::ResetStatistics();
+        for (uint32_t size : {64, 1500, 65000, 200000})
+        {
+            Buffer buffer;
+            buffer.AddAtStart(size);
+            buffer.Begin().WriteU8(0, size);
+        }
+    }
+    BufferPool::Statistics stats = BufferPool::GetStatistics();
+    NS_TEST_EXPECT_MSG_EQ(stats.misses, 0, "Buffers were not recycled");
+    NS_TEST_EXPECT_MSG_EQ(stats.oversize, 1, "Only the 200000 bytes buffer is oversize");
+    NS_TEST_EXPECT_MSG_EQ(stats.hits, 7, "Buffers were not allocated from the pool");
+    NS_TEST_EXPECT_MSG_EQ(stats.frees, stats.hits + stats.oversize, "Buffers were not released");
+    NS_TEST_EXPECT_MSG_EQ(stats.outstandingBytes, 0, "Bytes are still outstanding");
+    NS_TEST_EXPECT_MSG_GT(BufferPool::GetReservedBytes(), 0, "No arena was allocated");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * SharedPayload unit tests.
+ */
+class SharedPayloadTest : public TestCase
+{
+  private:
+    /**
+     * Checks the buffer content
+     * \param b The buffer to check
+     * \param expected The bytes that should be in the buffer
+     */
+    void CheckBytes(const Buffer& b, const std::vector<uint8_t>& expected);
+
+  public:
+    void DoRun() override;
+    SharedPayloadTest();
+};
+
+SharedPayloadTest::SharedPayloadTest()
+    : TestCase("SharedPayload")
+{
+}
+
+void
+SharedPayloadTest::CheckBytes(const Buffer& b, const std::vector<uint8_t>& expected)
+{
+    NS_TEST_ASSERT_MSG_EQ(b.GetSize(), expected.size(), "Wrong buffer size");
+    std::vector<uint8_t> copied(b.GetSize());
+    b.CopyData(copied.data(), copied.size());
+    std::vector<uint8_t> read(b.GetSize());
+    b.Begin().Read(read.data(), read.size());
+    for (uint32_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(uint32_t(copied[i]), uint32_t(expected[i]), "Wrong copy at " << i);
+        NS_TEST_ASSERT_MSG_EQ(uint32_t(read[i]), uint32_t(expected[i]), "Wrong read at " << i);
+    }
+}
+
+void
+SharedPayloadTest::DoRun()
+{
+    const uint32_t size = 60000;
+    std::vector<uint8_t> bytes(size);
+    for (uint32_t i = 0; i < size; i++)
+    {
+        bytes[i] = i * 7 + i / 256;
+    }
+    auto payload = Create<SharedPayload>(bytes.data(), size);
+    std::vector<uint8_t> header{1, 2, 3, 4};
+
+    BufferPool::ResetStatistics();
+    Buffer buffer(payload, 0, size);
+    CheckBytes(buffer, bytes);
+
+    // Add a header to a shared copy.
+    Buffer copy = buffer;
+    copy.AddAtStart(header.size());
+    copy.Begin().Write(header.data(), header.size());
+    std::vector<uint8_t> expected = header;
+    expected.insert(expected.end(), bytes.begin(), bytes.end());
+    CheckBytes(copy, expected);
+    CheckBytes(buffer, bytes);
+
+    // Fragment the copy, and join the fragments again.
+    Buffer first = copy.CreateFragment(0, 1000);
+    Buffer second = copy.CreateFragment(1000, 30000);
+    Buffer third = copy.CreateFragment(31000, size + header.size() - 31000);
+    CheckBytes(second, std::vector<uint8_t>(expected.begin() + 1000, expected.begin() + 31000));
+    NS_TEST_EXPECT_MSG_EQ(second.GetSharedPayload(), payload, "Fragment not sharing the payload");
+    Buffer joined = first;
+    joined.AddAtEnd(second);
+    NS_TEST_EXPECT_MSG_EQ(joined.GetSharedPayload(), payload, "Fragments were copied");
+    joined.AddAtEnd(third);
+    CheckBytes(joined, expected);
+    NS_TEST_EXPECT_MSG_EQ(joined.GetSharedPayload(), payload, "Fragments were copied");
+
+    // Append a trailer.
+    Buffer trailer;
+    trailer.AddAtStart(header.size());
+    trailer.Begin().Write(header.data(), header.size());
+    joined.AddAtEnd(trailer);
+    expected.insert(expected.end(), header.begin(), header.end());
+    CheckBytes(joined, expected);
+    NS_TEST_EXPECT_MSG_EQ(joined.GetSharedPayload(), payload, "Payload copied by AddAtEnd");
+
+    // None of the operations above copied the payload bytes.
+    NS_TEST_EXPECT_MSG_LT(BufferPool::GetStatistics().outstandingBytes,
+                          int64_t(size),
+                          "Payload bytes were copied");
+
+    // Serialization copies the payload bytes.
+    std::vector<uint8_t> serialized(joined.GetSerializedSize());
+    NS_TEST_ASSERT_MSG_EQ(joined.Serialize(serialized.data(), serialized.size()),
+                          1,
+                          "Serialization failed");
+    Buffer deserialized;
+    // The size includes the length field which Packet::Serialize writes first.
+    deserialized.Deserialize(serialized.data(), serialized.size() + 4);
+    CheckBytes(deserialized, expected);
+    NS_TEST_EXPECT_MSG_EQ(bool(deserialized.GetSharedPayload()), false, "Payload not serialized");
+
+    // Concatenating two payloads copies them.
+    Buffer other(Create<SharedPayload>(std::vector<uint8_t>(header)), 0, header.size());
+    joined.AddAtEnd(other);
+    expected.insert(expected.end(), header.begin(), header.end());
+    CheckBytes(joined, expected);
+
+    // Removing the payload releases it.
+    Buffer fragment = copy.CreateFragment(0, header.size());
+    NS_TEST_EXPECT_MSG_EQ(bool(fragment.GetSharedPayload()),
+                          false,
+                          "Header fragment holds the payload");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Fixed-layout header (Buffer::Iterator spans and HeaderField) unit tests.
+ */
+class HeaderFieldTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    HeaderFieldTest();
+};
+
+HeaderFieldTest::HeaderFieldTest()
+    : TestCase("HeaderField")
+{
+}
+
+void
+HeaderFieldTest::DoRun()
+{
+    using Type = HeaderField<0, uint8_t>;
+    using Length = HeaderField<Type::END, uint16_t>;
+    using Checksum = HeaderField<Length::END, uint16_t, false>;
+    using Address = HeaderField<Checksum::END, uint32_t>;
+    using Sequence = HeaderField<Address::END, uint64_t>;
+    const uint32_t size = Sequence::END;
+    NS_TEST_ASSERT_MSG_EQ(size, 17, "Wrong header size");
+
+    // A span written with HeaderField holds the bytes written by the
+    // Buffer::Iterator methods.
+    Buffer spans;
+    spans.AddAtStart(size);
+    uint8_t* header = spans.Begin().WriteSpan(size);
+    Type::Write(header, 0x12);
+    Length::Write(header, 0x3456);
+    Checksum::Write(header, 0x789a);
+    Address::Write(header, 0xbcdef012);
+    Sequence::Write(header, 0x3456789abcdef012ULL);
+    Buffer fields;
+    fields.AddAtStart(size);
+    Buffer::Iterator i = fields.Begin();
+    i.WriteU8(0x12);
+    i.WriteHtonU16(0x3456);
+    i.WriteU16(0x789a);
+    i.WriteHtonU32(0xbcdef012);
+    i.WriteHtonU64(0x3456789abcdef012ULL);
+    std::vector<uint8_t> spanBytes(size);
+    std::vector<uint8_t> fieldBytes(size);
+    spans.CopyData(spanBytes.data(), size);
+    fields.CopyData(fieldBytes.data(), size);
+    NS_TEST_EXPECT_MSG_EQ((spanBytes == fieldBytes), true, "Fields written at the wrong place");
+
+    // The fields are read back from a span in place, or from the scratch
+    // buffer when the span straddles the virtual zero area.
+    for (uint32_t zeroOffset : {size, 5U})
+    {
+        Buffer buffer(size - zeroOffset);
+        buffer.AddAtStart(zeroOffset);
+        buffer.Begin().Write(spanBytes.data(), zeroOffset);
+        uint8_t scratch[size];
+        Buffer::Iterator j = buffer.Begin();
+        const uint8_t* read = j.ReadSpan(scratch, size);
+        NS_TEST_EXPECT_MSG_EQ((read == scratch), (zeroOffset < size), "Wrong span location");
+        NS_TEST_EXPECT_MSG_EQ(j.IsEnd(), true, "Iterator not moved past the span");
+        NS_TEST_EXPECT_MSG_EQ(uint32_t(Type::Read(read)), 0x12, "Wrong type");
+        NS_TEST_EXPECT_MSG_EQ(Length::Read(read), 0x3456, "Wrong length");
+        if (zeroOffset == size)
+        {
+            NS_TEST_EXPECT_MSG_EQ(Checksum::Read(read), 0x789a, "Wrong checksum");
+            NS_TEST_EXPECT_MSG_EQ(Address::Read(read), 0xbcdef012, "Wrong address");
+            NS_TEST_EXPECT_MSG_EQ(Sequence::Read(read), 0x3456789abcdef012ULL, "Wrong sequence");
+        }
+        else
+        {
+            // The bytes in the virtual zero area are zero.
+            NS_TEST_EXPECT_MSG_EQ(Address::Read(read), 0, "Wrong zero area");
+        }
+    }
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -412,6 +673,9 @@ BufferTestSuite::BufferTestSuite()
     : TestSuite("buffer", UNIT)
 {
     AddTestCase(new BufferTest, TestCase::QUICK);
+    AddTestCase(new BufferPoolTest, TestCase::QUICK);
+    AddTestCase(new SharedPayloadTest, TestCase::QUICK);
+    AddTestCase(new HeaderFieldTest, TestCase::QUICK);
 }
 
 static BufferTestSuite g_bufferTestSuite; //!< Static variable for test initialization
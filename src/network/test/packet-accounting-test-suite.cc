@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/drop-tail-queue.h"
+#include "ns3/packet-accounting.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Packet accounting test: the live packets are reported by creation
+ * node and by holder, with their age.
+ */
+class PacketAccountingTestCase : public TestCase
+{
+  public:
+    PacketAccountingTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Create packets, and enqueue some of them.
+     * \param sizes The sizes of the packets.
+     * \param enqueued The number of packets enqueued.
+     */
+    void CreatePackets(std::vector<uint32_t> sizes, uint32_t enqueued);
+    /// Check the snapshot of the live packets.
+    void CheckSnapshot();
+
+    Ptr<Queue<Packet>> m_queue;         //!< The holder of the packets enqueued
+    std::vector<Ptr<Packet>> m_packets; //!< The packets created
+};
+
+PacketAccountingTestCase::PacketAccountingTestCase()
+    : TestCase("Check the accounting of the live packets")
+{
+}
+
+void
+PacketAccountingTestCase::CreatePackets(std::vector<uint32_t> sizes, uint32_t enqueued)
+{
+    for (uint32_t size : sizes)
+    {
+        m_packets.push_back(Create<Packet>(size));
+        if (enqueued > 0)
+        {
+            m_queue->Enqueue(m_packets.back());
+            enqueued--;
+        }
+    }
+}
+
+void
+PacketAccountingTestCase::CheckSnapshot()
+{
+    PacketAccounting::Snapshot snapshot = PacketAccounting::GetSnapshot();
+    NS_TEST_EXPECT_MSG_EQ(snapshot.total.packets, 4, "Unexpected number of live packets");
+    NS_TEST_EXPECT_MSG_EQ(snapshot.total.bytes, 650, "Unexpected bytes of the live packets");
+    NS_TEST_EXPECT_MSG_EQ(snapshot.total.maxAge, Seconds(2), "Unexpected age of the oldest");
+    // the zero-filled payloads are not allocated
+    NS_TEST_EXPECT_MSG_GT(snapshot.bufferBytes, 0, "The buffers must be accounted for");
+
+    NS_TEST_EXPECT_MSG_EQ(snapshot.nodes[3].packets, 3, "Unexpected packets created by node 3");
+    NS_TEST_EXPECT_MSG_EQ(snapshot.nodes[5].packets, 1, "Unexpected packets created by node 5");
+    NS_TEST_EXPECT_MSG_EQ(snapshot.nodes[5].maxAge, Seconds(1), "Unexpected age on node 5");
+
+    NS_TEST_EXPECT_MSG_EQ(snapshot.unheld.packets, 2, "Unexpected number of unheld packets");
+    NS_TEST_EXPECT_MSG_EQ(snapshot.unheld.bytes, 350, "Unexpected bytes of the unheld packets");
+
+    NS_TEST_ASSERT_MSG_EQ(snapshot.holders.size(), 1, "The queue must be the only holder");
+    const PacketAccounting::HolderUsage& holder = snapshot.holders.front();
+    NS_TEST_EXPECT_MSG_EQ(holder.name, "ns3::DropTailQueue<Packet>", "Unexpected holder");
+    NS_TEST_EXPECT_MSG_EQ(holder.node, 3, "Unexpected node of the holder");
+    NS_TEST_EXPECT_MSG_EQ(holder.usage.packets, 2, "Unexpected number of packets held");
+    NS_TEST_EXPECT_MSG_EQ(holder.usage.bytes, 300, "Unexpected bytes of the packets held");
+
+    std::ostringstream report;
+    PacketAccounting::Report(report, 5);
+    NS_TEST_EXPECT_MSG_NE(report.str().find("ns3::DropTailQueue<Packet> on node 3: 2 packets"),
+                          std::string::npos,
+                          "The report must list the holder");
+
+    m_queue->Dequeue();
+    snapshot = PacketAccounting::GetSnapshot();
+    NS_TEST_EXPECT_MSG_EQ(snapshot.holders.front().usage.packets,
+                          1,
+                          "A dequeued packet must be released by the queue");
+    NS_TEST_EXPECT_MSG_EQ(snapshot.unheld.packets, 3, "Unexpected number of unheld packets");
+}
+
+void
+PacketAccountingTestCase::DoRun()
+{
+    PacketAccounting::Enable();
+    m_queue = CreateObject<DropTailQueue<Packet>>();
+
+    Simulator::ScheduleWithContext(3,
+                                   Seconds(1),
+                                   &PacketAccountingTestCase::CreatePackets,
+                                   this,
+                                   std::vector<uint32_t>{100, 200, 300},
+                                   2);
+    Simulator::ScheduleWithContext(5,
+                                   Seconds(2),
+                                   &PacketAccountingTestCase::CreatePackets,
+                                   this,
+                                   std::vector<uint32_t>{50},
+                                   0);
+    Simulator::Schedule(Seconds(3), &PacketAccountingTestCase::CheckSnapshot, this);
+    Simulator::Run();
+
+    m_queue->Flush();
+    m_packets.clear();
+    PacketAccounting::Snapshot snapshot = PacketAccounting::GetSnapshot();
+    NS_TEST_EXPECT_MSG_EQ(snapshot.total.packets, 0, "The destroyed packets must be forgotten");
+    NS_TEST_EXPECT_MSG_EQ(snapshot.holders.size(), 0, "The holders must be forgotten");
+
+    m_queue = nullptr;
+    Simulator::Destroy();
+    PacketAccounting::Disable();
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Packet accounting TestSuite
+ */
+class PacketAccountingTestSuite : public TestSuite
+{
+  public:
+    PacketAccountingTestSuite()
+        : TestSuite("packet-accounting", UNIT)
+    {
+        AddTestCase(new PacketAccountingTestCase(), TestCase::QUICK);
+    }
+};
+
+/// Static variable for test initialization
+static PacketAccountingTestSuite g_packetAccountingTestSuite;
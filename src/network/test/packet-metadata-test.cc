@@ -326,7 +326,11 @@ HistoryTrailer<N>::Deserialize(Buffer::Iterator start)
 class PacketMetadataTest : public TestCase
 {
   public:
-    PacketMetadataTest();
+    /**
+     * Constructor
+     * \param compact Whether to enable the compact representation of the metadata.
+     */
+    PacketMetadataTest(bool compact);
     ~PacketMetadataTest() override;
     /**
      * Checks the packet header and trailer history
@@ -335,7 +339,9 @@ class PacketMetadataTest : public TestCase
      * \param ... The variable arguments
      */
     void CheckHistory(Ptr<Packet> p, uint32_t n, ...);
+    void DoSetup() override;
     void DoRun() override;
+    void DoTeardown() override;
 
   private:
     /**
@@ -344,10 +350,15 @@ class PacketMetadataTest : public TestCase
      * \return The packet with the header added.
      */
     Ptr<Packet> DoAddHeader(Ptr<Packet> p);
+
+    bool m_compact;    //!< Whether to enable the compact representation of the metadata.
+    bool m_wasCompact; //!< Whether the compact representation was enabled before the test.
 };
 
-PacketMetadataTest::PacketMetadataTest()
-    : TestCase("Packet metadata")
+PacketMetadataTest::PacketMetadataTest(bool compact)
+    : TestCase(compact ? "Packet metadata, compact representation" : "Packet metadata"),
+      m_compact(compact),
+      m_wasCompact(false)
 {
 }
 
@@ -476,10 +487,38 @@ PacketMetadataTest::DoAddHeader(Ptr<Packet> p)
     return p;
 }
 
+void
+PacketMetadataTest::DoSetup()
+{
+    m_wasCompact = PacketMetadata::IsCompactEnabled();
+    if (m_compact)
+    {
+        PacketMetadata::EnableCompact();
+    }
+    else
+    {
+        PacketMetadata::Enable();
+        PacketMetadata::DisableCompact();
+    }
+}
+
+void
+PacketMetadataTest::DoTeardown()
+{
+    // The mode is process-wide: restore it for the other tests.
+    if (m_wasCompact)
+    {
+        PacketMetadata::EnableCompact();
+    }
+    else
+    {
+        PacketMetadata::DisableCompact();
+    }
+}
+
 void
 PacketMetadataTest::DoRun()
 {
-    PacketMetadata::Enable();
 
     Ptr<Packet> p = Create<Packet>(0);
     Ptr<Packet> p1 = Create<Packet>(0);
@@ -879,6 +918,28 @@ PacketMetadataTest::DoRun()
     NS_TEST_EXPECT_MSG_EQ(msg,
                           std::string("hello world"),
                           "Could not find original data in received packet");
+
+    // a stack of headers deeper than the compact representation
+    p = Create<Packet>(10);
+    ADD_HEADER(p, 1);
+    ADD_HEADER(p, 2);
+    ADD_HEADER(p, 3);
+    ADD_HEADER(p, 4);
+    ADD_HEADER(p, 5);
+    ADD_HEADER(p, 6);
+    ADD_HEADER(p, 7);
+    ADD_HEADER(p, 8);
+    ADD_HEADER(p, 9);
+    ADD_TRAILER(p, 20);
+    ADD_TRAILER(p, 21);
+    ADD_TRAILER(p, 22);
+    p1 = p->Copy();
+    REM_HEADER(p, 9);
+    REM_TRAILER(p, 22);
+    CHECK_HISTORY(p, 11, 8, 7, 6, 5, 4, 3, 2, 1, 10, 20, 21);
+    p1->RemoveAtStart(9 + 8);
+    p1->RemoveAtEnd(22);
+    CHECK_HISTORY(p1, 10, 7, 6, 5, 4, 3, 2, 1, 10, 20, 21);
 }
 
 /**
@@ -896,7 +957,8 @@ class PacketMetadataTestSuite : public TestSuite
 PacketMetadataTestSuite::PacketMetadataTestSuite()
     : TestSuite("packet-metadata", UNIT)
 {
-    AddTestCase(new PacketMetadataTest, TestCase::QUICK);
+    AddTestCase(new PacketMetadataTest(false), TestCase::QUICK);
+    AddTestCase(new PacketMetadataTest(true), TestCase::QUICK);
 }
 
 static PacketMetadataTestSuite g_packetMetadataTest; //!< Static variable for test initialization
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/output-stream-wrapper.h"
+#include "ns3/packet-sampler.h"
+#include "ns3/packet.h"
+#include "ns3/pcap-file-wrapper.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/trace-helper.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Packet sampler test: the sampling is deterministic, and samples
+ * the fraction of the uids set by the rate.
+ */
+class PacketSamplerRateTestCase : public TestCase
+{
+  public:
+    PacketSamplerRateTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+PacketSamplerRateTestCase::PacketSamplerRateTestCase()
+    : TestCase("Check the fraction of the packets sampled")
+{
+}
+
+void
+PacketSamplerRateTestCase::DoRun()
+{
+    const uint64_t uids = 100000;
+
+    PacketSampler::SetRate(1);
+    uint64_t sampled = 0;
+    for (uint64_t uid = 0; uid < uids; ++uid)
+    {
+        sampled += PacketSampler::IsSampled(uid);
+    }
+    NS_TEST_EXPECT_MSG_EQ(sampled, uids, "All the packets must be sampled at rate 1");
+
+    PacketSampler::SetRate(0);
+    sampled = 0;
+    for (uint64_t uid = 0; uid < uids; ++uid)
+    {
+        sampled += PacketSampler::IsSampled(uid);
+    }
+    NS_TEST_EXPECT_MSG_EQ(sampled, 0, "No packet must be sampled at rate 0");
+
+    PacketSampler::SetRate(0.1);
+    NS_TEST_EXPECT_MSG_EQ(PacketSampler::GetRate(), 0.1, "Unexpected sampling rate");
+    sampled = 0;
+    bool deterministic = true;
+    for (uint64_t uid = 0; uid < uids; ++uid)
+    {
+        bool isSampled = PacketSampler::IsSampled(uid);
+        sampled += isSampled;
+        deterministic &= (isSampled == PacketSampler::IsSampled(uid));
+    }
+    NS_TEST_EXPECT_MSG_EQ(deterministic, true, "The sampling of a uid must not change");
+    NS_TEST_EXPECT_MSG_EQ_TOL(sampled, uids / 10, uids / 100, "Unexpected number of samples");
+
+    // A copy of a packet keeps its uid, and so its sampling.
+    Ptr<Packet> p = Create<Packet>(10);
+    NS_TEST_EXPECT_MSG_EQ(PacketSampler::IsSampled(p->Copy()),
+                          PacketSampler::IsSampled(p),
+                          "A copy must be sampled as the original packet");
+
+    PacketSampler::SetRate(1);
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Packet sampler test: the pcap files and the ascii traces which
+ * opt into the sampling trace only the sampled packets.
+ */
+class PacketSamplerTraceTestCase : public TestCase
+{
+  public:
+    PacketSamplerTraceTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+PacketSamplerTraceTestCase::PacketSamplerTraceTestCase()
+    : TestCase("Check the traces of the sampled packets")
+{
+}
+
+void
+PacketSamplerTraceTestCase::DoRun()
+{
+    const uint32_t packets = 1000;
+    const uint32_t size = 10;
+    PacketSampler::SetRate(0.2);
+
+    std::string filename = CreateTempDirFilename("packet-sampler.pcap");
+    Ptr<PcapFileWrapper> pcap = CreateObject<PcapFileWrapper>();
+    pcap->SetAttribute("PacketSampling", BooleanValue(true));
+    pcap->Open(filename, std::ios::out);
+    pcap->Init(PcapHelper::DLT_RAW);
+
+    std::ostringstream ascii;
+    Ptr<OutputStreamWrapper> stream = Create<OutputStreamWrapper>(&ascii);
+    stream->SetPacketSampling(true);
+
+    uint32_t sampled = 0;
+    for (uint32_t i = 0; i < packets; ++i)
+    {
+        Ptr<Packet> p = Create<Packet>(size);
+        sampled += PacketSampler::IsSampled(p);
+        pcap->Write(Seconds(1), p);
+        AsciiTraceHelper::DefaultReceiveSinkWithoutContext(stream, p);
+    }
+    pcap->Close();
+    NS_TEST_EXPECT_MSG_GT(sampled, 0, "Some packets must be sampled");
+    NS_TEST_EXPECT_MSG_LT(sampled, packets, "Some packets must not be sampled");
+
+    // A pcap file header, and a record header and the data per sampled packet
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    NS_TEST_EXPECT_MSG_EQ(static_cast<uint32_t>(file.tellg()),
+                          24 + sampled * (16 + size),
+                          "Only the sampled packets must be written to the pcap file");
+
+    // One line per sampled packet
+    std::string lines = ascii.str();
+    NS_TEST_EXPECT_MSG_EQ(std::count(lines.begin(), lines.end(), '\n'),
+                          sampled,
+                          "Only the sampled packets must be traced");
+
+    PacketSampler::SetRate(1);
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Packet sampler TestSuite
+ */
+class PacketSamplerTestSuite : public TestSuite
+{
+  public:
+    PacketSamplerTestSuite()
+        : TestSuite("packet-sampler", UNIT)
+    {
+        AddTestCase(new PacketSamplerRateTestCase(), TestCase::QUICK);
+        AddTestCase(new PacketSamplerTraceTestCase(), TestCase::QUICK);
+    }
+};
+
+static PacketSamplerTestSuite g_packetSamplerTestSuite; //!< Static variable for test initialization
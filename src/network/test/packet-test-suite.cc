@@ -25,7 +25,9 @@
 #include <iomanip>
 #include <iostream>
 #include <limits> // std:numeric_limits
+#include <set>
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -956,6 +958,28 @@ PacketTest::DoRun()
         ALargeTestTag a;
         tmp->AddPacketTag(a);
     }
+
+    /* Test a shared payload which is fragmented and reassembled */
+    {
+        std::vector<uint8_t> bytes(2000);
+        for (uint32_t i = 0; i < bytes.size(); i++)
+        {
+            bytes[i] = i % 251;
+        }
+        Ptr<Packet> tmp = Create<Packet>(Create<SharedPayload>(bytes.data(), bytes.size()));
+        tmp->AddHeader(ATestHeader<10>());
+        tmp->AddByteTag(ATestTag<20>());
+        Ptr<Packet> frag0 = tmp->CreateFragment(0, 1010);
+        Ptr<Packet> frag1 = tmp->CreateFragment(1010, 1000);
+        frag0->AddAtEnd(frag1);
+        CHECK(frag0, 2, E(20, 0, 1010), E(20, 1010, 2010));
+        ATestHeader<10> header;
+        frag0->RemoveHeader(header);
+        NS_TEST_EXPECT_MSG_EQ(header.m_error, false, "Wrong header");
+        std::vector<uint8_t> copied(frag0->GetSize());
+        frag0->CopyData(copied.data(), copied.size());
+        NS_TEST_EXPECT_MSG_EQ((copied == bytes), true, "Wrong payload");
+    }
 }
 
 /**
@@ -1198,6 +1222,61 @@ PacketTagListTest::DoRun()
     ReplaceCheck(7);
 }
 
+{ // Inline slots and list
+    std::cout << GetName() << "check iteration and serialization" << std::endl;
+    // Seven small tags do not all fit in the inline slots, and the large
+    // tag never does.
+    Ptr<Packet> p = Create<Packet>(10);
+    p->AddPacketTag(t1);
+    p->AddPacketTag(t2);
+    p->AddPacketTag(t3);
+    p->AddPacketTag(t4);
+    p->AddPacketTag(t5);
+    p->AddPacketTag(t6);
+    p->AddPacketTag(t7);
+    p->AddPacketTag(ALargeTestTag());
+
+    std::set<TypeId> seen;
+    PacketTagIterator i = p->GetPacketTagIterator();
+    while (i.HasNext())
+    {
+        TypeId tid = i.Next().GetTypeId();
+        NS_TEST_EXPECT_MSG_EQ(seen.count(tid), 0, "tag " << tid.GetName() << " seen twice");
+        seen.insert(tid);
+    }
+    NS_TEST_EXPECT_MSG_EQ(seen.size(), 8, "iteration over the packet tags");
+
+    uint32_t serializedSize = p->GetSerializedSize();
+    std::vector<uint8_t> buffer(serializedSize);
+    p->Serialize(buffer.data(), serializedSize);
+    Ptr<Packet> q = Create<Packet>(buffer.data(), serializedSize, true);
+    ALargeTestTag large;
+    NS_TEST_EXPECT_MSG_EQ(q->RemovePacketTag(large), true, "deserialized large tag");
+    NS_TEST_EXPECT_MSG_EQ(large.GetSerializedSize(), LARGE_TAG_BUFFER_SIZE, "large tag");
+    NS_TEST_EXPECT_MSG_EQ(q->RemovePacketTag(t1), true, "deserialized t1");
+    NS_TEST_EXPECT_MSG_EQ(q->RemovePacketTag(t2), true, "deserialized t2");
+    NS_TEST_EXPECT_MSG_EQ(q->RemovePacketTag(t3), true, "deserialized t3");
+    NS_TEST_EXPECT_MSG_EQ(q->RemovePacketTag(t4), true, "deserialized t4");
+    NS_TEST_EXPECT_MSG_EQ(q->RemovePacketTag(t5), true, "deserialized t5");
+    NS_TEST_EXPECT_MSG_EQ(q->RemovePacketTag(t6), true, "deserialized t6");
+    NS_TEST_EXPECT_MSG_EQ(q->RemovePacketTag(t7), true, "deserialized t7");
+    NS_TEST_EXPECT_MSG_EQ(q->GetPacketTagIterator().HasNext(), false, "all tags removed");
+
+    p->RemoveAllPacketTags();
+    NS_TEST_EXPECT_MSG_EQ(p->GetPacketTagIterator().HasNext(), false, "all tags removed");
+    NS_TEST_EXPECT_MSG_EQ(p->PeekPacketTag(t1), false, "all tags removed");
+
+    // The copies share the inline slots until one of them changes a tag.
+    p->AddPacketTag(t1);
+    Ptr<Packet> copy = p->Copy();
+    copy->AddPacketTag(t2);
+    NS_TEST_EXPECT_MSG_EQ(p->PeekPacketTag(t2), false, "tag added to the copy only");
+    NS_TEST_EXPECT_MSG_EQ(copy->RemovePacketTag(t1), true, "tag of the original packet");
+    NS_TEST_EXPECT_MSG_EQ(p->PeekPacketTag(t1), true, "tag removed from the copy only");
+    NS_TEST_EXPECT_MSG_EQ(copy->RemovePacketTag(t2), true, "tag of the copy");
+    NS_TEST_EXPECT_MSG_EQ(copy->GetPacketTagIterator().HasNext(), false, "all tags removed");
+}
+
 { // Timing
     std::cout << GetName() << "add+remove timing" << std::endl;
     int flm = std::numeric_limits<int>::max();
@@ -15,15 +15,29 @@
  * Author:  Craig Dowell (craigdo@ee.washington.edu)
  */
 
+#include "ns3/boolean.h"
+#include "ns3/ethernet-header.h"
 #include "ns3/log.h"
+#include "ns3/packet.h"
+#include "ns3/pcap-file-wrapper.h"
 #include "ns3/pcap-file.h"
+#include "ns3/pcapng-file.h"
+#include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/trace-helper.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <sstream>
+#include <vector>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
 
 using namespace ns3;
 
@@ -1375,6 +1389,378 @@ DiffTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(usec, 3696, "Files are different from 2.3696 seconds");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Test case to make sure that the asynchronous writes produce the
+ * same file as the synchronous ones.
+ */
+class AsyncWriteTestCase : public TestCase
+{
+  public:
+    AsyncWriteTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Write files with all the Write methods, interleaving their records.
+     *
+     * \param filenames The file names.
+     * \param swapMode The swap mode.
+     * \param async Whether to write in asynchronous mode.
+     */
+    void WriteFiles(const std::vector<std::string>& filenames, bool swapMode, bool async);
+};
+
+AsyncWriteTestCase::AsyncWriteTestCase()
+    : TestCase("Check that PcapFile::EnableAsync does not change the file")
+{
+}
+
+void
+AsyncWriteTestCase::WriteFiles(const std::vector<std::string>& filenames, bool swapMode, bool async)
+{
+    std::vector<PcapFile> files(filenames.size());
+    for (std::size_t k = 0; k < files.size(); ++k)
+    {
+        files[k].Open(filenames[k], std::ios::out);
+        NS_TEST_ASSERT_MSG_EQ(files[k].Fail(),
+                              false,
+                              "Open (" << filenames[k] << ") returns error");
+        files[k].Init(1, 128, PcapFile::ZONE_DEFAULT, swapMode);
+        if (async)
+        {
+            // Chunks smaller than the records: the header and the data of a
+            // record are split between two chunks, the chunks are grown to
+            // fit the data, and the writes wait for the writer thread.
+            files[k].EnableAsync(100);
+        }
+    }
+
+    std::vector<uint8_t> data(300);
+    for (uint32_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = i & 0xff;
+    }
+    EthernetHeader header;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        uint32_t size = (i * 37) % data.size();
+        Ptr<Packet> p = Create<Packet>(data.data(), size);
+        for (auto& f : files)
+        {
+            f.Write(i, i * 10, data.data(), size);
+            f.Write(i, i * 10 + 1, p);
+            f.Write(i, i * 10 + 2, header, p);
+        }
+    }
+    for (auto& f : files)
+    {
+        f.Flush();
+        NS_TEST_EXPECT_MSG_EQ(f.Fail(), false, "Write must not fail");
+        f.Close();
+    }
+}
+
+void
+AsyncWriteTestCase::DoRun()
+{
+    // The files share the writer thread, and a single chunk waits for it.
+    PcapFile::SetAsyncMaxChunks(1);
+    for (bool swapMode : {false, true})
+    {
+        std::string syncFilename = CreateTempDirFilename("sync.pcap");
+        std::string asyncFilename = CreateTempDirFilename("async.pcap");
+        std::string otherFilename = CreateTempDirFilename("async-other.pcap");
+        WriteFiles({syncFilename}, swapMode, false);
+        WriteFiles({asyncFilename, otherFilename}, swapMode, true);
+
+        std::ifstream syncFile(syncFilename, std::ios::binary);
+        std::string syncBytes{std::istreambuf_iterator<char>(syncFile),
+                              std::istreambuf_iterator<char>()};
+        NS_TEST_EXPECT_MSG_GT(syncBytes.size(), 24, "Records must be written");
+        for (const auto& filename : {asyncFilename, otherFilename})
+        {
+            std::ifstream asyncFile(filename, std::ios::binary);
+            std::string asyncBytes{std::istreambuf_iterator<char>(asyncFile),
+                                   std::istreambuf_iterator<char>()};
+            NS_TEST_EXPECT_MSG_EQ((syncBytes == asyncBytes),
+                                  true,
+                                  "Asynchronous writes must produce the same file, swap mode "
+                                      << swapMode << ", file " << filename);
+        }
+
+        // The records written from raw bytes, larger than the chunks,
+        // read back unchanged.
+        PcapFile f;
+        f.Open(asyncFilename, std::ios::in);
+        NS_TEST_ASSERT_MSG_EQ(f.Fail(), false, "Open (" << asyncFilename << ") returns error");
+        uint8_t data[128];
+        uint32_t tsSec;
+        uint32_t tsUsec;
+        uint32_t inclLen;
+        uint32_t origLen;
+        uint32_t readLen;
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            uint32_t size = (i * 37) % 300;
+            f.Read(data, sizeof(data), tsSec, tsUsec, inclLen, origLen, readLen);
+            NS_TEST_ASSERT_MSG_EQ(f.Fail(), false, "Read must not fail, record " << i);
+            NS_TEST_EXPECT_MSG_EQ(tsSec, i, "Wrong timestamp, record " << i);
+            NS_TEST_EXPECT_MSG_EQ(tsUsec, i * 10, "Wrong timestamp, record " << i);
+            NS_TEST_EXPECT_MSG_EQ(origLen, size, "Wrong original length, record " << i);
+            NS_TEST_ASSERT_MSG_EQ(inclLen, std::min(size, 128U), "Wrong length, record " << i);
+            for (uint32_t j = 0; j < inclLen; ++j)
+            {
+                NS_TEST_ASSERT_MSG_EQ(uint32_t(data[j]),
+                                      j,
+                                      "Wrong data, record " << i << ", byte " << j);
+            }
+            // skip the records written from packets
+            f.Read(data, sizeof(data), tsSec, tsUsec, inclLen, origLen, readLen);
+            f.Read(data, sizeof(data), tsSec, tsUsec, inclLen, origLen, readLen);
+        }
+        f.Close();
+
+        remove(syncFilename.c_str());
+        remove(asyncFilename.c_str());
+        remove(otherFilename.c_str());
+    }
+    PcapFile::SetAsyncMaxChunks(PcapFile::ASYNC_MAX_CHUNKS_DEFAULT);
+
+    //
+    // The pending packets of a wrapper are written when the simulator is
+    // destroyed.
+    //
+    std::string filename = CreateTempDirFilename("async-wrapper.pcap");
+    Ptr<PcapFileWrapper> wrapper = CreateObject<PcapFileWrapper>();
+    wrapper->SetAttribute("AsyncWrite", BooleanValue(true));
+    wrapper->Open(filename, std::ios::out);
+    wrapper->Init(1);
+    wrapper->Write(Seconds(1), Create<Packet>(100));
+    Simulator::Destroy();
+    NS_TEST_EXPECT_MSG_EQ(CheckFileLength(filename, 24 + 16 + 100),
+                          true,
+                          "Packet must be written when the simulator is destroyed");
+    wrapper = nullptr;
+    remove(filename.c_str());
+
+    //
+    // The simulator holds no reference to the wrappers: their pending
+    // packets are written when they are destroyed or disposed of, before
+    // the simulator.
+    //
+    std::string destroyedFilename = CreateTempDirFilename("async-destroyed.pcap");
+    std::string disposedFilename = CreateTempDirFilename("async-disposed.pcap");
+    Ptr<PcapFileWrapper> destroyed = CreateObject<PcapFileWrapper>();
+    Ptr<PcapFileWrapper> disposed = CreateObject<PcapFileWrapper>();
+    for (auto [w, name] : {std::make_pair(destroyed, destroyedFilename),
+                           std::make_pair(disposed, disposedFilename)})
+    {
+        w->SetAttribute("AsyncWrite", BooleanValue(true));
+        w->Open(name, std::ios::out);
+        w->Init(1);
+        w->Write(Seconds(1), Create<Packet>(100));
+    }
+    destroyed = nullptr;
+    NS_TEST_EXPECT_MSG_EQ(CheckFileLength(destroyedFilename, 24 + 16 + 100),
+                          true,
+                          "Packet must be written when the wrapper is destroyed");
+    disposed->Dispose();
+    NS_TEST_EXPECT_MSG_EQ(CheckFileLength(disposedFilename, 24 + 16 + 100),
+                          true,
+                          "Packet must be written when the wrapper is disposed of");
+    Simulator::Destroy();
+    disposed = nullptr;
+    remove(destroyedFilename.c_str());
+    remove(disposedFilename.c_str());
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Test case to make sure that the pcapng files are written correctly.
+ */
+class PcapngTestCase : public TestCase
+{
+  public:
+    PcapngTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Read the blocks of a pcapng file.
+     *
+     * \param bytes The content of the file.
+     * \returns The type and the body of each block.
+     */
+    std::vector<std::pair<uint32_t, std::string>> ReadBlocks(const std::string& bytes);
+    /**
+     * \param filename The file name.
+     * \returns The content of the file.
+     */
+    std::string ReadFile(const std::string& filename);
+};
+
+PcapngTestCase::PcapngTestCase()
+    : TestCase("Check the pcapng files written by PcapngFile and PcapHelper")
+{
+}
+
+std::string
+PcapngTestCase::ReadFile(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+std::vector<std::pair<uint32_t, std::string>>
+PcapngTestCase::ReadBlocks(const std::string& bytes)
+{
+    std::vector<std::pair<uint32_t, std::string>> blocks;
+    uint32_t offset = 0;
+    while (offset + 12 <= bytes.size())
+    {
+        uint32_t type;
+        uint32_t length;
+        uint32_t trailingLength;
+        memcpy(&type, bytes.data() + offset, 4);
+        memcpy(&length, bytes.data() + offset + 4, 4);
+        if (length % 4 != 0 || length < 12 || offset + length > bytes.size())
+        {
+            NS_TEST_EXPECT_MSG_EQ(true, false, "Invalid length " << length << " at " << offset);
+            break;
+        }
+        memcpy(&trailingLength, bytes.data() + offset + length - 4, 4);
+        NS_TEST_EXPECT_MSG_EQ(trailingLength, length, "Block lengths must match");
+        blocks.emplace_back(type, bytes.substr(offset + 8, length - 12));
+        offset += length;
+    }
+    NS_TEST_EXPECT_MSG_EQ(offset, bytes.size(), "File must end with a block");
+    return blocks;
+}
+
+void
+PcapngTestCase::DoRun()
+{
+    std::vector<uint8_t> data(300);
+    for (uint32_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = i & 0xff;
+    }
+
+    std::string filename = CreateTempDirFilename("test.pcapng");
+    Ptr<PcapngFile> f = Create<PcapngFile>();
+    f->Open(filename);
+    NS_TEST_ASSERT_MSG_EQ(f->Fail(), false, "Open (" << filename << ") returns error");
+    uint32_t first = f->AddInterface(1, 100, "first");
+    uint32_t second = f->AddInterface(105, 1000, "second", true);
+    NS_TEST_EXPECT_MSG_EQ(first, 0, "Interfaces must be numbered from 0");
+    NS_TEST_EXPECT_MSG_EQ(second, 1, "Interfaces must be numbered from 0");
+    f->Write(first, 0x123456789ULL, data.data(), 150);
+    f->Write(second, 42, Create<Packet>(data.data(), 150));
+    f->Close();
+    NS_TEST_ASSERT_MSG_EQ(f->Fail(), false, "Write must not fail");
+
+    std::string bytes = ReadFile(filename);
+    auto blocks = ReadBlocks(bytes);
+    NS_TEST_ASSERT_MSG_EQ(blocks.size(), 5, "Expected one header, two interfaces, two packets");
+
+    uint32_t u32;
+    uint16_t u16;
+    NS_TEST_EXPECT_MSG_EQ(blocks[0].first, 0x0a0d0d0a, "Expected a section header block");
+    memcpy(&u32, blocks[0].second.data(), 4);
+    NS_TEST_EXPECT_MSG_EQ(u32, 0x1a2b3c4d, "Wrong byte-order magic");
+
+    NS_TEST_EXPECT_MSG_EQ(blocks[1].first, 1, "Expected an interface description block");
+    memcpy(&u16, blocks[1].second.data(), 2);
+    NS_TEST_EXPECT_MSG_EQ(u16, 1, "Wrong data link type");
+    memcpy(&u32, blocks[1].second.data() + 4, 4);
+    NS_TEST_EXPECT_MSG_EQ(u32, 100, "Wrong snap length");
+    memcpy(&u16, blocks[1].second.data() + 8, 2);
+    NS_TEST_EXPECT_MSG_EQ(u16, 2, "Expected the if_name option");
+    NS_TEST_EXPECT_MSG_EQ(blocks[1].second.substr(12, 5), "first", "Wrong interface name");
+    NS_TEST_EXPECT_MSG_EQ(blocks[2].first, 1, "Expected an interface description block");
+    memcpy(&u16, blocks[2].second.data(), 2);
+    NS_TEST_EXPECT_MSG_EQ(u16, 105, "Wrong data link type");
+    NS_TEST_EXPECT_MSG_EQ(blocks[2].second.substr(12, 6), "second", "Wrong interface name");
+    NS_TEST_EXPECT_MSG_EQ(blocks[2].second[24], 9, "Expected nanosecond timestamps");
+
+    uint32_t expectedTimestamps[2][2] = {{0x1, 0x23456789}, {0, 42}};
+    uint32_t expectedInclLens[2] = {100, 150};
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        const std::string& body = blocks[3 + i].second;
+        NS_TEST_EXPECT_MSG_EQ(blocks[3 + i].first, 6, "Expected an enhanced packet block");
+        memcpy(&u32, body.data(), 4);
+        NS_TEST_EXPECT_MSG_EQ(u32, i, "Wrong interface");
+        memcpy(&u32, body.data() + 4, 4);
+        NS_TEST_EXPECT_MSG_EQ(u32, expectedTimestamps[i][0], "Wrong timestamp (high)");
+        memcpy(&u32, body.data() + 8, 4);
+        NS_TEST_EXPECT_MSG_EQ(u32, expectedTimestamps[i][1], "Wrong timestamp (low)");
+        memcpy(&u32, body.data() + 12, 4);
+        NS_TEST_EXPECT_MSG_EQ(u32, expectedInclLens[i], "Wrong captured length");
+        memcpy(&u32, body.data() + 16, 4);
+        NS_TEST_EXPECT_MSG_EQ(u32, 150, "Wrong original length");
+        NS_TEST_EXPECT_MSG_EQ(memcmp(body.data() + 20, data.data(), expectedInclLens[i]),
+                              0,
+                              "Wrong packet data");
+    }
+
+#ifdef HAVE_ZLIB
+    //
+    // A compressed file decompresses to the uncompressed one.
+    //
+    std::string gzFilename = CreateTempDirFilename("test.pcapng.gz");
+    f = Create<PcapngFile>();
+    f->Open(gzFilename, true);
+    f->AddInterface(1, 100, "first");
+    f->AddInterface(105, 1000, "second", true);
+    f->Write(0, 0x123456789ULL, data.data(), 150);
+    f->Flush();
+    f->Write(1, 42, Create<Packet>(data.data(), 150));
+    f->Close();
+    NS_TEST_ASSERT_MSG_EQ(f->Fail(), false, "Compressed write must not fail");
+
+    gzFile gz = gzopen(gzFilename.c_str(), "rb");
+    NS_TEST_ASSERT_MSG_NE(gz, nullptr, "Unable to open " << gzFilename);
+    std::string gzBytes(bytes.size() + 1, 0);
+    int read = gzread(gz, gzBytes.data(), gzBytes.size());
+    gzclose(gz);
+    gzBytes.resize(std::max(read, 0));
+    NS_TEST_EXPECT_MSG_EQ((gzBytes == bytes), true, "Decompressed file differs");
+    NS_TEST_EXPECT_MSG_LT(ReadFile(gzFilename).size(), bytes.size(), "File not compressed");
+    remove(gzFilename.c_str());
+#endif
+    remove(filename.c_str());
+
+    //
+    // With pcapng enabled, PcapHelper adds interfaces to the pcapng file
+    // rather than creating pcap files.
+    //
+    PcapHelper helper;
+    PcapHelper::EnablePcapng(filename);
+    std::string pcapFilename = CreateTempDirFilename("node-0-1.pcap");
+    Ptr<PcapFileWrapper> wrapper =
+        helper.CreateFile(pcapFilename, std::ios::out, PcapHelper::DLT_EN10MB);
+    wrapper->Write(MicroSeconds(7), Create<Packet>(data.data(), 60));
+    Simulator::Destroy();
+    NS_TEST_EXPECT_MSG_EQ(std::ifstream(pcapFilename).good(), false, "No pcap file expected");
+
+    blocks = ReadBlocks(ReadFile(filename));
+    NS_TEST_ASSERT_MSG_EQ(blocks.size(), 3, "Expected one header, one interface, one packet");
+    NS_TEST_EXPECT_MSG_EQ(blocks[1].second.substr(12, 8), "node-0-1", "Wrong interface name");
+    memcpy(&u32, blocks[2].second.data() + 8, 4);
+    NS_TEST_EXPECT_MSG_EQ(u32, 7, "Wrong timestamp");
+    memcpy(&u32, blocks[2].second.data() + 12, 4);
+    NS_TEST_EXPECT_MSG_EQ(u32, 60, "Wrong captured length");
+    remove(filename.c_str());
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -1398,6 +1784,8 @@ PcapFileTestSuite::PcapFileTestSuite()
     AddTestCase(new RecordHeaderTestCase, TestCase::QUICK);
     AddTestCase(new ReadFileTestCase, TestCase::QUICK);
     AddTestCase(new DiffTestCase, TestCase::QUICK);
+    AddTestCase(new AsyncWriteTestCase, TestCase::QUICK);
+    AddTestCase(new PcapngTestCase, TestCase::QUICK);
 }
 
 static PcapFileTestSuite pcapFileTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "binary-trace-writer.h"
+
+#include "ns3/log.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("BinaryTraceWriter");
+
+/// Identifies the binary traces
+static const char MAGIC[8] = {'n', 's', '3', 'b', 't', 'r', 'c', 'e'};
+
+BinaryTraceWriter::BinaryTraceWriter(std::ostream* os)
+    : m_os(os)
+{
+    NS_LOG_FUNCTION(this << os);
+    uint8_t header[HEADER_SIZE];
+    memcpy(header, MAGIC, 8);
+    memcpy(header + 8, &VERSION, 4);
+    memcpy(header + 12, &RECORD_SIZE, 4);
+    m_os->write(reinterpret_cast<const char*>(header), HEADER_SIZE);
+}
+
+void
+BinaryTraceWriter::WriteRecord(EventKind kind, const ContextInfo& context, Ptr<const Packet> p)
+{
+    int64_t time = Simulator::Now().GetNanoSeconds();
+    uint64_t uid = p->GetUid();
+    uint32_t size = p->GetSize();
+    uint8_t reserved = 0;
+
+    uint8_t record[RECORD_SIZE];
+    memcpy(record, &time, 8);
+    memcpy(record + 8, &uid, 8);
+    memcpy(record + 16, &size, 4);
+    memcpy(record + 20, &context.index, 4);
+    memcpy(record + 24, &context.node, 4);
+    memcpy(record + 28, &context.device, 2);
+    memcpy(record + 30, &kind, 1);
+    memcpy(record + 31, &reserved, 1);
+    m_os->write(reinterpret_cast<const char*>(record), RECORD_SIZE);
+}
+
+void
+BinaryTraceWriter::Write(EventKind kind, Ptr<const Packet> p)
+{
+    NS_LOG_FUNCTION(this << kind << p);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    WriteRecord(kind, {NO_CONTEXT, NO_NODE, NO_DEVICE}, p);
+}
+
+void
+BinaryTraceWriter::Write(EventKind kind, const std::string& context, Ptr<const Packet> p)
+{
+    NS_LOG_FUNCTION(this << kind << context << p);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    auto it = m_contexts.find(context);
+    if (it == m_contexts.end())
+    {
+        ContextInfo info{static_cast<uint32_t>(m_contexts.size()), NO_NODE, NO_DEVICE};
+        unsigned node;
+        unsigned device;
+        if (sscanf(context.c_str(), "/NodeList/%u/DeviceList/%u", &node, &device) == 2 &&
+            device < NO_DEVICE)
+        {
+            info.node = node;
+            info.device = device;
+        }
+        it = m_contexts.emplace(context, info).first;
+
+        //
+        // Define the context before the first record which refers to it.
+        //
+        uint8_t record[RECORD_SIZE] = {};
+        auto length = static_cast<uint32_t>(context.size());
+        uint8_t contextKind = CONTEXT;
+        memcpy(record + 16, &length, 4);
+        memcpy(record + 20, &info.index, 4);
+        memcpy(record + 24, &info.node, 4);
+        memcpy(record + 28, &info.device, 2);
+        memcpy(record + 30, &contextKind, 1);
+        m_os->write(reinterpret_cast<const char*>(record), RECORD_SIZE);
+        m_os->write(context.data(), length);
+    }
+    WriteRecord(kind, it->second, p);
+}
+
+bool
+BinaryTraceWriter::ConvertToAscii(std::istream& binary, std::ostream& ascii)
+{
+    NS_LOG_FUNCTION(&binary << &ascii);
+    uint8_t header[HEADER_SIZE];
+    if (!binary.read(reinterpret_cast<char*>(header), HEADER_SIZE))
+    {
+        return false;
+    }
+    uint32_t version;
+    uint32_t recordSize;
+    memcpy(&version, header + 8, 4);
+    memcpy(&recordSize, header + 12, 4);
+    if (memcmp(header, MAGIC, 8) != 0 || version != VERSION || recordSize != RECORD_SIZE)
+    {
+        return false;
+    }
+
+    std::vector<std::string> contexts;
+    uint8_t record[RECORD_SIZE];
+    while (binary.read(reinterpret_cast<char*>(record), RECORD_SIZE))
+    {
+        int64_t time;
+        uint64_t uid;
+        uint32_t size;
+        uint32_t context;
+        uint8_t kind;
+        memcpy(&time, record, 8);
+        memcpy(&uid, record + 8, 8);
+        memcpy(&size, record + 16, 4);
+        memcpy(&context, record + 20, 4);
+        memcpy(&kind, record + 30, 1);
+
+        if (kind == CONTEXT)
+        {
+            if (context != contexts.size())
+            {
+                return false;
+            }
+            std::string name(size, '\0');
+            if (!binary.read(name.data(), size))
+            {
+                return false;
+            }
+            contexts.push_back(std::move(name));
+            continue;
+        }
+
+        ascii << kind << " " << NanoSeconds(time).GetSeconds() << " ";
+        if (context != NO_CONTEXT)
+        {
+            if (context >= contexts.size())
+            {
+                return false;
+            }
+            ascii << contexts[context] << " ";
+        }
+        ascii << "uid=" << uid << " size=" << size << "\n";
+    }
+    // A trace ends with a complete record
+    return binary.gcount() == 0;
+}
+
+} // namespace ns3
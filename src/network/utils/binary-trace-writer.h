@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BINARY_TRACE_WRITER_H
+#define BINARY_TRACE_WRITER_H
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+
+#include <istream>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+#ifdef NS3_MTP
+#include <mutex>
+#endif
+
+namespace ns3
+{
+
+class Packet;
+
+/**
+ * \brief Write the events of the default ascii trace sinks as binary records
+ *
+ * Formatting each traced packet with Packet::Print dominates the cost of
+ * ascii tracing.  A BinaryTraceWriter instead writes a fixed-size record
+ * per event, with the time, the node, the device, the kind of event, the
+ * uid and the size of the packet.  The trace contexts are interned: a
+ * context is written once, the first time it is traced, and the records
+ * refer to it by its index.  The node and the device are parsed from the
+ * context, when it starts with "/NodeList/<node>/DeviceList/<device>/".
+ *
+ * ConvertToAscii converts a binary trace to the text written by the
+ * default ascii trace sinks, except that the contents of the packets,
+ * which are not recorded, are replaced by their uid and size.
+ *
+ * The file starts with a header of 16 bytes: the magic "ns3btrce", the
+ * version of the format and the size of the records, which are written
+ * in the byte order of the writing system:
+ *
+ * \verbatim
+   offset  size  field
+        0     8  time, in nanoseconds
+        8     8  uid of the packet
+       16     4  size of the packet, or length of the context
+       20     4  index of the context, or NO_CONTEXT
+       24     4  node, or NO_NODE
+       28     2  device, or NO_DEVICE
+       30     1  kind of event, or CONTEXT
+       31     1  reserved
+   \endverbatim
+ *
+ * A CONTEXT record, which defines a context, is followed by the characters
+ * of the context.
+ */
+class BinaryTraceWriter : public SimpleRefCount<BinaryTraceWriter>
+{
+  public:
+    /// Kinds of events, the characters which start the lines of the ascii traces
+    enum EventKind : uint8_t
+    {
+        ENQUEUE = '+', //!< A packet is enqueued in the transmit queue of a device
+        DEQUEUE = '-', //!< A packet is dequeued from the transmit queue of a device
+        DROP = 'd',    //!< A packet is dropped
+        RECEIVE = 'r', //!< A packet is received by a device
+        CONTEXT = 's', //!< Definition of a context, not an event
+    };
+
+    static const uint32_t NO_CONTEXT = 0xffffffff; //!< The event is traced without context
+    static const uint32_t NO_NODE = 0xffffffff;    //!< The node is unknown
+    static const uint16_t NO_DEVICE = 0xffff;      //!< The device is unknown
+    static const uint32_t VERSION = 1;             //!< Version of the format
+    static const uint32_t HEADER_SIZE = 16;        //!< Size of the file header
+    static const uint32_t RECORD_SIZE = 32;        //!< Size of a record
+
+    /**
+     * \brief Start a binary trace, by writing its header.
+     *
+     * The stream must be opened in binary mode, and outlive the writer.
+     *
+     * \param os The output stream.
+     */
+    BinaryTraceWriter(std::ostream* os);
+
+    /**
+     * \brief Write an event traced without context.
+     *
+     * \param kind The kind of event.
+     * \param p The packet.
+     */
+    void Write(EventKind kind, Ptr<const Packet> p);
+    /**
+     * \brief Write an event traced with a context.
+     *
+     * \param kind The kind of event.
+     * \param context The context of the trace source.
+     * \param p The packet.
+     */
+    void Write(EventKind kind, const std::string& context, Ptr<const Packet> p);
+
+    /**
+     * \brief Convert a binary trace to the text of the ascii traces.
+     *
+     * \param binary The binary trace.
+     * \param ascii The stream to which the text is written.
+     * \returns false if the binary trace is invalid or truncated.
+     */
+    static bool ConvertToAscii(std::istream& binary, std::ostream& ascii);
+
+  private:
+    /// The index, the node and the device of an interned context
+    struct ContextInfo
+    {
+        uint32_t index;  //!< The index of the context
+        uint32_t node;   //!< The node, or NO_NODE
+        uint16_t device; //!< The device, or NO_DEVICE
+    };
+
+    /**
+     * \brief Write a record.
+     *
+     * \param kind The kind of event.
+     * \param context The context.
+     * \param p The packet.
+     */
+    void WriteRecord(EventKind kind, const ContextInfo& context, Ptr<const Packet> p);
+
+    std::ostream* m_os;                                      //!< The output stream
+    std::unordered_map<std::string, ContextInfo> m_contexts; //!< The interned contexts
+#ifdef NS3_MTP
+    std::mutex m_mutex; //!< Serializes the writes of the devices of different threads
+#endif
+};
+
+} // namespace ns3
+
+#endif /* BINARY_TRACE_WRITER_H */
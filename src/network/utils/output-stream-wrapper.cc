@@ -29,7 +29,8 @@ namespace ns3
 NS_LOG_COMPONENT_DEFINE("OutputStreamWrapper");
 
 OutputStreamWrapper::OutputStreamWrapper(std::string filename, std::ios::openmode filemode)
-    : m_destroyable(true)
+    : m_destroyable(true),
+      m_packetSampling(false)
 {
     NS_LOG_FUNCTION(this << filename << filemode);
     std::ofstream* os = new std::ofstream();
@@ -43,7 +44,8 @@ OutputStreamWrapper::OutputStreamWrapper(std::string filename, std::ios::openmod
 
 OutputStreamWrapper::OutputStreamWrapper(std::ostream* os)
     : m_ostream(os),
-      m_destroyable(false)
+      m_destroyable(false),
+      m_packetSampling(false)
 {
     NS_LOG_FUNCTION(this << os);
     FatalImpl::RegisterStream(m_ostream);
@@ -68,4 +70,30 @@ OutputStreamWrapper::GetStream()
     return m_ostream;
 }
 
+void
+OutputStreamWrapper::SetBinaryTrace(Ptr<BinaryTraceWriter> writer)
+{
+    NS_LOG_FUNCTION(this << writer);
+    m_binary = writer;
+}
+
+Ptr<BinaryTraceWriter>
+OutputStreamWrapper::GetBinaryTrace() const
+{
+    return m_binary;
+}
+
+void
+OutputStreamWrapper::SetPacketSampling(bool sampling)
+{
+    NS_LOG_FUNCTION(this << sampling);
+    m_packetSampling = sampling;
+}
+
+bool
+OutputStreamWrapper::IsPacketSampling() const
+{
+    return m_packetSampling;
+}
+
 } // namespace ns3
@@ -18,6 +18,8 @@
 #ifndef OUTPUT_STREAM_WRAPPER_H
 #define OUTPUT_STREAM_WRAPPER_H
 
+#include "binary-trace-writer.h"
+
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -93,9 +95,39 @@ class OutputStreamWrapper : public SimpleRefCount<OutputStreamWrapper>
      */
     std::ostream* GetStream();
 
+    /**
+     * Make the default ascii trace sinks write binary records to the
+     * stream, rather than text.
+     *
+     * \param writer The writer of the binary records to the stream.
+     */
+    void SetBinaryTrace(Ptr<BinaryTraceWriter> writer);
+
+    /**
+     * \returns The writer of the binary records to the stream, or nullptr
+     * if the stream holds text.
+     */
+    Ptr<BinaryTraceWriter> GetBinaryTrace() const;
+
+    /**
+     * Make the default ascii trace sinks write only the packets sampled
+     * by the PacketSampler to the stream.
+     *
+     * \param sampling Whether to write only the sampled packets.
+     */
+    void SetPacketSampling(bool sampling);
+
+    /**
+     * \returns true if only the packets sampled by the PacketSampler are
+     * written to the stream.
+     */
+    bool IsPacketSampling() const;
+
   private:
-    std::ostream* m_ostream; //!< The output stream
-    bool m_destroyable;      //!< Can be destroyed
+    std::ostream* m_ostream;         //!< The output stream
+    bool m_destroyable;              //!< Can be destroyed
+    Ptr<BinaryTraceWriter> m_binary; //!< The writer of the binary records, if any
+    bool m_packetSampling;           //!< Write only the sampled packets
 };
 
 } // namespace ns3
@@ -22,10 +22,12 @@
 
 #include "ns3/packet-probe.h"
 
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/object.h"
+#include "ns3/packet-sampler.h"
 #include "ns3/trace-source-accessor.h"
 
 namespace ns3
@@ -42,6 +44,12 @@ PacketProbe::GetTypeId()
                             .SetParent<Probe>()
                             .SetGroupName("Network")
                             .AddConstructor<PacketProbe>()
+                            .AddAttribute("PacketSampling",
+                                          "Whether to trace only the packets sampled by the "
+                                          "PacketSampler.",
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(&PacketProbe::m_packetSampling),
+                                          MakeBooleanChecker())
                             .AddTraceSource("Output",
                                             "The packet that serve as the output for this probe",
                                             MakeTraceSourceAccessor(&PacketProbe::m_output),
@@ -108,7 +116,7 @@ void
 PacketProbe::TraceSink(Ptr<const Packet> packet)
 {
     NS_LOG_FUNCTION(this << packet);
-    if (IsEnabled())
+    if (IsEnabled() && (!m_packetSampling || PacketSampler::IsSampled(packet)))
     {
         m_packet = packet;
         m_output(packet);
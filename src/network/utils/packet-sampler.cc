@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "packet-sampler.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PacketSampler");
+
+/// The number of values of the hashes of the uids
+static const uint64_t HASH_VALUES = 1ULL << 53;
+
+double PacketSampler::m_rate = 1;
+uint64_t PacketSampler::m_threshold = HASH_VALUES;
+
+void
+PacketSampler::SetRate(double rate)
+{
+    NS_LOG_FUNCTION(rate);
+    NS_ABORT_MSG_IF(rate < 0 || rate > 1, "Invalid sampling rate " << rate);
+    m_rate = rate;
+    // The hashes have 53 bits, which a double holds exactly
+    m_threshold = static_cast<uint64_t>(rate * HASH_VALUES);
+}
+
+double
+PacketSampler::GetRate()
+{
+    return m_rate;
+}
+
+} // namespace ns3
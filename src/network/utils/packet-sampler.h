@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PACKET_SAMPLER_H
+#define PACKET_SAMPLER_H
+
+#include "ns3/packet.h"
+#include "ns3/ptr.h"
+
+#include <stdint.h>
+
+namespace ns3
+{
+
+/**
+ * \brief Deterministic sampling of the packets, by their uid
+ *
+ * A packet is sampled when a hash of its uid falls below a threshold set
+ * by the sampling rate.  The uid of a packet does not change when headers
+ * are added or removed, nor when it is copied, so that all the layers
+ * sample the same packets: a sampled packet is traced from end to end,
+ * and the tracing of the other packets is skipped at the cost of a hash.
+ *
+ * The sampling is opted into by each consumer of the traces, with the
+ * PacketSampling attribute of the PcapFileWrapper, FlowMonitor and packet
+ * probes, and OutputStreamWrapper::SetPacketSampling for the ascii traces.
+ * All of them share the rate set by SetRate, which samples all the packets
+ * by default.
+ */
+class PacketSampler
+{
+  public:
+    /**
+     * \param rate The fraction of the packets sampled, between 0 and 1.
+     */
+    static void SetRate(double rate);
+    /**
+     * \returns The fraction of the packets sampled.
+     */
+    static double GetRate();
+
+    /**
+     * \param uid The uid of a packet.
+     * \returns true if the packet is sampled.
+     */
+    static inline bool IsSampled(uint64_t uid);
+    /**
+     * \param p A packet.
+     * \returns true if the packet is sampled.
+     */
+    static inline bool IsSampled(Ptr<const Packet> p);
+
+  private:
+    /**
+     * \param uid The uid of a packet.
+     * \returns A 53-bit hash of the uid.
+     */
+    static inline uint64_t Hash(uint64_t uid);
+
+    static double m_rate;        //!< The fraction of the packets sampled
+    static uint64_t m_threshold; //!< The hashes of the sampled uids are below the threshold
+};
+
+/*************************************************
+ *  Inline implementations
+ ************************************************/
+
+uint64_t
+PacketSampler::Hash(uint64_t uid)
+{
+    // The finalizer of SplitMix64, which spreads consecutive uids
+    uint64_t z = uid + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return (z ^ (z >> 31)) >> 11;
+}
+
+bool
+PacketSampler::IsSampled(uint64_t uid)
+{
+    return Hash(uid) < m_threshold;
+}
+
+bool
+PacketSampler::IsSampled(Ptr<const Packet> p)
+{
+    return IsSampled(p->GetUid());
+}
+
+} // namespace ns3
+
+#endif /* PACKET_SAMPLER_H */
@@ -19,10 +19,16 @@
 
 #include "ns3/boolean.h"
 #include "ns3/buffer.h"
+#include "ns3/global-value.h"
 #include "ns3/header.h"
 #include "ns3/log.h"
+#include "ns3/packet-sampler.h"
+#include "ns3/simulator.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace ns3
 {
 
@@ -30,6 +36,47 @@ NS_LOG_COMPONENT_DEFINE("PcapFileWrapper");
 
 NS_OBJECT_ENSURE_REGISTERED(PcapFileWrapper);
 
+/**
+ * \ingroup network
+ * \anchor GlobalValuePcapAsyncMaxChunks
+ * The maximum number of chunks waiting to be written by the background
+ * thread, for all the pcap files with the AsyncWrite attribute.
+ */
+static GlobalValue g_pcapAsyncMaxChunks(
+    "PcapAsyncMaxChunks",
+    "Maximum number of chunks waiting to be written by the background thread, for all "
+    "the PcapFileWrappers with the AsyncWrite attribute. The simulation blocks when it "
+    "is reached.",
+    UintegerValue(PcapFile::ASYNC_MAX_CHUNKS_DEFAULT),
+    MakeUintegerChecker<uint32_t>(1));
+
+namespace
+{
+
+/**
+ * The wrappers in asynchronous mode, which are not closed yet.
+ *
+ * They are only registered and unregistered while the simulation is
+ * configured or destroyed, from the main thread.
+ */
+std::vector<PcapFileWrapper*> g_asyncWrappers;
+
+/** Whether FlushAsyncWrappers is scheduled for the destruction of the simulator. */
+bool g_asyncFlushScheduled = false;
+
+/** Write the pending packets of the wrappers in asynchronous mode. */
+void
+FlushAsyncWrappers()
+{
+    g_asyncFlushScheduled = false;
+    for (PcapFileWrapper* wrapper : g_asyncWrappers)
+    {
+        wrapper->Flush();
+    }
+}
+
+} // namespace
+
 TypeId
 PcapFileWrapper::GetTypeId()
 {
@@ -48,11 +95,30 @@ PcapFileWrapper::GetTypeId()
                           "microseconds(default).",
                           BooleanValue(false),
                           MakeBooleanAccessor(&PcapFileWrapper::m_nanosecMode),
+                          MakeBooleanChecker())
+            .AddAttribute("AsyncWrite",
+                          "Whether the packets are written to the file by a background thread.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&PcapFileWrapper::m_asyncWrite),
+                          MakeBooleanChecker())
+            .AddAttribute("AsyncChunkSize",
+                          "Size in bytes of the chunks of packets handed to the background "
+                          "thread, when AsyncWrite is true. A chunk is only allocated when "
+                          "a packet is written.",
+                          UintegerValue(1024 * 1024),
+                          MakeUintegerAccessor(&PcapFileWrapper::m_asyncChunkSize),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("PacketSampling",
+                          "Whether to write only the packets sampled by the PacketSampler. "
+                          "The packets written as a buffer are always written.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&PcapFileWrapper::m_packetSampling),
                           MakeBooleanChecker());
     return tid;
 }
 
 PcapFileWrapper::PcapFileWrapper()
+    : m_pcapngId(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -67,6 +133,10 @@ bool
 PcapFileWrapper::Fail() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_pcapng)
+    {
+        return m_pcapng->Fail();
+    }
     return m_file.Fail();
 }
 
@@ -84,10 +154,20 @@ PcapFileWrapper::Clear()
     m_file.Clear();
 }
 
+void
+PcapFileWrapper::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+    Object::DoDispose();
+}
+
 void
 PcapFileWrapper::Close()
 {
     NS_LOG_FUNCTION(this);
+    g_asyncWrappers.erase(std::remove(g_asyncWrappers.begin(), g_asyncWrappers.end(), this),
+                          g_asyncWrappers.end());
     m_file.Close();
 }
 
@@ -115,13 +195,70 @@ PcapFileWrapper::Init(uint32_t dataLinkType, uint32_t snapLen, int32_t tzCorrect
     {
         m_file.Init(dataLinkType, m_snapLen, tzCorrection, false, m_nanosecMode);
     }
+    if (m_asyncWrite)
+    {
+        UintegerValue maxChunks;
+        g_pcapAsyncMaxChunks.GetValue(maxChunks);
+        PcapFile::SetAsyncMaxChunks(maxChunks.Get());
+        m_file.EnableAsync(m_asyncChunkSize);
+        // Write the pending packets when the simulation ends, even if
+        // this wrapper outlives it. The simulator holds no reference to
+        // the wrappers, which leave the list when they are closed.
+        g_asyncWrappers.push_back(this);
+        if (!g_asyncFlushScheduled)
+        {
+            Simulator::ScheduleDestroy(&FlushAsyncWrappers);
+            g_asyncFlushScheduled = true;
+        }
+    }
+}
+
+void
+PcapFileWrapper::InitPcapng(Ptr<PcapngFile> file,
+                            uint32_t dataLinkType,
+                            const std::string& name,
+                            uint32_t snapLen)
+{
+    NS_LOG_FUNCTION(this << file << dataLinkType << name << snapLen);
+    if (snapLen == std::numeric_limits<uint32_t>::max())
+    {
+        snapLen = m_snapLen;
+    }
+    m_pcapng = file;
+    m_pcapngId = file->AddInterface(dataLinkType, snapLen, name, m_nanosecMode);
+}
+
+uint64_t
+PcapFileWrapper::GetPcapngTimestamp(Time t) const
+{
+    return m_nanosecMode ? t.GetNanoSeconds() : t.GetMicroSeconds();
+}
+
+void
+PcapFileWrapper::Flush()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_pcapng)
+    {
+        m_pcapng->Flush();
+        return;
+    }
+    m_file.Flush();
 }
 
 void
 PcapFileWrapper::Write(Time t, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << t << p);
-    if (m_file.IsNanoSecMode())
+    if (m_packetSampling && !PacketSampler::IsSampled(p))
+    {
+        return;
+    }
+    if (m_pcapng)
+    {
+        m_pcapng->Write(m_pcapngId, GetPcapngTimestamp(t), p);
+    }
+    else if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
         uint64_t s = current / 1000000000;
@@ -141,7 +278,15 @@ void
 PcapFileWrapper::Write(Time t, const Header& header, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << t << &header << p);
-    if (m_file.IsNanoSecMode())
+    if (m_packetSampling && !PacketSampler::IsSampled(p))
+    {
+        return;
+    }
+    if (m_pcapng)
+    {
+        m_pcapng->Write(m_pcapngId, GetPcapngTimestamp(t), header, p);
+    }
+    else if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
         uint64_t s = current / 1000000000;
@@ -161,7 +306,11 @@ void
 PcapFileWrapper::Write(Time t, const uint8_t* buffer, uint32_t length)
 {
     NS_LOG_FUNCTION(this << t << &buffer << length);
-    if (m_file.IsNanoSecMode())
+    if (m_pcapng)
+    {
+        m_pcapng->Write(m_pcapngId, GetPcapngTimestamp(t), buffer, length);
+    }
+    else if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
         uint64_t s = current / 1000000000;
@@ -19,6 +19,7 @@
 #define PCAP_FILE_WRAPPER_H
 
 #include "pcap-file.h"
+#include "pcapng-file.h"
 
 #include "ns3/nstime.h"
 #include "ns3/object.h"
@@ -79,7 +80,8 @@ class PcapFileWrapper : public Object
     void Open(const std::string& filename, std::ios::openmode mode);
 
     /**
-     * Close the underlying pcap file.
+     * Close the underlying pcap file, after writing its pending packets in
+     * asynchronous mode.
      */
     void Close();
 
@@ -103,6 +105,11 @@ class PcapFileWrapper : public Object
      * time zone from UTC/GMT.  For example, Pacific Standard Time in the US is
      * GMT-8, so one would enter -8 for that correction.  Defaults to 0 (UTC).
      *
+     * If the AsyncWrite attribute is true, the packets are then written
+     * to the file by a background thread, see PcapFile::EnableAsync, and
+     * the pending packets are written when the simulator is destroyed, if
+     * this wrapper was not closed, disposed of or destroyed before.
+     *
      * \warning Calling this method on an existing file will result in the loss
      * any existing data.
      */
@@ -110,6 +117,28 @@ class PcapFileWrapper : public Object
               uint32_t snapLen = std::numeric_limits<uint32_t>::max(),
               int32_t tzCorrection = PcapFile::ZONE_DEFAULT);
 
+    /**
+     * \brief Write the packets to an interface of a pcapng file, rather
+     * than to the pcap file of this wrapper, which must not be opened.
+     *
+     * Only the Write, Flush and Fail methods can be used afterwards.
+     *
+     * \param file The pcapng file.
+     * \param dataLinkType A data link type as defined in the pcap library.
+     * \param name The name of the interface.
+     * \param snapLen An optional maximum size for packets written to the
+     * file.  Defaults to the CaptureSize attribute.
+     */
+    void InitPcapng(Ptr<PcapngFile> file,
+                    uint32_t dataLinkType,
+                    const std::string& name,
+                    uint32_t snapLen = std::numeric_limits<uint32_t>::max());
+
+    /**
+     * \brief Write the packets written so far to the underlying file.
+     */
+    void Flush();
+
     /**
      * \brief Write the next packet to file
      *
@@ -221,10 +250,26 @@ class PcapFileWrapper : public Object
      */
     uint32_t GetDataLinkType();
 
+  protected:
+    void DoDispose() override;
+
   private:
-    PcapFile m_file;    //!< Pcap file
-    uint32_t m_snapLen; //!< max length of saved packets
-    bool m_nanosecMode; //!< Timestamps in nanosecond mode
+    /**
+     * \brief Get the timestamp of a packet written to the pcapng file.
+     *
+     * \param t Packet timestamp as ns3::Time.
+     * \returns the timestamp, in the resolution of the interface.
+     */
+    uint64_t GetPcapngTimestamp(Time t) const;
+
+    PcapFile m_file;           //!< Pcap file
+    uint32_t m_snapLen;        //!< max length of saved packets
+    bool m_nanosecMode;        //!< Timestamps in nanosecond mode
+    bool m_asyncWrite;         //!< Write through a background thread
+    uint32_t m_asyncChunkSize; //!< size of the chunks of the background thread
+    bool m_packetSampling;     //!< Write only the sampled packets
+    Ptr<PcapngFile> m_pcapng;  //!< pcapng file, if written instead of m_file
+    uint32_t m_pcapngId;       //!< interface identifier in m_pcapng
 };
 
 } // namespace ns3
@@ -28,8 +28,13 @@
 #include "ns3/log.h"
 #include "ns3/packet.h"
 
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 //
 // This file is used as part of the ns-3 test framework, so please refrain from
@@ -51,6 +56,234 @@ const uint32_t NS_SWAPPED_MAGIC = 0x4d3cb2a1; /**< Looks this way if byte swappi
 const uint16_t VERSION_MAJOR = 2; /**< Major version of supported pcap file format */
 const uint16_t VERSION_MINOR = 4; /**< Minor version of supported pcap file format */
 
+/**
+ * The thread which writes the chunks of records of all the files in
+ * asynchronous mode, in the order in which they are queued.
+ *
+ * It runs while at least one file is in asynchronous mode. The number of
+ * chunks waiting to be written is bounded for all the files together, and
+ * the written chunks are kept as spares for the next chunks of any file.
+ */
+struct PcapFile::AsyncThread
+{
+    /** A chunk of records of a file. */
+    struct Chunk
+    {
+        AsyncWriter* writer;       //!< The writer of the file.
+        std::vector<uint8_t> data; //!< The buffer, of which the first \c used bytes are valid.
+        std::size_t used;          //!< The number of valid bytes.
+    };
+
+    /**
+     * Get the thread.
+     *
+     * It is never destroyed, as the files may be closed by static
+     * destructors.
+     *
+     * \returns The thread.
+     */
+    static AsyncThread& Get()
+    {
+        static AsyncThread* thread = new AsyncThread;
+        return *thread;
+    }
+
+    /** Start the thread, if this is the first file in asynchronous mode. */
+    void Register()
+    {
+        std::unique_lock control{controlMutex};
+        if (files++ == 0)
+        {
+            stop = false;
+            thread = std::thread(&AsyncThread::Run, this);
+        }
+    }
+
+    /** Stop the thread, if this was the last file in asynchronous mode. */
+    void Unregister()
+    {
+        std::unique_lock control{controlMutex};
+        if (--files == 0)
+        {
+            {
+                std::unique_lock lock{mutex};
+                stop = true;
+            }
+            queued.notify_one();
+            thread.join();
+        }
+    }
+
+    /**
+     * Get a buffer for the next chunk of a file.
+     *
+     * \returns A spare buffer, or an empty one if there is none.
+     */
+    std::vector<uint8_t> GetSpare()
+    {
+        std::unique_lock lock{mutex};
+        if (spares.empty())
+        {
+            return {};
+        }
+        std::vector<uint8_t> data = std::move(spares.back());
+        spares.pop_back();
+        return data;
+    }
+
+    /**
+     * Queue a chunk, waiting for room in the queue if needed.
+     *
+     * \param [in] chunk The chunk.
+     */
+    void Queue(Chunk chunk);
+
+    /** The body of the thread. */
+    void Run();
+
+    std::mutex controlMutex; //!< Serializes the starts and stops of the thread.
+    std::size_t files{0};    //!< The number of files in asynchronous mode.
+    std::thread thread;      //!< The thread.
+
+    std::mutex mutex;                         //!< Protects the fields below, and the writers'.
+    std::condition_variable queued;           //!< Signals a queued chunk, or a stop request.
+    std::condition_variable written;          //!< Signals a dequeued or written chunk.
+    std::deque<Chunk> queue;                  //!< The chunks waiting to be written.
+    std::vector<std::vector<uint8_t>> spares; //!< The buffers of the written chunks.
+    std::size_t maxChunks{ASYNC_MAX_CHUNKS_DEFAULT}; //!< The maximum number of queued chunks.
+    bool stop{false};                                //!< Whether the thread must stop.
+};
+
+/**
+ * Chunks of records of a file written by the AsyncThread.
+ *
+ * The simulation thread fills the current chunk, then queues it for the
+ * writer thread. The current chunk is only taken when a record is written.
+ */
+struct PcapFile::AsyncWriter
+{
+    /**
+     * Register the file with the writer thread.
+     *
+     * \param [in] f The file stream.
+     * \param [in] size The size of the chunks.
+     */
+    AsyncWriter(std::fstream& f, uint32_t size)
+        : file(f),
+          chunkSize(size),
+          used(0),
+          pending(0),
+          failed(false)
+    {
+        AsyncThread::Get().Register();
+    }
+
+    /** Write the pending records, then unregister the file. */
+    ~AsyncWriter()
+    {
+        Flush();
+        AsyncThread::Get().Unregister();
+    }
+
+    /**
+     * Reserve space for some bytes at the end of the current chunk.
+     *
+     * The bytes of a record may be split between two consecutive chunks.
+     *
+     * \param [in] size The number of bytes.
+     * \returns The space, to be filled before the next call.
+     */
+    uint8_t* Append(uint32_t size)
+    {
+        if (used + size > current.size())
+        {
+            if (used > 0)
+            {
+                Queue();
+            }
+            if (current.empty())
+            {
+                current = AsyncThread::Get().GetSpare();
+            }
+            current.resize(std::max<std::size_t>(size, chunkSize));
+        }
+        uint8_t* p = current.data() + used;
+        used += size;
+        return p;
+    }
+
+    /** Queue the current chunk. */
+    void Queue()
+    {
+        AsyncThread::Get().Queue({this, std::move(current), used});
+        current.clear();
+        used = 0;
+    }
+
+    /** Wait until all the records are written, and flush the file stream. */
+    void Flush()
+    {
+        if (used > 0)
+        {
+            Queue();
+        }
+        AsyncThread& thread = AsyncThread::Get();
+        std::unique_lock lock{thread.mutex};
+        thread.written.wait(lock, [this] { return pending == 0; });
+        file.flush();
+        failed |= file.fail();
+    }
+
+    std::fstream& file;           //!< The file stream, written by the writer thread.
+    std::size_t chunkSize;        //!< The size of the chunks.
+    std::vector<uint8_t> current; //!< The chunk filled by the simulation thread.
+    std::size_t used;             //!< The number of valid bytes of the current chunk.
+
+    // protected by the mutex of the AsyncThread
+    std::size_t pending; //!< The number of queued chunks, including the one being written.
+    bool failed;         //!< Whether a write failed.
+};
+
+void
+PcapFile::AsyncThread::Queue(Chunk chunk)
+{
+    std::unique_lock lock{mutex};
+    written.wait(lock, [this] { return queue.size() < maxChunks; });
+    chunk.writer->pending++;
+    queue.push_back(std::move(chunk));
+    queued.notify_one();
+}
+
+void
+PcapFile::AsyncThread::Run()
+{
+    std::unique_lock lock{mutex};
+    while (true)
+    {
+        queued.wait(lock, [this] { return stop || !queue.empty(); });
+        if (queue.empty())
+        {
+            return;
+        }
+        Chunk chunk = std::move(queue.front());
+        queue.pop_front();
+        written.notify_all();
+        lock.unlock();
+        // the file is only written by this thread until its writer sees no
+        // pending chunk
+        chunk.writer->file.write((const char*)chunk.data.data(), chunk.used);
+        bool fail = chunk.writer->file.fail();
+        lock.lock();
+        chunk.writer->failed |= fail;
+        chunk.writer->pending--;
+        if (spares.size() < maxChunks)
+        {
+            spares.push_back(std::move(chunk.data));
+        }
+        written.notify_all();
+    }
+}
+
 PcapFile::PcapFile()
     : m_file(),
       m_swapMode(false),
@@ -63,14 +296,19 @@ PcapFile::PcapFile()
 PcapFile::~PcapFile()
 {
     NS_LOG_FUNCTION(this);
-    FatalImpl::UnregisterStream(&m_file);
     Close();
+    FatalImpl::UnregisterStream(&m_file);
 }
 
 bool
 PcapFile::Fail() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_async)
+    {
+        std::unique_lock lock{AsyncThread::Get().mutex};
+        return m_async->failed;
+    }
     return m_file.fail();
 }
 
@@ -78,6 +316,11 @@ bool
 PcapFile::Eof() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_async)
+    {
+        // the file is only written in asynchronous mode
+        return false;
+    }
     return m_file.eof();
 }
 
@@ -85,6 +328,14 @@ void
 PcapFile::Clear()
 {
     NS_LOG_FUNCTION(this);
+    if (m_async)
+    {
+        m_async->Flush();
+        std::unique_lock lock{AsyncThread::Get().mutex};
+        m_async->failed = false;
+        m_file.clear();
+        return;
+    }
     m_file.clear();
 }
 
@@ -92,6 +343,7 @@ void
 PcapFile::Close()
 {
     NS_LOG_FUNCTION(this);
+    m_async.reset();
     m_file.close();
 }
 
@@ -332,6 +584,7 @@ PcapFile::Open(const std::string& filename, std::ios::openmode mode)
 {
     NS_LOG_FUNCTION(this << filename << mode);
     NS_ASSERT((mode & std::ios::app) == 0);
+    NS_ASSERT_MSG(!m_async, "Cannot open a file in asynchronous mode");
     NS_ASSERT(!m_file.fail());
     //
     // All pcap files are binary files, so we just do this automatically.
@@ -355,6 +608,7 @@ PcapFile::Init(uint32_t dataLinkType,
                bool nanosecMode)
 {
     NS_LOG_FUNCTION(this << dataLinkType << snapLen << timeZoneCorrection << swapMode);
+    NS_ASSERT_MSG(!m_async, "Cannot initialize a file in asynchronous mode");
 
     //
     // Initialize the magic number and nanosecond mode flag
@@ -413,7 +667,6 @@ uint32_t
 PcapFile::WritePacketHeader(uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << totalLen);
-    NS_ASSERT(m_file.good());
 
     uint32_t inclLen = totalLen > m_fileHeader.m_snapLen ? m_fileHeader.m_snapLen : totalLen;
 
@@ -428,6 +681,17 @@ PcapFile::WritePacketHeader(uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
         Swap(&header, &header);
     }
 
+    if (m_async)
+    {
+        uint8_t* out = m_async->Append(16);
+        memcpy(out, &header.m_tsSec, sizeof(header.m_tsSec));
+        memcpy(out + 4, &header.m_tsUsec, sizeof(header.m_tsUsec));
+        memcpy(out + 8, &header.m_inclLen, sizeof(header.m_inclLen));
+        memcpy(out + 12, &header.m_origLen, sizeof(header.m_origLen));
+        return inclLen;
+    }
+
+    NS_ASSERT(m_file.good());
     //
     // Watch out for memory alignment differences between machines, so write
     // them all individually.
@@ -445,6 +709,11 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, const uint8_t* const data, uint
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << &data << totalLen);
     uint32_t inclLen = WritePacketHeader(tsSec, tsUsec, totalLen);
+    if (m_async)
+    {
+        memcpy(m_async->Append(inclLen), data, inclLen);
+        return;
+    }
     m_file.write((const char*)data, inclLen);
     NS_BUILD_DEBUG(m_file.flush());
 }
@@ -454,6 +723,12 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << p);
     uint32_t inclLen = WritePacketHeader(tsSec, tsUsec, p->GetSize());
+    if (m_async)
+    {
+        // only the bytes within the snap length are copied
+        p->CopyData(m_async->Append(inclLen), inclLen);
+        return;
+    }
     p->CopyData(&m_file, inclLen);
     NS_BUILD_DEBUG(m_file.flush());
 }
@@ -470,11 +745,55 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, const Header& header, Ptr<const
     headerBuffer.AddAtStart(headerSize);
     header.Serialize(headerBuffer.Begin());
     uint32_t toCopy = std::min(headerSize, inclLen);
+    if (m_async)
+    {
+        uint8_t* out = m_async->Append(inclLen);
+        headerBuffer.CopyData(out, toCopy);
+        p->CopyData(out + toCopy, inclLen - toCopy);
+        return;
+    }
     headerBuffer.CopyData(&m_file, toCopy);
     inclLen -= toCopy;
     p->CopyData(&m_file, inclLen);
 }
 
+void
+PcapFile::EnableAsync(uint32_t chunkSize)
+{
+    NS_LOG_FUNCTION(this << chunkSize);
+    NS_ASSERT_MSG(!m_async, "Asynchronous mode already enabled");
+    NS_ASSERT(chunkSize > 0);
+    NS_ASSERT(m_file.good());
+    m_file.flush();
+    m_async = std::make_unique<AsyncWriter>(m_file, chunkSize);
+}
+
+void
+PcapFile::SetAsyncMaxChunks(uint32_t maxChunks)
+{
+    NS_LOG_FUNCTION(maxChunks);
+    NS_ASSERT(maxChunks > 0);
+    AsyncThread& thread = AsyncThread::Get();
+    std::unique_lock lock{thread.mutex};
+    thread.maxChunks = maxChunks;
+    // the files waiting for room in the queue may now queue their chunk
+    thread.written.notify_all();
+}
+
+void
+PcapFile::Flush()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_async)
+    {
+        m_async->Flush();
+    }
+    else
+    {
+        m_file.flush();
+    }
+}
+
 void
 PcapFile::Read(uint8_t* const data,
                uint32_t maxBytes,
@@ -485,6 +804,7 @@ PcapFile::Read(uint8_t* const data,
                uint32_t& readLen)
 {
     NS_LOG_FUNCTION(this << &data << maxBytes << tsSec << tsUsec << inclLen << origLen << readLen);
+    NS_ASSERT_MSG(!m_async, "Cannot read a file in asynchronous mode");
     NS_ASSERT(m_file.good());
 
     PcapRecordHeader header;
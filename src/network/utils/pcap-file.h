@@ -23,6 +23,7 @@
 #include "ns3/ptr.h"
 
 #include <fstream>
+#include <memory>
 #include <stdint.h>
 #include <string>
 
@@ -45,6 +46,8 @@ class PcapFile
     static const int32_t ZONE_DEFAULT = 0; //!< Time zone offset for current location
     static const uint32_t SNAPLEN_DEFAULT =
         65535; //!< Default value for maximum octets to save per packet
+    static const uint32_t ASYNC_MAX_CHUNKS_DEFAULT =
+        16; //!< Default maximum number of chunks waiting for the writer thread
 
   public:
     PcapFile();
@@ -152,6 +155,45 @@ class PcapFile
      */
     void Write(uint32_t tsSec, uint32_t tsUsec, const Header& header, Ptr<const Packet> p);
 
+    /**
+     * \brief Write the next packets through a background thread
+     *
+     * The records are formatted, and the packets truncated to the snap
+     * length, by the calling thread into chunks of \pname{chunkSize} bytes,
+     * which a writer thread appends to the file in order. The writer thread
+     * is shared by all the files in asynchronous mode, and a file only gets
+     * a chunk when it writes a record. The content of the file is the same
+     * as with the synchronous writes.
+     *
+     * This must be called after Init(), and lasts until Close(), which
+     * writes the pending records. The file can be neither read nor
+     * initialized meanwhile.
+     *
+     * \param chunkSize   Size of the chunks, in bytes
+     *
+     * \see SetAsyncMaxChunks
+     */
+    void EnableAsync(uint32_t chunkSize);
+
+    /**
+     * \brief Set the maximum number of chunks waiting for the writer thread
+     *
+     * The limit is shared by all the files in asynchronous mode: when it is
+     * reached, a file which fills a chunk blocks until a chunk is written.
+     *
+     * \param maxChunks   Maximum number of chunks, ASYNC_MAX_CHUNKS_DEFAULT
+     *                    by default
+     */
+    static void SetAsyncMaxChunks(uint32_t maxChunks);
+
+    /**
+     * \brief Write the packets written so far to the underlying file
+     *
+     * In asynchronous mode, this waits until the writer thread wrote all
+     * the pending chunks.
+     */
+    void Flush();
+
     /**
      * \brief Read next packet from file
      *
@@ -373,11 +415,21 @@ class PcapFile
      */
     void ReadAndVerifyFileHeader();
 
-    std::string m_filename;      //!< file name
-    std::fstream m_file;         //!< file stream
-    PcapFileHeader m_fileHeader; //!< file header
-    bool m_swapMode;             //!< swap mode
-    bool m_nanosecMode;          //!< nanosecond timestamp mode
+    /**
+     * \brief Chunks of records written by a background thread
+     */
+    struct AsyncWriter;
+    /**
+     * \brief The background thread shared by the files in asynchronous mode
+     */
+    struct AsyncThread;
+
+    std::string m_filename;               //!< file name
+    std::fstream m_file;                  //!< file stream
+    PcapFileHeader m_fileHeader;          //!< file header
+    bool m_swapMode;                      //!< swap mode
+    bool m_nanosecMode;                   //!< nanosecond timestamp mode
+    std::unique_ptr<AsyncWriter> m_async; //!< background writer, in asynchronous mode
 };
 
 } // namespace ns3
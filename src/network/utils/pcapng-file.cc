@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "pcapng-file.h"
+
+#include "ns3/assert.h"
+#include "ns3/buffer.h"
+#include "ns3/fatal-error.h"
+#include "ns3/header.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+
+#include <cstring>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PcapngFile");
+
+const uint32_t SECTION_HEADER_BLOCK = 0x0a0d0d0a; /**< Section header block type */
+const uint32_t INTERFACE_DESCRIPTION_BLOCK = 1;   /**< Interface description block type */
+const uint32_t ENHANCED_PACKET_BLOCK = 6;         /**< Enhanced packet block type */
+const uint32_t BYTE_ORDER_MAGIC = 0x1a2b3c4d;     /**< Identifies the byte order of a section */
+const uint16_t VERSION_MAJOR = 1;                 /**< Major version of the pcapng format */
+const uint16_t VERSION_MINOR = 0;                 /**< Minor version of the pcapng format */
+const uint16_t OPT_ENDOFOPT = 0;                  /**< End of the options */
+const uint16_t IF_NAME = 2;                       /**< Name of an interface */
+const uint16_t IF_TSRESOL = 9;                    /**< Timestamp resolution of an interface */
+
+PcapngFile::PcapngFile()
+    : m_gzFile(nullptr),
+      m_fail(false)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PcapngFile::~PcapngFile()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+}
+
+bool
+PcapngFile::IsCompressionSupported()
+{
+#ifdef HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+PcapngFile::Fail() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_fail;
+}
+
+void
+PcapngFile::Open(const std::string& filename, bool compress)
+{
+    NS_LOG_FUNCTION(this << filename << compress);
+    NS_ASSERT_MSG(!m_file.is_open() && m_gzFile == nullptr, "File already open");
+    if (compress)
+    {
+#ifdef HAVE_ZLIB
+        m_gzFile = gzopen(filename.c_str(), "wb");
+        m_fail = m_gzFile == nullptr;
+#else
+        NS_FATAL_ERROR("Cannot compress " << filename << ": ns-3 was built without zlib");
+#endif
+    }
+    else
+    {
+        m_file.open(filename, std::ios::out | std::ios::binary);
+        m_fail = m_file.fail();
+    }
+    m_snapLens.clear();
+
+    //
+    // Section header block, of unknown section length.
+    //
+    m_block.resize(28);
+    memcpy(m_block.data() + 8, &BYTE_ORDER_MAGIC, 4);
+    memcpy(m_block.data() + 12, &VERSION_MAJOR, 2);
+    memcpy(m_block.data() + 14, &VERSION_MINOR, 2);
+    int64_t sectionLength = -1;
+    memcpy(m_block.data() + 16, &sectionLength, 8);
+    memcpy(m_block.data(), &SECTION_HEADER_BLOCK, 4);
+    EndBlock(16);
+}
+
+void
+PcapngFile::Close()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+#ifdef HAVE_ZLIB
+    if (m_gzFile != nullptr)
+    {
+        m_fail |= gzclose(m_gzFile) != Z_OK;
+        m_gzFile = nullptr;
+    }
+#endif
+}
+
+void
+PcapngFile::Flush()
+{
+    NS_LOG_FUNCTION(this);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    if (m_file.is_open())
+    {
+        m_file.flush();
+    }
+#ifdef HAVE_ZLIB
+    if (m_gzFile != nullptr)
+    {
+        gzflush(m_gzFile, Z_SYNC_FLUSH);
+    }
+#endif
+}
+
+uint32_t
+PcapngFile::PutOption(uint32_t offset, uint16_t code, const void* value, uint16_t length)
+{
+    uint32_t paddedLength = (length + 3) & (~3);
+    m_block.resize(offset + 4 + paddedLength);
+    memcpy(m_block.data() + offset, &code, 2);
+    memcpy(m_block.data() + offset + 2, &length, 2);
+    if (length > 0)
+    {
+        memcpy(m_block.data() + offset + 4, value, length);
+    }
+    memset(m_block.data() + offset + 4 + length, 0, paddedLength - length);
+    return offset + 4 + paddedLength;
+}
+
+uint32_t
+PcapngFile::AddInterface(uint32_t dataLinkType,
+                         uint32_t snapLen,
+                         const std::string& name,
+                         bool nanosecMode)
+{
+    NS_LOG_FUNCTION(this << dataLinkType << snapLen << name << nanosecMode);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    NS_ASSERT_MSG(dataLinkType <= 0xffff, "Invalid data link type " << dataLinkType);
+
+    m_block.resize(16);
+    auto linkType = static_cast<uint16_t>(dataLinkType);
+    uint16_t reserved = 0;
+    memcpy(m_block.data() + 8, &linkType, 2);
+    memcpy(m_block.data() + 10, &reserved, 2);
+    memcpy(m_block.data() + 12, &snapLen, 4);
+    uint32_t offset = PutOption(16, IF_NAME, name.data(), name.size());
+    // The resolution is a negative power of ten
+    uint8_t tsresol = nanosecMode ? 9 : 6;
+    offset = PutOption(offset, IF_TSRESOL, &tsresol, 1);
+    offset = PutOption(offset, OPT_ENDOFOPT, nullptr, 0);
+    memcpy(m_block.data(), &INTERFACE_DESCRIPTION_BLOCK, 4);
+    EndBlock(offset - 8);
+
+    m_snapLens.push_back(snapLen);
+    return m_snapLens.size() - 1;
+}
+
+uint32_t
+PcapngFile::StartPacketBlock(uint32_t interfaceId, uint64_t timestamp, uint32_t totalLen)
+{
+    NS_ASSERT_MSG(interfaceId < m_snapLens.size(), "Unknown interface " << interfaceId);
+    uint32_t inclLen = std::min(totalLen, m_snapLens[interfaceId]);
+    m_block.resize(EPB_HEADER_SIZE + inclLen);
+    auto tsHigh = static_cast<uint32_t>(timestamp >> 32);
+    auto tsLow = static_cast<uint32_t>(timestamp);
+    memcpy(m_block.data(), &ENHANCED_PACKET_BLOCK, 4);
+    memcpy(m_block.data() + 8, &interfaceId, 4);
+    memcpy(m_block.data() + 12, &tsHigh, 4);
+    memcpy(m_block.data() + 16, &tsLow, 4);
+    memcpy(m_block.data() + 20, &inclLen, 4);
+    memcpy(m_block.data() + 24, &totalLen, 4);
+    return inclLen;
+}
+
+void
+PcapngFile::EndBlock(uint32_t bodyLen)
+{
+    uint32_t paddedLen = (bodyLen + 3) & (~3);
+    uint32_t blockLen = 8 + paddedLen + 4;
+    m_block.resize(blockLen);
+    memset(m_block.data() + 8 + bodyLen, 0, paddedLen - bodyLen);
+    memcpy(m_block.data() + 4, &blockLen, 4);
+    memcpy(m_block.data() + blockLen - 4, &blockLen, 4);
+
+    if (m_file.is_open())
+    {
+        m_file.write(reinterpret_cast<const char*>(m_block.data()), blockLen);
+        m_fail |= m_file.fail();
+    }
+#ifdef HAVE_ZLIB
+    else if (m_gzFile != nullptr)
+    {
+        m_fail |= gzwrite(m_gzFile, m_block.data(), blockLen) != static_cast<int>(blockLen);
+    }
+#endif
+}
+
+void
+PcapngFile::Write(uint32_t interfaceId, uint64_t timestamp, const uint8_t* data, uint32_t totalLen)
+{
+    NS_LOG_FUNCTION(this << interfaceId << timestamp << &data << totalLen);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    uint32_t inclLen = StartPacketBlock(interfaceId, timestamp, totalLen);
+    memcpy(m_block.data() + EPB_HEADER_SIZE, data, inclLen);
+    EndBlock(EPB_HEADER_SIZE - 8 + inclLen);
+}
+
+void
+PcapngFile::Write(uint32_t interfaceId, uint64_t timestamp, Ptr<const Packet> p)
+{
+    NS_LOG_FUNCTION(this << interfaceId << timestamp << p);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    uint32_t inclLen = StartPacketBlock(interfaceId, timestamp, p->GetSize());
+    p->CopyData(m_block.data() + EPB_HEADER_SIZE, inclLen);
+    EndBlock(EPB_HEADER_SIZE - 8 + inclLen);
+}
+
+void
+PcapngFile::Write(uint32_t interfaceId,
+                  uint64_t timestamp,
+                  const Header& header,
+                  Ptr<const Packet> p)
+{
+    NS_LOG_FUNCTION(this << interfaceId << timestamp << &header << p);
+#ifdef NS3_MTP
+    std::unique_lock lock{m_mutex};
+#endif
+    uint32_t headerSize = header.GetSerializedSize();
+    uint32_t inclLen = StartPacketBlock(interfaceId, timestamp, headerSize + p->GetSize());
+
+    Buffer headerBuffer;
+    headerBuffer.AddAtStart(headerSize);
+    header.Serialize(headerBuffer.Begin());
+    uint32_t toCopy = std::min(headerSize, inclLen);
+    headerBuffer.CopyData(m_block.data() + EPB_HEADER_SIZE, toCopy);
+    p->CopyData(m_block.data() + EPB_HEADER_SIZE + toCopy, inclLen - toCopy);
+    EndBlock(EPB_HEADER_SIZE - 8 + inclLen);
+}
+
+} // namespace ns3
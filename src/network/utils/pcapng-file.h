@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PCAPNG_FILE_H
+#define PCAPNG_FILE_H
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+
+#include <fstream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#ifdef NS3_MTP
+#include <mutex>
+#endif
+
+struct gzFile_s;
+
+namespace ns3
+{
+
+class Packet;
+class Header;
+
+/**
+ * \brief A pcapng file, holding the packets of several interfaces
+ *
+ * A pcapng file starts with a section header block, followed by one
+ * interface description block per interface, and one enhanced packet
+ * block per packet, which refers to the interface of the packet.  Thus,
+ * a single file can hold the packets of all the devices of a simulation.
+ *
+ * The file can be compressed with gzip on the fly, which Wireshark and
+ * tshark read transparently, if ns-3 was built with zlib.
+ *
+ * The blocks are written in the byte order of the writing system, which
+ * the byte-order magic of the section header block identifies.
+ *
+ * See https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html
+ */
+class PcapngFile : public SimpleRefCount<PcapngFile>
+{
+  public:
+    PcapngFile();
+    ~PcapngFile();
+
+    /**
+     * \return true if the file could not be opened or written, false otherwise.
+     */
+    bool Fail() const;
+
+    /**
+     * \brief Create a pcapng file, and write its section header block.
+     *
+     * \param filename The name of the file.
+     * \param compress Whether to compress the file with gzip.
+     */
+    void Open(const std::string& filename, bool compress = false);
+
+    /**
+     * \brief Close the file.
+     *
+     * The packets written afterwards are dropped.
+     */
+    void Close();
+
+    /**
+     * \brief Add an interface to the file, by writing its interface
+     * description block.
+     *
+     * \param dataLinkType A data link type as defined in the pcap library.
+     * \param snapLen The maximum number of octets saved per packet.
+     * \param name The name of the interface.
+     * \param nanosecMode Whether the timestamps of the packets of the
+     *        interface are in nanoseconds, rather than microseconds.
+     * \returns The identifier of the interface.
+     */
+    uint32_t AddInterface(uint32_t dataLinkType,
+                          uint32_t snapLen,
+                          const std::string& name,
+                          bool nanosecMode = false);
+
+    /**
+     * \brief Write a packet to the file
+     *
+     * \param interfaceId The identifier of the interface.
+     * \param timestamp   Packet timestamp, in microseconds or nanoseconds
+     *                    depending on the interface
+     * \param data        Data buffer
+     * \param totalLen    Total packet length
+     */
+    void Write(uint32_t interfaceId, uint64_t timestamp, const uint8_t* data, uint32_t totalLen);
+    /**
+     * \brief Write a packet to the file
+     *
+     * \param interfaceId The identifier of the interface.
+     * \param timestamp   Packet timestamp, in microseconds or nanoseconds
+     *                    depending on the interface
+     * \param p           Packet to write
+     */
+    void Write(uint32_t interfaceId, uint64_t timestamp, Ptr<const Packet> p);
+    /**
+     * \brief Write a packet to the file
+     *
+     * \param interfaceId The identifier of the interface.
+     * \param timestamp   Packet timestamp, in microseconds or nanoseconds
+     *                    depending on the interface
+     * \param header      Header to write, in front of packet
+     * \param p           Packet to write
+     */
+    void Write(uint32_t interfaceId,
+               uint64_t timestamp,
+               const Header& header,
+               Ptr<const Packet> p);
+
+    /**
+     * \brief Write the buffered blocks to the file.
+     *
+     * With compression, this ends a compressed block, which degrades the
+     * compression if done too often.
+     */
+    void Flush();
+
+    /**
+     * \returns true if ns-3 was built with zlib, which compression requires.
+     */
+    static bool IsCompressionSupported();
+
+  private:
+    /**
+     * \brief Start an enhanced packet block in the block buffer.
+     *
+     * \param interfaceId The identifier of the interface.
+     * \param timestamp   Packet timestamp
+     * \param totalLen    Total packet length
+     * \returns the number of packet bytes to write in the block, after
+     *          the first EPB_HEADER_SIZE bytes of the block buffer.
+     */
+    uint32_t StartPacketBlock(uint32_t interfaceId, uint64_t timestamp, uint32_t totalLen);
+    /**
+     * \brief Pad and terminate the block in the block buffer, then write it.
+     *
+     * \param bodyLen The number of bytes of the block after its type
+     *        and length fields.
+     */
+    void EndBlock(uint32_t bodyLen);
+    /**
+     * \brief Append an option to the block buffer.
+     *
+     * \param offset The offset of the option in the block buffer.
+     * \param code The code of the option.
+     * \param value The value of the option.
+     * \param length The length of the value.
+     * \returns the offset following the padded option.
+     */
+    uint32_t PutOption(uint32_t offset, uint16_t code, const void* value, uint16_t length);
+
+    /** Size of the fixed part of an enhanced packet block, before the data. */
+    static const uint32_t EPB_HEADER_SIZE = 28;
+
+    std::ofstream m_file;             //!< file stream, without compression
+    gzFile_s* m_gzFile;               //!< compressed file stream, or nullptr
+    bool m_fail;                      //!< Whether opening or writing the file failed
+    std::vector<uint32_t> m_snapLens; //!< snap length of each interface
+    std::vector<uint8_t> m_block;     //!< buffer in which blocks are built
+#ifdef NS3_MTP
+    std::mutex m_mutex; //!< Serializes the writes of the devices of different threads
+#endif
+};
+
+} // namespace ns3
+
+#endif /* PCAPNG_FILE_H */
@@ -24,6 +24,7 @@
 
 #include "ns3/log.h"
 #include "ns3/object.h"
+#include "ns3/packet-accounting.h"
 #include "ns3/packet.h"
 #include "ns3/queue-fwd.h"
 #include "ns3/queue-item.h"
@@ -430,6 +431,25 @@ class Queue : public QueueBase
         }
     };
 
+    /**
+     * \param packet a packet stored within the queue
+     * \return the packet, for the PacketAccounting
+     */
+    static const Packet* GetAccountedPacket(const Packet* packet)
+    {
+        return packet;
+    }
+
+    /**
+     * \param item an item stored within the queue
+     * \return the packet of the item, for the PacketAccounting
+     */
+    template <class T>
+    static const Packet* GetAccountedPacket(const T* item)
+    {
+        return PeekPointer(item->GetPacket());
+    }
+
     Container m_packets;     //!< the items in the queue
     NS_LOG_TEMPLATE_DECLARE; //!< the log component
 
@@ -528,6 +548,11 @@ Queue<Item, Container>::DoEnqueue(ConstIterator pos, Ptr<Item> item, Iterator& r
 
     ret = m_packets.insert(pos, item);
 
+    if (PacketAccounting::IsEnabled())
+    {
+        PacketAccounting::NotifyHeld(GetAccountedPacket(PeekPointer(item)), this);
+    }
+
     uint32_t size = item->GetSize();
     m_nBytes += size;
     m_nTotalReceivedBytes += size;
@@ -558,6 +583,10 @@ Queue<Item, Container>::DoDequeue(ConstIterator pos)
     if (item)
     {
         m_packets.erase(pos);
+        if (PacketAccounting::IsEnabled())
+        {
+            PacketAccounting::NotifyReleased(GetAccountedPacket(PeekPointer(item)), this);
+        }
         NS_ASSERT(m_nBytes.Get() >= item->GetSize());
         NS_ASSERT(m_nPackets.Get() > 0);
 
@@ -587,6 +616,10 @@ Queue<Item, Container>::DoRemove(ConstIterator pos)
     if (item)
     {
         m_packets.erase(pos);
+        if (PacketAccounting::IsEnabled())
+        {
+            PacketAccounting::NotifyReleased(GetAccountedPacket(PeekPointer(item)), this);
+        }
         NS_ASSERT(m_nBytes.Get() >= item->GetSize());
         NS_ASSERT(m_nPackets.Get() > 0);
 
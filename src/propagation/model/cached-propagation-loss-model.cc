@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "cached-propagation-loss-model.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/mobility-model.h"
+#include "ns3/pointer.h"
+
+#include <functional>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("CachedPropagationLossModel");
+
+NS_OBJECT_ENSURE_REGISTERED(CachedPropagationLossModel);
+
+TypeId
+CachedPropagationLossModel::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::CachedPropagationLossModel")
+            .SetParent<PropagationLossModel>()
+            .SetGroupName("Propagation")
+            .AddConstructor<CachedPropagationLossModel>()
+            .AddAttribute("PropagationLossModel",
+                          "The first propagation loss model of the chain whose loss is cached.",
+                          PointerValue(),
+                          MakePointerAccessor(&CachedPropagationLossModel::m_model),
+                          MakePointerChecker<PropagationLossModel>())
+            .AddAttribute("PositionTolerance",
+                          "The distance, in meters, that either node may move before the "
+                          "cached loss between them is computed again.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&CachedPropagationLossModel::m_tolerance),
+                          MakeDoubleChecker<double>(0));
+    return tid;
+}
+
+CachedPropagationLossModel::CachedPropagationLossModel()
+    : m_hits(0),
+      m_misses(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+CachedPropagationLossModel::~CachedPropagationLossModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+CachedPropagationLossModel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    Clear();
+    m_model = nullptr;
+    PropagationLossModel::DoDispose();
+}
+
+void
+CachedPropagationLossModel::SetPropagationLossModel(Ptr<PropagationLossModel> model)
+{
+    NS_LOG_FUNCTION(this << model);
+    m_model = model;
+    Clear();
+}
+
+uint64_t
+CachedPropagationLossModel::GetNHits() const
+{
+    return m_hits;
+}
+
+uint64_t
+CachedPropagationLossModel::GetNMisses() const
+{
+    return m_misses;
+}
+
+void
+CachedPropagationLossModel::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    for (const auto& [key, tracked] : m_tracked)
+    {
+        tracked.model->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&CachedPropagationLossModel::CourseChanged, this));
+    }
+    m_tracked.clear();
+    m_cache.clear();
+    m_hits = 0;
+    m_misses = 0;
+}
+
+std::size_t
+CachedPropagationLossModel::MobilityPairHash::operator()(const MobilityPair& pair) const
+{
+    std::size_t first = std::hash<const MobilityModel*>()(pair.first);
+    std::size_t second = std::hash<const MobilityModel*>()(pair.second);
+    return first ^ (second + 0x9e3779b9 + (first << 6) + (first >> 2));
+}
+
+const CachedPropagationLossModel::Tracked*
+CachedPropagationLossModel::Track(Ptr<MobilityModel> model) const
+{
+    auto [it, inserted] = m_tracked.try_emplace(PeekPointer(model));
+    if (inserted)
+    {
+        NS_LOG_LOGIC("Tracking the course changes of " << model);
+        model->TraceConnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&CachedPropagationLossModel::CourseChanged,
+                         const_cast<CachedPropagationLossModel*>(this)));
+        it->second.model = model;
+        it->second.generation = 0;
+        it->second.moving = model->GetVelocity().GetLength() > 0;
+    }
+    return &it->second;
+}
+
+bool
+CachedPropagationLossModel::IsValid(const Entry& entry,
+                                    Ptr<MobilityModel> a,
+                                    Ptr<MobilityModel> b) const
+{
+    if (entry.a->generation != entry.aGeneration || entry.b->generation != entry.bGeneration)
+    {
+        return false;
+    }
+    if (entry.a->moving && CalculateDistance(entry.aPosition, a->GetPosition()) > m_tolerance)
+    {
+        return false;
+    }
+    if (entry.b->moving && CalculateDistance(entry.bPosition, b->GetPosition()) > m_tolerance)
+    {
+        return false;
+    }
+    return true;
+}
+
+void
+CachedPropagationLossModel::CourseChanged(Ptr<const MobilityModel> model)
+{
+    NS_LOG_FUNCTION(this << model);
+    // the losses of the model are recomputed when next looked up
+    Tracked& tracked = m_tracked.at(PeekPointer(model));
+    tracked.generation++;
+    tracked.moving = model->GetVelocity().GetLength() > 0;
+}
+
+double
+CachedPropagationLossModel::DoCalcRxPower(double txPowerDbm,
+                                          Ptr<MobilityModel> a,
+                                          Ptr<MobilityModel> b) const
+{
+    if (!m_model)
+    {
+        return txPowerDbm;
+    }
+    auto [it, inserted] = m_cache.try_emplace({PeekPointer(a), PeekPointer(b)});
+    Entry& entry = it->second;
+    if (!inserted && IsValid(entry, a, b))
+    {
+        m_hits++;
+        return txPowerDbm - entry.lossDb;
+    }
+    m_misses++;
+    double rxPowerDbm = m_model->CalcRxPower(txPowerDbm, a, b);
+    entry.lossDb = txPowerDbm - rxPowerDbm;
+    entry.a = Track(a);
+    entry.b = Track(b);
+    entry.aGeneration = entry.a->generation;
+    entry.bGeneration = entry.b->generation;
+    entry.aPosition = a->GetPosition();
+    entry.bPosition = b->GetPosition();
+    NS_LOG_DEBUG("Caching a loss of " << entry.lossDb << " dB from " << entry.aPosition << " to "
+                                      << entry.bPosition);
+    return rxPowerDbm;
+}
+
+int64_t
+CachedPropagationLossModel::DoAssignStreams(int64_t stream)
+{
+    return m_model ? m_model->AssignStreams(stream) : 0;
+}
+
+} // namespace ns3
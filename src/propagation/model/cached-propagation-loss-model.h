@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef CACHED_PROPAGATION_LOSS_MODEL_H
+#define CACHED_PROPAGATION_LOSS_MODEL_H
+
+#include "propagation-loss-model.h"
+
+#include "ns3/vector.h"
+
+#include <unordered_map>
+#include <utility>
+
+namespace ns3
+{
+
+/**
+ * \ingroup propagation
+ *
+ * \brief Caches the loss of a chain of propagation loss models, per pair
+ * of mobility models.
+ *
+ * The loss of the wrapped chain, set with the PropagationLossModel
+ * attribute, is computed once for each pair of transmitter and receiver
+ * mobility models, and reused until either model changes course, or moves
+ * by more than PositionTolerance meters.  This saves the evaluation of the
+ * chain for each frame between nodes which do not move, or barely move.
+ *
+ * The cached loss is only valid if the loss of the wrapped chain depends on
+ * the positions of the nodes only: it must not depend on the transmit
+ * power, on the time or on random variables, as is the case for the
+ * Friis, TwoRayGround, LogDistance, ThreeLogDistance and the
+ * ThreeGpp models without shadowing nor channel condition updates.  The
+ * models which only move between their course changes, at the velocity of
+ * their last course change, are assumed not to move if that velocity is
+ * null, so that their position is not looked up; this does not hold for
+ * the ConstantAccelerationMobilityModel.
+ */
+class CachedPropagationLossModel : public PropagationLossModel
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    CachedPropagationLossModel();
+    ~CachedPropagationLossModel() override;
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    CachedPropagationLossModel(const CachedPropagationLossModel&) = delete;
+    CachedPropagationLossModel& operator=(const CachedPropagationLossModel&) = delete;
+
+    /**
+     * \param model The first propagation loss model of the chain whose loss is cached.
+     */
+    void SetPropagationLossModel(Ptr<PropagationLossModel> model);
+
+    /**
+     * \return The number of losses found in the cache.
+     */
+    uint64_t GetNHits() const;
+    /**
+     * \return The number of losses computed by the wrapped chain.
+     */
+    uint64_t GetNMisses() const;
+    /**
+     * \brief Forget the cached losses, and reset the statistics.
+     */
+    void Clear();
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    double DoCalcRxPower(double txPowerDbm,
+                         Ptr<MobilityModel> a,
+                         Ptr<MobilityModel> b) const override;
+
+    int64_t DoAssignStreams(int64_t stream) override;
+
+    /// The state of a mobility model of the cached pairs
+    struct Tracked
+    {
+        Ptr<MobilityModel> model; //!< The mobility model
+        uint32_t generation;      //!< The number of course changes of the model
+        bool moving;              //!< Whether the velocity of the model is not null
+    };
+
+    /// A cached loss
+    struct Entry
+    {
+        double lossDb;        //!< The loss of the wrapped chain
+        const Tracked* a;     //!< The source model
+        const Tracked* b;     //!< The destination model
+        uint32_t aGeneration; //!< The generation of the source model
+        uint32_t bGeneration; //!< The generation of the destination model
+        Vector aPosition;     //!< The position of the source model
+        Vector bPosition;     //!< The position of the destination model
+    };
+
+    /// Typedef: Mobility models pair
+    typedef std::pair<const MobilityModel*, const MobilityModel*> MobilityPair;
+
+    /// Hash of a pair of mobility models
+    struct MobilityPairHash
+    {
+        /**
+         * \param pair The pair of mobility models.
+         * \return The hash of the pair.
+         */
+        std::size_t operator()(const MobilityPair& pair) const;
+    };
+
+    /**
+     * \param model A mobility model.
+     * \return The state of the model, which is tracked from then on.
+     */
+    const Tracked* Track(Ptr<MobilityModel> model) const;
+
+    /**
+     * \param entry A cached loss.
+     * \param a The source mobility model.
+     * \param b The destination mobility model.
+     * \return true if the cached loss is still valid.
+     */
+    bool IsValid(const Entry& entry, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
+
+    /**
+     * \brief Invalidate the losses of a mobility model.
+     * \param model The mobility model whose course changed.
+     */
+    void CourseChanged(Ptr<const MobilityModel> model);
+
+    Ptr<PropagationLossModel> m_model; //!< The wrapped chain
+    double m_tolerance;                //!< The distance beyond which the losses are recomputed
+
+    /// The cached losses
+    mutable std::unordered_map<MobilityPair, Entry, MobilityPairHash> m_cache;
+    /// The mobility models of the cached pairs
+    mutable std::unordered_map<const MobilityModel*, Tracked> m_tracked;
+    mutable uint64_t m_hits;   //!< The number of losses found in the cache
+    mutable uint64_t m_misses; //!< The number of losses computed
+};
+
+} // namespace ns3
+
+#endif /* CACHED_PROPAGATION_LOSS_MODEL_H */
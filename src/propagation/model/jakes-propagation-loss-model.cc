@@ -21,6 +21,8 @@
 
 #include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/nstime.h"
+#include "ns3/uinteger.h"
 
 namespace ns3
 {
@@ -43,13 +45,52 @@ JakesPropagationLossModel::~JakesPropagationLossModel()
 TypeId
 JakesPropagationLossModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::JakesPropagationLossModel")
-                            .SetParent<PropagationLossModel>()
-                            .SetGroupName("Propagation")
-                            .AddConstructor<JakesPropagationLossModel>();
+    static TypeId tid =
+        TypeId("ns3::JakesPropagationLossModel")
+            .SetParent<PropagationLossModel>()
+            .SetGroupName("Propagation")
+            .AddConstructor<JakesPropagationLossModel>()
+            .AddAttribute("CacheMaxSize",
+                          "The maximum number of paths whose Jakes process is cached, beyond "
+                          "which the least recently used paths are evicted, or 0 for no limit.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&JakesPropagationLossModel::SetCacheMaxSize,
+                                               &JakesPropagationLossModel::GetCacheMaxSize),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("CacheTimeToLive",
+                          "The time after which the Jakes process of a path which is not used "
+                          "is evicted, or zero for no expiration.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&JakesPropagationLossModel::SetCacheTimeToLive,
+                                           &JakesPropagationLossModel::GetCacheTimeToLive),
+                          MakeTimeChecker());
     return tid;
 }
 
+void
+JakesPropagationLossModel::SetCacheMaxSize(uint32_t maxSize)
+{
+    m_propagationCache.SetMaxSize(maxSize);
+}
+
+uint32_t
+JakesPropagationLossModel::GetCacheMaxSize() const
+{
+    return m_propagationCache.GetMaxSize();
+}
+
+void
+JakesPropagationLossModel::SetCacheTimeToLive(Time ttl)
+{
+    m_propagationCache.SetTimeToLive(ttl);
+}
+
+Time
+JakesPropagationLossModel::GetCacheTimeToLive() const
+{
+    return m_propagationCache.GetTimeToLive();
+}
+
 void
 JakesPropagationLossModel::DoDispose()
 {
@@ -47,6 +47,25 @@ class JakesPropagationLossModel : public PropagationLossModel
     JakesPropagationLossModel(const JakesPropagationLossModel&) = delete;
     JakesPropagationLossModel& operator=(const JakesPropagationLossModel&) = delete;
 
+    /**
+     * Set the maximum number of paths whose Jakes process is cached
+     * \param maxSize the maximum number of paths, or 0 for no limit
+     */
+    void SetCacheMaxSize(uint32_t maxSize);
+    /**
+     * \return the maximum number of paths whose Jakes process is cached, or 0 for no limit
+     */
+    uint32_t GetCacheMaxSize() const;
+    /**
+     * Set the time after which the Jakes process of a path which is not used is evicted
+     * \param ttl the time to live, or zero for no expiration
+     */
+    void SetCacheTimeToLive(Time ttl);
+    /**
+     * \return the time to live of the Jakes processes of the paths, or zero for no expiration
+     */
+    Time GetCacheTimeToLive() const;
+
   protected:
     void DoDispose() override;
 
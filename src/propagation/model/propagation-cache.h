@@ -20,8 +20,12 @@
 #define PROPAGATION_CACHE_H_
 
 #include "ns3/mobility-model.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
 
-#include <map>
+#include <algorithm>
+#include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
@@ -30,12 +34,37 @@ namespace ns3
  * \brief Constructs a cache of objects, where each object is responsible for a single propagation
  * path loss calculations. Propagation path a-->b and b-->a is the same thing. Propagation path is
  * identified by a couple of MobilityModels and a spectrum model UID
+ *
+ * The paths are stored in an open-addressing hash table with linear
+ * probing, so that a lookup costs a hash and, usually, a single probe of
+ * a contiguous table, whatever the number of paths.  The paths are hashed
+ * by the uids of their mobility models rather than by their addresses, so
+ * that the layout of the table, and thus the order in which the paths are
+ * evicted, is the same in every run.
+ *
+ * By default, the paths are kept until Cleanup is called.  The cache may
+ * instead be bounded:
+ * - SetMaxSize caps the number of paths: once the cap is reached, adding
+ *   a path evicts one of the least recently used paths, as chosen by the
+ *   CLOCK approximation of LRU, which costs a reference flag per path
+ *   rather than a list;
+ * - SetTimeToLive expires the paths which have not been looked up for
+ *   that long: an expired path is no longer found, and is evicted either
+ *   when it is looked up, when the table would otherwise grow, or when
+ *   the clock hand reaches it once the cap is reached, as if it were not
+ *   referenced.
+ *
+ * The evicted objects are disposed, as on Cleanup, so that the objects
+ * returned by GetPathData must not be kept across calls to AddPathData.
  */
 template <class T>
 class PropagationCache
 {
   public:
-    PropagationCache(){};
+    PropagationCache()
+        : m_size(0),
+          m_hand(0),
+          m_maxSize(0){};
     ~PropagationCache(){};
 
     /**
@@ -47,13 +76,20 @@ class PropagationCache
      */
     Ptr<T> GetPathData(Ptr<const MobilityModel> a, Ptr<const MobilityModel> b, uint32_t modelUid)
     {
-        PropagationPathIdentifier key = PropagationPathIdentifier(a, b, modelUid);
-        typename PathCache::iterator it = m_pathCache.find(key);
-        if (it == m_pathCache.end())
+        std::size_t index = Find(a, b, modelUid);
+        if (index == NOT_FOUND)
         {
             return nullptr;
         }
-        return it->second;
+        PathSlot& slot = m_slots[index];
+        if (IsExpired(slot))
+        {
+            Evict(index);
+            return nullptr;
+        }
+        slot.m_referenced = true;
+        slot.m_lastAccess = Simulator::Now();
+        return slot.m_data;
     };
 
     /**
@@ -68,9 +104,31 @@ class PropagationCache
                      Ptr<const MobilityModel> b,
                      uint32_t modelUid)
     {
-        PropagationPathIdentifier key = PropagationPathIdentifier(a, b, modelUid);
-        NS_ASSERT(m_pathCache.find(key) == m_pathCache.end());
-        m_pathCache.insert(std::make_pair(key, data));
+        NS_ASSERT(Find(a, b, modelUid) == NOT_FOUND);
+        if (m_maxSize > 0 && m_size >= m_maxSize)
+        {
+            EvictOne();
+        }
+        if ((m_size + 1) * 2 > m_slots.size())
+        {
+            // the expired paths make room before the table grows
+            EvictExpired();
+            if ((m_size + 1) * 2 > m_slots.size())
+            {
+                Resize(std::max<std::size_t>(16, m_slots.size() * 2));
+            }
+        }
+        PathSlot slot;
+        slot.m_min = std::min(a, b);
+        slot.m_max = std::max(a, b);
+        slot.m_modelUid = modelUid;
+        slot.m_hash = Hash(slot.m_min, slot.m_max, modelUid);
+        // the path is only kept over the others once it is looked up again
+        slot.m_referenced = false;
+        slot.m_lastAccess = Simulator::Now();
+        slot.m_data = data;
+        Insert(std::move(slot));
+        m_size++;
     };
 
     /**
@@ -78,73 +136,254 @@ class PropagationCache
      */
     void Cleanup()
     {
-        for (auto i : m_pathCache)
+        for (auto& slot : m_slots)
+        {
+            if (slot.m_data)
+            {
+                slot.m_data->Dispose();
+            }
+        }
+        m_slots.clear();
+        m_size = 0;
+        m_hand = 0;
+    }
+
+    /**
+     * \return the number of paths in the cache, including the expired paths not evicted yet
+     */
+    std::size_t GetSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Set the maximum number of paths in the cache
+     * \param maxSize the maximum number of paths, or 0 for no limit
+     */
+    void SetMaxSize(std::size_t maxSize)
+    {
+        m_maxSize = maxSize;
+        while (m_maxSize > 0 && m_size > m_maxSize)
         {
-            i.second->Dispose();
+            EvictOne();
         }
-        m_pathCache.clear();
+    }
+
+    /**
+     * \return the maximum number of paths in the cache, or 0 for no limit
+     */
+    std::size_t GetMaxSize() const
+    {
+        return m_maxSize;
+    }
+
+    /**
+     * Set the time after which the paths which have not been looked up expire
+     * \param ttl the time to live, or zero for no expiration
+     */
+    void SetTimeToLive(Time ttl)
+    {
+        m_ttl = ttl;
+    }
+
+    /**
+     * \return the time to live of the paths, or zero for no expiration
+     */
+    Time GetTimeToLive() const
+    {
+        return m_ttl;
     }
 
   private:
-    /// Each path is identified by
-    struct PropagationPathIdentifier
-    {
-        /**
-         * Constructor
-         * @param a 1st node mobility model
-         * @param b 2nd node mobility model
-         * @param modelUid model UID
-         */
-        PropagationPathIdentifier(Ptr<const MobilityModel> a,
-                                  Ptr<const MobilityModel> b,
-                                  uint32_t modelUid)
-            : m_srcMobility(a),
-              m_dstMobility(b),
-              m_spectrumModelUid(modelUid){};
-        Ptr<const MobilityModel> m_srcMobility; //!< 1st node mobility model
-        Ptr<const MobilityModel> m_dstMobility; //!< 2nd node mobility model
-        uint32_t m_spectrumModelUid;            //!< model UID
-
-        /**
-         * Less-than operator.
-         *
-         * The goal of this operator is just to provide a stable comparison
-         * to be used in containers requiring a order (of any kind).
-         *
-         * If the models are different, the comparison is based on their Uid.
-         * Otherwise, the comparison is based on the pointers of the Mobility models.
-         *
-         * \param other Right value of the operator.
-         * \returns True if the Left value is less than the Right value.
-         */
-        bool operator<(const PropagationPathIdentifier& other) const
+    /// A slot of the table, holding a path if m_data is not null
+    struct PathSlot
+    {
+        Ptr<const MobilityModel> m_min; //!< The lower of the mobility models of the path
+        Ptr<const MobilityModel> m_max; //!< The higher of the mobility models of the path
+        uint32_t m_modelUid;            //!< model UID
+        bool m_referenced;              //!< Whether the path was used since the clock hand passed
+        std::size_t m_hash;             //!< The hash of the path
+        Time m_lastAccess;              //!< The last time the path was added or looked up
+        Ptr<T> m_data;                  //!< The model associated to the path
+    };
+
+    /// The index returned by Find for a missing path
+    static constexpr std::size_t NOT_FOUND = ~static_cast<std::size_t>(0);
+
+    /**
+     * Hash a path; the paths a-->b and b-->a have the same hash
+     * \param a 1st node mobility model
+     * \param b 2nd node mobility model
+     * \param modelUid model UID
+     * \return the hash of the path
+     */
+    static std::size_t Hash(const Ptr<const MobilityModel>& a,
+                            const Ptr<const MobilityModel>& b,
+                            uint32_t modelUid)
+    {
+        uint64_t uidA = a->GetUid();
+        uint64_t uidB = b->GetUid();
+        // the finalizer of MurmurHash3, which spreads the consecutive uids
+        uint64_t h = std::min(uidA, uidB) << 32 | std::max(uidA, uidB);
+        h = (h * 0x9e3779b97f4a7c15ULL) ^ modelUid;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+    /**
+     * Find a path
+     * \param a 1st node mobility model
+     * \param b 2nd node mobility model
+     * \param modelUid model UID
+     * \return the index of the slot of the path, or NOT_FOUND
+     */
+    std::size_t Find(const Ptr<const MobilityModel>& a,
+                     const Ptr<const MobilityModel>& b,
+                     uint32_t modelUid) const
+    {
+        if (m_size == 0)
         {
-            if (m_spectrumModelUid != other.m_spectrumModelUid)
+            return NOT_FOUND;
+        }
+        /// Links are supposed to be symmetrical!
+        const Ptr<const MobilityModel>& min = std::min(a, b);
+        const Ptr<const MobilityModel>& max = std::max(a, b);
+        std::size_t mask = m_slots.size() - 1;
+        for (std::size_t index = Hash(min, max, modelUid) & mask; m_slots[index].m_data;
+             index = (index + 1) & mask)
+        {
+            const PathSlot& slot = m_slots[index];
+            if (slot.m_min == min && slot.m_max == max && slot.m_modelUid == modelUid)
             {
-                return m_spectrumModelUid < other.m_spectrumModelUid;
+                return index;
             }
-            /// Links are supposed to be symmetrical!
-            if (std::min(m_dstMobility, m_srcMobility) !=
-                std::min(other.m_dstMobility, other.m_srcMobility))
+        }
+        return NOT_FOUND;
+    }
+
+    /**
+     * Put a path in the first free slot from its home slot
+     * \param slot the path
+     */
+    void Insert(PathSlot&& slot)
+    {
+        std::size_t mask = m_slots.size() - 1;
+        std::size_t index = slot.m_hash & mask;
+        while (m_slots[index].m_data)
+        {
+            index = (index + 1) & mask;
+        }
+        m_slots[index] = std::move(slot);
+    }
+
+    /**
+     * Rebuild the table with a new number of slots
+     * \param slots the number of slots, a power of two
+     */
+    void Resize(std::size_t slots)
+    {
+        std::vector<PathSlot> old(slots);
+        old.swap(m_slots);
+        for (auto& slot : old)
+        {
+            if (slot.m_data)
             {
-                return std::min(m_dstMobility, m_srcMobility) <
-                       std::min(other.m_dstMobility, other.m_srcMobility);
+                Insert(std::move(slot));
             }
-            if (std::max(m_dstMobility, m_srcMobility) !=
-                std::max(other.m_dstMobility, other.m_srcMobility))
+        }
+        m_hand = 0;
+    }
+
+    /**
+     * \param slot a path
+     * \return true if the path was not looked up for longer than the time to live
+     */
+    bool IsExpired(const PathSlot& slot) const
+    {
+        return m_ttl.IsStrictlyPositive() && Simulator::Now() - slot.m_lastAccess > m_ttl;
+    }
+
+    /**
+     * Remove a path, and move back the following paths of its probe sequence
+     * \param index the index of the slot of the path
+     */
+    void Evict(std::size_t index)
+    {
+        m_slots[index].m_data->Dispose();
+        m_slots[index] = PathSlot();
+        m_size--;
+        std::size_t mask = m_slots.size() - 1;
+        for (std::size_t next = (index + 1) & mask; m_slots[next].m_data; next = (next + 1) & mask)
+        {
+            std::size_t home = m_slots[next].m_hash & mask;
+            // the path stays if its home slot is cyclically within (index, next]
+            bool stays = index <= next ? (index < home && home <= next)
+                                       : (index < home || home <= next);
+            if (!stays)
             {
-                return std::max(m_dstMobility, m_srcMobility) <
-                       std::max(other.m_dstMobility, other.m_srcMobility);
+                m_slots[index] = std::move(m_slots[next]);
+                m_slots[next] = PathSlot();
+                index = next;
             }
-            return false;
         }
-    };
+    }
 
-    /// Typedef: PropagationPathIdentifier, Ptr<T>
-    typedef std::map<PropagationPathIdentifier, Ptr<T>> PathCache;
+    /**
+     * Evict the first path reached by the clock hand which is expired or
+     * was not used since the hand last passed it
+     */
+    void EvictOne()
+    {
+        std::size_t mask = m_slots.size() - 1;
+        while (true)
+        {
+            PathSlot& slot = m_slots[m_hand];
+            if (slot.m_data)
+            {
+                if (!slot.m_referenced || IsExpired(slot))
+                {
+                    // the hand stays, as the next path may move back to it
+                    Evict(m_hand);
+                    return;
+                }
+                slot.m_referenced = false;
+            }
+            m_hand = (m_hand + 1) & mask;
+        }
+    }
 
-  private:
-    PathCache m_pathCache; //!< Path cache
+    /**
+     * Evict all the expired paths
+     */
+    void EvictExpired()
+    {
+        if (!m_ttl.IsStrictlyPositive())
+        {
+            return;
+        }
+        for (std::size_t index = 0; index < m_slots.size();)
+        {
+            if (m_slots[index].m_data && IsExpired(m_slots[index]))
+            {
+                // a following path may move back to this slot
+                Evict(index);
+            }
+            else
+            {
+                index++;
+            }
+        }
+    }
+
+    std::vector<PathSlot> m_slots; //!< The slots, whose number is a power of two
+    std::size_t m_size;            //!< The number of paths
+    std::size_t m_hand;            //!< The clock hand, for the eviction of the paths
+    std::size_t m_maxSize;         //!< The maximum number of paths, or 0
+    Time m_ttl;                    //!< The time to live of the paths, or zero
 };
 } // namespace ns3
 
@@ -82,6 +82,36 @@ PropagationLossModel::CalcRxPower(double txPowerDbm,
     return self;
 }
 
+void
+PropagationLossModel::CalcRxPowers(double txPowerDbm,
+                                   Ptr<MobilityModel> a,
+                                   const std::vector<Ptr<MobilityModel>>& b,
+                                   std::vector<double>& rxPowersDbm) const
+{
+    RxBatch batch{a, a->GetPosition(), b, {}, {}};
+    batch.bPositions.reserve(b.size());
+    batch.distances.reserve(b.size());
+    for (const auto& mobility : b)
+    {
+        batch.bPositions.push_back(mobility->GetPosition());
+        batch.distances.push_back(CalculateDistance(batch.aPosition, batch.bPositions.back()));
+    }
+    rxPowersDbm.assign(b.size(), txPowerDbm);
+    for (const PropagationLossModel* model = this; model; model = PeekPointer(model->m_next))
+    {
+        model->DoCalcRxPowers(batch, rxPowersDbm);
+    }
+}
+
+void
+PropagationLossModel::DoCalcRxPowers(const RxBatch& batch, std::vector<double>& powersDbm) const
+{
+    for (std::size_t i = 0; i < powersDbm.size(); i++)
+    {
+        powersDbm[i] = DoCalcRxPower(powersDbm[i], batch.a, batch.b[i]);
+    }
+}
+
 int64_t
 PropagationLossModel::AssignStreams(int64_t stream)
 {
@@ -281,6 +311,33 @@ FriisPropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return txPowerDbm - std::max(lossDb, m_minLoss);
 }
 
+void
+FriisPropagationLossModel::DoCalcRxPowers(const RxBatch& batch,
+                                          std::vector<double>& powersDbm) const
+{
+    for (double distance : batch.distances)
+    {
+        if (distance < 3 * m_lambda)
+        {
+            NS_LOG_WARN(
+                "distance not within the far field region => inaccurate propagation loss value");
+        }
+    }
+    // the members are read once, as the stores to the powers may alias them
+    const double numerator = m_lambda * m_lambda;
+    const double systemLoss = m_systemLoss;
+    const double minLoss = m_minLoss;
+    const double* distances = batch.distances.data();
+    double* powers = powersDbm.data();
+    for (std::size_t i = 0; i < powersDbm.size(); i++)
+    {
+        double distance = distances[i];
+        double denominator = 16 * M_PI * M_PI * distance * distance * systemLoss;
+        double lossDb = distance > 0 ? -10 * std::log10(numerator / denominator) : minLoss;
+        powers[i] -= std::max(lossDb, minLoss);
+    }
+}
+
 int64_t
 FriisPropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -462,6 +519,35 @@ TwoRayGroundPropagationLossModel::DoCalcRxPower(double txPowerDbm,
     }
 }
 
+void
+TwoRayGroundPropagationLossModel::DoCalcRxPowers(const RxBatch& batch,
+                                                 std::vector<double>& powersDbm) const
+{
+    const double txAntHeight = batch.aPosition.z + m_heightAboveZ;
+    const double heightAboveZ = m_heightAboveZ;
+    const double lambda = m_lambda;
+    const double systemLoss = m_systemLoss;
+    const double minDistance = m_minDistance;
+    const double* distances = batch.distances.data();
+    const Vector* positions = batch.bPositions.data();
+    double* powers = powersDbm.data();
+    for (std::size_t i = 0; i < powersDbm.size(); i++)
+    {
+        // same formulas as DoCalcRxPower, with a single logarithm per destination
+        double distance = distances[i];
+        double rxAntHeight = positions[i].z + heightAboveZ;
+        double dCross = (4 * M_PI * txAntHeight * rxAntHeight) / lambda;
+        double tmp = M_PI * distance;
+        double friisRatio = (lambda * lambda) / (16 * tmp * tmp * systemLoss);
+        tmp = txAntHeight * rxAntHeight;
+        double rayNumerator = tmp * tmp;
+        tmp = distance * distance;
+        double rayRatio = rayNumerator / (tmp * tmp * systemLoss);
+        double pr = 10 * std::log10(distance <= dCross ? friisRatio : rayRatio);
+        powers[i] += distance <= minDistance ? 0 : pr;
+    }
+}
+
 int64_t
 TwoRayGroundPropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -554,6 +640,23 @@ LogDistancePropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return txPowerDbm + rxc;
 }
 
+void
+LogDistancePropagationLossModel::DoCalcRxPowers(const RxBatch& batch,
+                                                std::vector<double>& powersDbm) const
+{
+    const double exponent = m_exponent;
+    const double referenceDistance = m_referenceDistance;
+    const double referenceLoss = m_referenceLoss;
+    const double* distances = batch.distances.data();
+    double* powers = powersDbm.data();
+    for (std::size_t i = 0; i < powersDbm.size(); i++)
+    {
+        double distance = distances[i];
+        double pathLossDb = 10 * exponent * std::log10(distance / referenceDistance);
+        powers[i] += distance <= referenceDistance ? -referenceLoss : -referenceLoss - pathLossDb;
+    }
+}
+
 int64_t
 LogDistancePropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -653,6 +756,36 @@ ThreeLogDistancePropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return txPowerDbm - pathLossDb;
 }
 
+void
+ThreeLogDistancePropagationLossModel::DoCalcRxPowers(const RxBatch& batch,
+                                                     std::vector<double>& powersDbm) const
+{
+    // the loss at the start of each field, summed in the order of DoCalcRxPower
+    const double loss1 = m_referenceLoss;
+    const double loss2 = loss1 + 10 * m_exponent0 * std::log10(m_distance1 / m_distance0);
+    const double loss3 = loss2 + 10 * m_exponent1 * std::log10(m_distance2 / m_distance1);
+    const double distance0 = m_distance0;
+    const double distance1 = m_distance1;
+    const double distance2 = m_distance2;
+    const double exponent0 = m_exponent0;
+    const double exponent1 = m_exponent1;
+    const double exponent2 = m_exponent2;
+    const double* distances = batch.distances.data();
+    double* powers = powersDbm.data();
+    for (std::size_t i = 0; i < powersDbm.size(); i++)
+    {
+        // select the field, then evaluate a single logarithm
+        double distance = distances[i];
+        bool inField1 = distance < distance1;
+        bool inField2 = distance < distance2;
+        double start = inField1 ? distance0 : (inField2 ? distance1 : distance2);
+        double exponent = inField1 ? exponent0 : (inField2 ? exponent1 : exponent2);
+        double loss = inField1 ? loss1 : (inField2 ? loss2 : loss3);
+        double pathLossDb = loss + 10 * exponent * std::log10(distance / start);
+        powers[i] -= distance < distance0 ? 0 : pathLossDb;
+    }
+}
+
 int64_t
 ThreeLogDistancePropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -719,10 +852,26 @@ double
 NakagamiPropagationLossModel::DoCalcRxPower(double txPowerDbm,
                                             Ptr<MobilityModel> a,
                                             Ptr<MobilityModel> b) const
+{
+    return GetRxPower(txPowerDbm, a->GetDistanceFrom(b));
+}
+
+void
+NakagamiPropagationLossModel::DoCalcRxPowers(const RxBatch& batch,
+                                             std::vector<double>& powersDbm) const
+{
+    // the variables are drawn in the order of the destinations, as by DoCalcRxPower
+    for (std::size_t i = 0; i < powersDbm.size(); i++)
+    {
+        powersDbm[i] = GetRxPower(powersDbm[i], batch.distances[i]);
+    }
+}
+
+double
+NakagamiPropagationLossModel::GetRxPower(double txPowerDbm, double distance) const
 {
     // select m parameter
 
-    double distance = a->GetDistanceFrom(b);
     NS_ASSERT(distance >= 0);
 
     double m;
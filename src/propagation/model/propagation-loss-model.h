@@ -26,8 +26,10 @@
 
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/vector.h"
 
 #include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -101,6 +103,26 @@ class PropagationLossModel : public Object
      */
     double CalcRxPower(double txPowerDbm, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
 
+    /**
+     * Returns the Rx Powers of a transmission to several destinations, taking
+     * into account all the PropagationLossModel(s) chained to the current one.
+     *
+     * Each model of the chain is applied to all the destinations before the
+     * next one, so that the models can evaluate their loss in a single loop
+     * over the distances, which the source position is subtracted from once.
+     * The result is that of CalcRxPower for each destination in turn, as long
+     * as the models of the chain do not share their random variables.
+     *
+     * \param txPowerDbm current transmission power (in dBm)
+     * \param a the mobility model of the source
+     * \param b the mobility models of the destinations
+     * \param [out] rxPowersDbm the reception power at each destination (in dBm)
+     */
+    void CalcRxPowers(double txPowerDbm,
+                      Ptr<MobilityModel> a,
+                      const std::vector<Ptr<MobilityModel>>& b,
+                      std::vector<double>& rxPowersDbm) const;
+
     /**
      * If this loss model uses objects of type RandomVariableStream,
      * set the stream numbers to the integers starting with the offset
@@ -115,6 +137,16 @@ class PropagationLossModel : public Object
     int64_t AssignStreams(int64_t stream);
 
   protected:
+    /// The geometry of a transmission to several destinations
+    struct RxBatch
+    {
+        Ptr<MobilityModel> a;                     //!< The mobility model of the source
+        Vector aPosition;                         //!< The position of the source
+        const std::vector<Ptr<MobilityModel>>& b; //!< The mobility models of the destinations
+        std::vector<Vector> bPositions;           //!< The position of each destination
+        std::vector<double> distances;            //!< The distance to each destination (m)
+    };
+
     /**
      * Assign a fixed random variable stream number to the random variables used by this model.
      *
@@ -139,6 +171,18 @@ class PropagationLossModel : public Object
                                  Ptr<MobilityModel> a,
                                  Ptr<MobilityModel> b) const = 0;
 
+    /**
+     * Applies the loss of this model to a transmission to several destinations.
+     *
+     * The default implementation calls DoCalcRxPower for each destination in
+     * turn.
+     *
+     * \param batch the geometry of the transmission
+     * \param [in,out] powersDbm the power at each destination, before and
+     * after the loss (in dBm)
+     */
+    virtual void DoCalcRxPowers(const RxBatch& batch, std::vector<double>& powersDbm) const;
+
     Ptr<PropagationLossModel> m_next; //!< Next propagation loss model in the list
 };
 
@@ -303,6 +347,7 @@ class FriisPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowers(const RxBatch& batch, std::vector<double>& powersDbm) const override;
     int64_t DoAssignStreams(int64_t stream) override;
 
     /**
@@ -413,6 +458,7 @@ class TwoRayGroundPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowers(const RxBatch& batch, std::vector<double>& powersDbm) const override;
     int64_t DoAssignStreams(int64_t stream) override;
 
     /**
@@ -491,6 +537,7 @@ class LogDistancePropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowers(const RxBatch& batch, std::vector<double>& powersDbm) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
@@ -567,6 +614,7 @@ class ThreeLogDistancePropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowers(const RxBatch& batch, std::vector<double>& powersDbm) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
@@ -630,6 +678,14 @@ class NakagamiPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowers(const RxBatch& batch, std::vector<double>& powersDbm) const override;
+
+    /**
+     * \param txPowerDbm current transmission power (in dBm)
+     * \param distance the distance between the source and the destination (m)
+     * \returns the reception power after the fading (in dBm)
+     */
+    double GetRxPower(double txPowerDbm, double distance) const;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
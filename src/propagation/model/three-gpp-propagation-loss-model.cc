@@ -150,7 +150,28 @@ ThreeGppPropagationLossModel::DoCalcRxPower(double txPowerDbm,
                                             Ptr<MobilityModel> b) const
 {
     NS_LOG_FUNCTION(this);
+    return GetRxPower(txPowerDbm, a, b, a->GetPosition(), b->GetPosition());
+}
+
+void
+ThreeGppPropagationLossModel::DoCalcRxPowers(const RxBatch& batch,
+                                             std::vector<double>& powersDbm) const
+{
+    NS_LOG_FUNCTION(this);
+    for (std::size_t i = 0; i < powersDbm.size(); i++)
+    {
+        powersDbm[i] =
+            GetRxPower(powersDbm[i], batch.a, batch.b[i], batch.aPosition, batch.bPositions[i]);
+    }
+}
 
+double
+ThreeGppPropagationLossModel::GetRxPower(double txPowerDbm,
+                                         Ptr<MobilityModel> a,
+                                         Ptr<MobilityModel> b,
+                                         const Vector& aPosition,
+                                         const Vector& bPosition) const
+{
     // check if the model is initialized
     NS_ASSERT_MSG(m_frequency != 0.0, "First set the centre frequency");
 
@@ -159,13 +180,13 @@ ThreeGppPropagationLossModel::DoCalcRxPower(double txPowerDbm,
     Ptr<ChannelCondition> cond = m_channelConditionModel->GetChannelCondition(a, b);
 
     // compute the 2D distance between a and b
-    double distance2d = Calculate2dDistance(a->GetPosition(), b->GetPosition());
+    double distance2d = Calculate2dDistance(aPosition, bPosition);
 
     // compute the 3D distance between a and b
-    double distance3d = CalculateDistance(a->GetPosition(), b->GetPosition());
+    double distance3d = CalculateDistance(aPosition, bPosition);
 
     // compute hUT and hBS
-    std::pair<double, double> heights = GetUtAndBsHeights(a->GetPosition().z, b->GetPosition().z);
+    std::pair<double, double> heights = GetUtAndBsHeights(aPosition.z, bPosition.z);
 
     double rxPow = txPowerDbm;
     rxPow -= GetLoss(cond, distance2d, distance3d, heights.first, heights.second);
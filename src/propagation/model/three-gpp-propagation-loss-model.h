@@ -92,6 +92,31 @@ class ThreeGppPropagationLossModel : public PropagationLossModel
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
 
+    /**
+     * Computes the received power at several destinations, with the position
+     * of the source fetched once for all of them.
+     *
+     * \param batch the geometry of the transmission
+     * \param [in,out] powersDbm the tx power, then the rx power, of each destination in dBm
+     */
+    void DoCalcRxPowers(const RxBatch& batch, std::vector<double>& powersDbm) const override;
+
+    /**
+     * Computes the received power given the positions of a and b.
+     *
+     * \param txPowerDbm tx power in dBm
+     * \param a tx mobility model
+     * \param b rx mobility model
+     * \param aPosition the position of a
+     * \param bPosition the position of b
+     * \return the rx power in dBm
+     */
+    double GetRxPower(double txPowerDbm,
+                      Ptr<MobilityModel> a,
+                      Ptr<MobilityModel> b,
+                      const Vector& aPosition,
+                      const Vector& bPosition) const;
+
     int64_t DoAssignStreams(int64_t stream) override;
 
     /**
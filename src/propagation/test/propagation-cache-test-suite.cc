@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/object.h"
+#include "ns3/propagation-cache.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <map>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief PropagationCache Test: the paths are found as in a std::map, with
+ * and without eviction
+ */
+class PropagationCacheTestCase : public TestCase
+{
+  public:
+    PropagationCacheTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that the paths are found as in a std::map, across insertions and evictions
+     */
+    void CheckAgainstMap();
+    /**
+     * Check that the size of the cache is capped, and that the paths in use survive
+     */
+    void CheckMaxSize();
+    /**
+     * Check the expiration of the paths which are not used
+     */
+    void CheckTimeToLive();
+
+    std::vector<Ptr<MobilityModel>> m_models; //!< The mobility models of the paths
+};
+
+PropagationCacheTestCase::PropagationCacheTestCase()
+    : TestCase("Check the lookup and the eviction of the paths of the PropagationCache")
+{
+}
+
+void
+PropagationCacheTestCase::CheckAgainstMap()
+{
+    PropagationCache<Object> cache;
+    std::map<std::pair<uint32_t, uint32_t>, Ptr<Object>> expected;
+    uint32_t n = m_models.size();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        for (uint32_t j = i; j < n; j += 3)
+        {
+            Ptr<Object> data = CreateObject<Object>();
+            cache.AddPathData(data, m_models[i], m_models[j], i % 2);
+            expected[{i, j}] = data;
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), expected.size(), "Unexpected number of paths");
+    for (uint32_t i = 0; i < n; i++)
+    {
+        for (uint32_t j = 0; j < n; j++)
+        {
+            auto it = expected.find({std::min(i, j), std::max(i, j)});
+            uint32_t uid = std::min(i, j) % 2;
+            Ptr<Object> data = cache.GetPathData(m_models[i], m_models[j], uid);
+            NS_TEST_EXPECT_MSG_EQ(data,
+                                  (it == expected.end() ? nullptr : it->second),
+                                  "Unexpected path data for " << i << " and " << j);
+            NS_TEST_EXPECT_MSG_EQ(cache.GetPathData(m_models[i], m_models[j], uid + 2),
+                                  nullptr,
+                                  "Unexpected path data for another model uid");
+        }
+    }
+    cache.Cleanup();
+    NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), 0, "Paths left after the cleanup");
+    NS_TEST_EXPECT_MSG_EQ(cache.GetPathData(m_models[0], m_models[0], 0),
+                          nullptr,
+                          "Path found after the cleanup");
+}
+
+void
+PropagationCacheTestCase::CheckMaxSize()
+{
+    PropagationCache<Object> cache;
+    cache.SetMaxSize(50);
+    // the paths from the first model are used before each insertion
+    uint32_t n = m_models.size();
+    for (uint32_t i = 1; i < 10; i++)
+    {
+        cache.AddPathData(CreateObject<Object>(), m_models[0], m_models[i], 0);
+    }
+    for (uint32_t i = 1; i < n; i++)
+    {
+        for (uint32_t j = 1; j < 10; j++)
+        {
+            cache.GetPathData(m_models[0], m_models[j], 0);
+        }
+        for (uint32_t j = i; j < n; j += 7)
+        {
+            cache.AddPathData(CreateObject<Object>(), m_models[i], m_models[j], 0);
+            NS_TEST_EXPECT_MSG_EQ((cache.GetSize() <= 50), true, "Too many paths");
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), 50, "Unexpected number of paths");
+    for (uint32_t j = 1; j < 10; j++)
+    {
+        NS_TEST_EXPECT_MSG_NE(cache.GetPathData(m_models[j], m_models[0], 0),
+                              nullptr,
+                              "Path in use evicted");
+    }
+    cache.SetMaxSize(5);
+    NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), 5, "Unexpected number of paths");
+    cache.Cleanup();
+}
+
+void
+PropagationCacheTestCase::CheckTimeToLive()
+{
+    PropagationCache<Object> cache;
+    cache.SetTimeToLive(Seconds(10));
+    Ptr<Object> used = CreateObject<Object>();
+    cache.AddPathData(used, m_models[0], m_models[1], 0);
+    cache.AddPathData(CreateObject<Object>(), m_models[0], m_models[2], 0);
+    for (uint32_t i = 1; i <= 3; i++)
+    {
+        Simulator::Schedule(Seconds(6 * i), [&cache, used, this]() {
+            NS_TEST_EXPECT_MSG_EQ(cache.GetPathData(m_models[1], m_models[0], 0),
+                                  used,
+                                  "Path in use expired");
+        });
+    }
+    Simulator::Schedule(Seconds(30), [&cache, this]() {
+        NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), 2, "Expired path evicted before use");
+        NS_TEST_EXPECT_MSG_EQ(cache.GetPathData(m_models[0], m_models[2], 0),
+                              nullptr,
+                              "Path not expired");
+        NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), 1, "Expired path not evicted");
+    });
+    Simulator::Run();
+    Simulator::Destroy();
+    cache.Cleanup();
+}
+
+void
+PropagationCacheTestCase::DoRun()
+{
+    for (uint32_t i = 0; i < 200; i++)
+    {
+        m_models.push_back(CreateObject<ConstantPositionMobilityModel>());
+    }
+    CheckAgainstMap();
+    CheckMaxSize();
+    CheckTimeToLive();
+    m_models.clear();
+}
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief PropagationCache TestSuite
+ */
+class PropagationCacheTestSuite : public TestSuite
+{
+  public:
+    PropagationCacheTestSuite();
+};
+
+PropagationCacheTestSuite::PropagationCacheTestSuite()
+    : TestSuite("propagation-cache", UNIT)
+{
+    AddTestCase(new PropagationCacheTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static PropagationCacheTestSuite g_propagationCacheTestSuite;
@@ -16,13 +16,18 @@
  */
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/cached-propagation-loss-model.h"
+#include "ns3/channel-condition-model.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/three-gpp-propagation-loss-model.h"
 
 using namespace ns3;
 
@@ -489,6 +494,217 @@ RangePropagationLossModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief CachedPropagationLossModel Test
+ */
+class CachedPropagationLossModelTestCase : public TestCase
+{
+  public:
+    CachedPropagationLossModelTestCase();
+    ~CachedPropagationLossModelTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the loss of the cached model against the loss of the wrapped model
+     * \param hits the expected number of hits
+     * \param misses the expected number of misses
+     */
+    void CheckLoss(uint64_t hits, uint64_t misses);
+
+    Ptr<MobilityModel> m_a;                      //!< The static node
+    Ptr<MobilityModel> m_b;                      //!< The moving node
+    Ptr<LogDistancePropagationLossModel> m_loss; //!< The wrapped model
+    Ptr<CachedPropagationLossModel> m_cache;     //!< The cached model
+};
+
+CachedPropagationLossModelTestCase::CachedPropagationLossModelTestCase()
+    : TestCase("Test CachedPropagationLossModel")
+{
+}
+
+CachedPropagationLossModelTestCase::~CachedPropagationLossModelTestCase()
+{
+}
+
+void
+CachedPropagationLossModelTestCase::CheckLoss(uint64_t hits, uint64_t misses)
+{
+    double txPowerDbm = 20;
+    double expected = m_loss->CalcRxPower(txPowerDbm, m_a, m_b);
+    double rxPowerDbm = m_cache->CalcRxPower(txPowerDbm, m_a, m_b);
+    NS_TEST_EXPECT_MSG_EQ_TOL(rxPowerDbm, expected, 0.1, "Got unexpected rcv power");
+    NS_TEST_EXPECT_MSG_EQ(m_cache->GetNHits(), hits, "Unexpected number of hits");
+    NS_TEST_EXPECT_MSG_EQ(m_cache->GetNMisses(), misses, "Unexpected number of misses");
+}
+
+void
+CachedPropagationLossModelTestCase::DoRun()
+{
+    m_a = CreateObject<ConstantPositionMobilityModel>();
+    m_a->SetPosition(Vector(0, 0, 0));
+    Ptr<ConstantVelocityMobilityModel> b = CreateObject<ConstantVelocityMobilityModel>();
+    b->SetPosition(Vector(100, 0, 0));
+    m_b = b;
+
+    m_loss = CreateObject<LogDistancePropagationLossModel>();
+    m_cache = CreateObject<CachedPropagationLossModel>();
+    m_cache->SetPropagationLossModel(m_loss);
+    m_cache->SetAttribute("PositionTolerance", DoubleValue(1));
+
+    // the first loss is computed, and then found while the nodes stand still
+    CheckLoss(0, 1);
+    CheckLoss(1, 1);
+    Simulator::Schedule(Seconds(1), &CachedPropagationLossModelTestCase::CheckLoss, this, 2, 1);
+
+    // a position change is a course change
+    Simulator::Schedule(Seconds(2), &MobilityModel::SetPosition, m_a, Vector(0, 50, 0));
+    Simulator::Schedule(Seconds(2), &CachedPropagationLossModelTestCase::CheckLoss, this, 2, 2);
+
+    // the moving node moves by 0.5 m, then 1.5 m, from the cached position
+    Simulator::Schedule(Seconds(3),
+                        &ConstantVelocityMobilityModel::SetVelocity,
+                        b,
+                        Vector(10, 0, 0));
+    Simulator::Schedule(Seconds(3), &CachedPropagationLossModelTestCase::CheckLoss, this, 2, 3);
+    Simulator::Schedule(Seconds(3.05),
+                        &CachedPropagationLossModelTestCase::CheckLoss,
+                        this,
+                        3,
+                        3);
+    Simulator::Schedule(Seconds(3.15),
+                        &CachedPropagationLossModelTestCase::CheckLoss,
+                        this,
+                        3,
+                        4);
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief PropagationLossModel::CalcRxPowers Test
+ *
+ * Checks that the batch computation of the rx powers gives the rx powers
+ * computed one destination at a time.
+ */
+class BatchPropagationLossModelTestCase : public TestCase
+{
+  public:
+    BatchPropagationLossModelTestCase();
+    ~BatchPropagationLossModelTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the batch rx powers of a model against its rx powers
+     * \param scalar the model whose rx powers are computed one at a time
+     * \param batch the model whose rx powers are computed in a batch, which
+     * may be the same as scalar if the model does not draw random variables
+     */
+    void CheckBatch(Ptr<PropagationLossModel> scalar, Ptr<PropagationLossModel> batch);
+
+    Ptr<MobilityModel> m_a;              //!< The source
+    std::vector<Ptr<MobilityModel>> m_b; //!< The destinations
+};
+
+BatchPropagationLossModelTestCase::BatchPropagationLossModelTestCase()
+    : TestCase("Test PropagationLossModel::CalcRxPowers")
+{
+}
+
+BatchPropagationLossModelTestCase::~BatchPropagationLossModelTestCase()
+{
+}
+
+void
+BatchPropagationLossModelTestCase::CheckBatch(Ptr<PropagationLossModel> scalar,
+                                              Ptr<PropagationLossModel> batch)
+{
+    double txPowerDbm = 20;
+    std::vector<double> rxPowersDbm;
+    std::vector<double> expected;
+    for (const auto& b : m_b)
+    {
+        expected.push_back(scalar->CalcRxPower(txPowerDbm, m_a, b));
+    }
+    batch->CalcRxPowers(txPowerDbm, m_a, m_b, rxPowersDbm);
+    NS_TEST_ASSERT_MSG_EQ(rxPowersDbm.size(), m_b.size(), "Unexpected number of rx powers");
+    for (std::size_t i = 0; i < m_b.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(rxPowersDbm[i],
+                                  expected[i],
+                                  1e-9,
+                                  "Unexpected rcv power of " << batch->GetInstanceTypeId()
+                                                             << " at destination " << i);
+    }
+}
+
+void
+BatchPropagationLossModelTestCase::DoRun()
+{
+    m_a = CreateObject<ConstantPositionMobilityModel>();
+    m_a->SetPosition(Vector(0, 0, 10));
+    // the destinations span the distance fields of the models, from null distance
+    for (double x : {0.0, 0.1, 1.0, 5.0, 40.0, 80.0, 150.0, 199.0, 250.0, 500.0, 1e3, 5e3})
+    {
+        Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel>();
+        b->SetPosition(Vector(x, 0, x == 0 ? 10 : 1.5));
+        m_b.push_back(b);
+    }
+
+    Ptr<FriisPropagationLossModel> friis = CreateObject<FriisPropagationLossModel>();
+    friis->SetMinLoss(30);
+    CheckBatch(friis, friis);
+
+    Ptr<TwoRayGroundPropagationLossModel> twoRay =
+        CreateObject<TwoRayGroundPropagationLossModel>();
+    twoRay->SetMinDistance(0.5);
+    CheckBatch(twoRay, twoRay);
+
+    Ptr<LogDistancePropagationLossModel> logDistance =
+        CreateObject<LogDistancePropagationLossModel>();
+    CheckBatch(logDistance, logDistance);
+
+    Ptr<ThreeLogDistancePropagationLossModel> threeLogDistance =
+        CreateObject<ThreeLogDistancePropagationLossModel>();
+    CheckBatch(threeLogDistance, threeLogDistance);
+
+    // the default implementation, chained to a model which overrides it
+    Ptr<RangePropagationLossModel> range = CreateObject<RangePropagationLossModel>();
+    range->SetAttribute("MaxRange", DoubleValue(300));
+    range->SetNext(threeLogDistance);
+    CheckBatch(range, range);
+
+    // the random variables are drawn in the same order
+    Ptr<PropagationLossModel> nakagami[2];
+    for (auto& model : nakagami)
+    {
+        model = CreateObject<LogDistancePropagationLossModel>();
+        model->SetNext(CreateObject<NakagamiPropagationLossModel>());
+        model->AssignStreams(1);
+    }
+    CheckBatch(nakagami[0], nakagami[1]);
+
+    for (Ptr<ChannelConditionModel> condition :
+         {Ptr<ChannelConditionModel>(CreateObject<AlwaysLosChannelConditionModel>()),
+          Ptr<ChannelConditionModel>(CreateObject<NeverLosChannelConditionModel>())})
+    {
+        Ptr<ThreeGppPropagationLossModel> threeGpp =
+            CreateObject<ThreeGppUmiStreetCanyonPropagationLossModel>();
+        threeGpp->SetAttribute("ShadowingEnabled", BooleanValue(false));
+        threeGpp->SetChannelConditionModel(condition);
+        threeGpp->SetFrequency(3.5e9);
+        CheckBatch(threeGpp, threeGpp);
+    }
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup propagation-tests
  *
@@ -500,6 +716,9 @@ RangePropagationLossModelTestCase::DoRun()
  *   - LogDistancePropagationLossModel
  *   - MatrixPropagationLossModel
  *   - RangePropagationLossModel
+ *   - CachedPropagationLossModel
+ *   - The batch computation of the rx powers of the above, and of the
+ *     ThreeLogDistance, Nakagami and ThreeGpp models
  */
 class PropagationLossModelsTestSuite : public TestSuite
 {
@@ -515,6 +734,8 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite()
     AddTestCase(new LogDistancePropagationLossModelTestCase, TestCase::QUICK);
     AddTestCase(new MatrixPropagationLossModelTestCase, TestCase::QUICK);
     AddTestCase(new RangePropagationLossModelTestCase, TestCase::QUICK);
+    AddTestCase(new CachedPropagationLossModelTestCase, TestCase::QUICK);
+    AddTestCase(new BatchPropagationLossModelTestCase, TestCase::QUICK);
 }
 
 /// Static variable for test initialization
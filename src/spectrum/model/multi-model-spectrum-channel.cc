@@ -32,6 +32,7 @@
 #include <ns3/propagation-delay-model.h>
 #include <ns3/propagation-loss-model.h>
 #include <ns3/simulator.h>
+#include <ns3/spatial-grid.h>
 #include <ns3/spectrum-converter.h>
 #include <ns3/spectrum-phy.h>
 #include <ns3/spectrum-propagation-loss-model.h>
@@ -80,7 +81,9 @@ RxSpectrumModelInfo::RxSpectrumModelInfo(Ptr<const SpectrumModel> rxSpectrumMode
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel()
-    : m_numDevices{0}
+    : m_numDevices{0},
+      m_maxRange{0},
+      m_numAdded{0}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -91,18 +94,28 @@ MultiModelSpectrumChannel::DoDispose()
     NS_LOG_FUNCTION(this);
     m_txSpectrumModelInfoMap.clear();
     m_rxSpectrumModelInfoMap.clear();
+    m_grid = nullptr;
+    m_indexedPhys.clear();
+    m_phyIds.clear();
+    m_rxRanks.clear();
     SpectrumChannel::DoDispose();
 }
 
 TypeId
 MultiModelSpectrumChannel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::MultiModelSpectrumChannel")
-                            .SetParent<SpectrumChannel>()
-                            .SetGroupName("Spectrum")
-                            .AddConstructor<MultiModelSpectrumChannel>()
-
-        ;
+    static TypeId tid =
+        TypeId("ns3::MultiModelSpectrumChannel")
+            .SetParent<SpectrumChannel>()
+            .SetGroupName("Spectrum")
+            .AddConstructor<MultiModelSpectrumChannel>()
+            .AddAttribute("MaxRange",
+                          "The distance, in meters, beyond which the signals are not delivered, "
+                          "so that the receivers are looked up in a spatial index instead of "
+                          "all being visited. The value 0 means no limit.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&MultiModelSpectrumChannel::m_maxRange),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
@@ -129,6 +142,16 @@ MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
             break; // there should be at most one entry
         }
     }
+
+    auto id = m_phyIds.find(PeekPointer(phy));
+    if (id != m_phyIds.end() && m_indexedPhys[id->second])
+    {
+        m_indexedPhys[id->second] = nullptr;
+        if (m_grid)
+        {
+            m_grid->Remove(id->second);
+        }
+    }
 }
 
 void
@@ -155,6 +178,23 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     // prevented insertion. In both cases, add the phy to the element pointed to by rxInfoIterator
     rxInfoIterator->second.m_rxPhys.push_back(phy);
 
+    // the id of a receiver is kept when it is removed, and reused when it is added again
+    auto [id, newId] = m_phyIds.emplace(PeekPointer(phy), m_indexedPhys.size());
+    if (newId)
+    {
+        m_indexedPhys.push_back(phy);
+    }
+    else
+    {
+        m_indexedPhys[id->second] = phy;
+    }
+    m_rxRanks.resize(m_indexedPhys.size());
+    m_rxRanks[id->second] = {rxSpectrumModelUid, m_numAdded++};
+    if (m_grid)
+    {
+        m_grid->Add(id->second, phy->GetMobility());
+    }
+
     if (inserted)
     {
         // create the necessary converters for all the TX spectrum models that we know of
@@ -256,6 +296,13 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     NS_LOG_LOGIC("converter map first element: "
                  << txInfoIteratorerator->second.m_spectrumConverterMap.begin()->first);
 
+    if (m_maxRange > 0 && txMobility)
+    {
+        StartTxWithinRange(txParams, txMobility, txInfoIteratorerator->second);
+        ScheduleSelectedRx(txParams, txMobility);
+        return;
+    }
+
     for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin();
          rxInfoIterator != m_rxSpectrumModelInfoMap.end();
          ++rxInfoIterator)
@@ -291,107 +338,200 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                           "SpectrumModel change was not notified to MultiModelSpectrumChannel "
                           "(i.e., AddRx should be called again after model is changed)");
 
-            if ((*rxPhyIterator) != txParams->txPhy)
+            SelectRx(txParams, convertedTxPowerSpectrum, *rxPhyIterator);
+        }
+    }
+    ScheduleSelectedRx(txParams, txMobility);
+}
+
+void
+MultiModelSpectrumChannel::SelectRx(Ptr<SpectrumSignalParameters> txParams,
+                                    Ptr<SpectrumValue> convertedTxPowerSpectrum,
+                                    Ptr<SpectrumPhy> rxPhy)
+{
+    if (rxPhy == txParams->txPhy)
+    {
+        return;
+    }
+    Ptr<NetDevice> rxNetDevice = rxPhy->GetDevice();
+    Ptr<NetDevice> txNetDevice = txParams->txPhy->GetDevice();
+
+    if (rxNetDevice && txNetDevice)
+    {
+        // we assume that devices are attached to a node
+        if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
+        {
+            NS_LOG_DEBUG("Skipping the pathloss calculation among different antennas of the "
+                         "same node, not supported yet by any pathloss model in ns-3.");
+            return;
+        }
+    }
+    m_selectedRx.push_back({rxPhy, convertedTxPowerSpectrum, rxPhy->GetMobility()});
+}
+
+void
+MultiModelSpectrumChannel::ScheduleSelectedRx(Ptr<SpectrumSignalParameters> txParams,
+                                              Ptr<MobilityModel> txMobility)
+{
+    // the propagation gains of all the receivers are computed at once
+    m_rxMobilities.clear();
+    bool computed = txMobility && m_propagationLoss;
+    if (computed)
+    {
+        for (const auto& rx : m_selectedRx)
+        {
+            if (rx.mobility)
+            {
+                m_rxMobilities.push_back(rx.mobility);
+            }
+        }
+        m_propagationLoss->CalcRxPowers(0, txMobility, m_rxMobilities, m_propagationGainsDb);
+    }
+    std::size_t gain = 0;
+    for (const auto& rx : m_selectedRx)
+    {
+        double propagationGainDb = computed && rx.mobility ? m_propagationGainsDb[gain++] : 0;
+        ScheduleRx(txParams, txMobility, rx.psd, rx.phy, rx.mobility, propagationGainDb);
+    }
+    m_selectedRx.clear();
+}
+
+void
+MultiModelSpectrumChannel::ScheduleRx(Ptr<SpectrumSignalParameters> txParams,
+                                      Ptr<MobilityModel> txMobility,
+                                      Ptr<SpectrumValue> convertedTxPowerSpectrum,
+                                      Ptr<SpectrumPhy> rxPhy,
+                                      Ptr<MobilityModel> receiverMobility,
+                                      double propagationGainDb)
+{
+    Ptr<NetDevice> rxNetDevice = rxPhy->GetDevice();
+    Time delay = MicroSeconds(0);
+    double pathGainLinear = 1;
+
+    if (txMobility && receiverMobility)
+    {
+        double txAntennaGain = 0;
+        double rxAntennaGain = 0;
+        double pathLossDb = 0;
+        if (txParams->txAntenna)
+        {
+            Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
+            txAntennaGain = txParams->txAntenna->GetGainDb(txAngles);
+            NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
+            pathLossDb -= txAntennaGain;
+        }
+        Ptr<AntennaModel> rxAntenna = DynamicCast<AntennaModel>(rxPhy->GetAntenna());
+        if (rxAntenna)
+        {
+            Angles rxAngles(txMobility->GetPosition(), receiverMobility->GetPosition());
+            rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
+            NS_LOG_LOGIC("rxAntennaGain = " << rxAntennaGain << " dB");
+            pathLossDb -= rxAntennaGain;
+        }
+        if (m_propagationLoss)
+        {
+            NS_LOG_LOGIC("propagationGainDb = " << propagationGainDb << " dB");
+            pathLossDb -= propagationGainDb;
+        }
+        NS_LOG_LOGIC("total pathLoss = " << pathLossDb << " dB");
+        // Gain trace
+        m_gainTrace(txMobility,
+                    receiverMobility,
+                    txAntennaGain,
+                    rxAntennaGain,
+                    propagationGainDb,
+                    pathLossDb);
+        // Pathloss trace
+        m_pathLossTrace(txParams->txPhy, rxPhy, pathLossDb);
+        if (pathLossDb > m_maxLossDb)
+        {
+            // beyond range
+            return;
+        }
+        pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
+
+        if (m_propagationDelay)
+        {
+            delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
+        }
+    }
+
+    // the parameters are only copied for the receivers within range
+    NS_LOG_LOGIC("copying signal parameters " << txParams);
+    Ptr<SpectrumSignalParameters> rxParams = txParams->Copy();
+    rxParams->psd = Copy<SpectrumValue>(convertedTxPowerSpectrum);
+    if (pathGainLinear != 1)
+    {
+        *(rxParams->psd) *= pathGainLinear;
+    }
+
+    if (rxNetDevice)
+    {
+        // the receiver has a NetDevice, so we expect that it is attached to a Node
+        uint32_t dstNode = rxNetDevice->GetNode()->GetId();
+        Simulator::ScheduleWithContext(dstNode,
+                                       delay,
+                                       &MultiModelSpectrumChannel::StartRx,
+                                       this,
+                                       rxParams,
+                                       rxPhy);
+    }
+    else
+    {
+        // the receiver is not attached to a NetDevice, so we cannot assume that it is
+        // attached to a node
+        Simulator::Schedule(delay, &MultiModelSpectrumChannel::StartRx, this, rxParams, rxPhy);
+    }
+}
+
+void
+MultiModelSpectrumChannel::StartTxWithinRange(Ptr<SpectrumSignalParameters> txParams,
+                                              Ptr<MobilityModel> txMobility,
+                                              const TxSpectrumModelInfo& txInfo)
+{
+    NS_LOG_FUNCTION(this << txParams);
+    if (!m_grid)
+    {
+        // the receivers are indexed once they are all attached to their node
+        m_grid = Create<SpatialGrid>(m_maxRange);
+        for (uint32_t id = 0; id < m_indexedPhys.size(); id++)
+        {
+            if (m_indexedPhys[id])
             {
-                Ptr<NetDevice> rxNetDevice = (*rxPhyIterator)->GetDevice();
-                Ptr<NetDevice> txNetDevice = txParams->txPhy->GetDevice();
-
-                if (rxNetDevice && txNetDevice)
-                {
-                    // we assume that devices are attached to a node
-                    if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
-                    {
-                        NS_LOG_DEBUG(
-                            "Skipping the pathloss calculation among different antennas of the "
-                            "same node, not supported yet by any pathloss model in ns-3.");
-                        continue;
-                    }
-                }
-
-                NS_LOG_LOGIC("copying signal parameters " << txParams);
-                Ptr<SpectrumSignalParameters> rxParams = txParams->Copy();
-                rxParams->psd = Copy<SpectrumValue>(convertedTxPowerSpectrum);
-                Time delay = MicroSeconds(0);
-
-                Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility();
-
-                if (txMobility && receiverMobility)
-                {
-                    double txAntennaGain = 0;
-                    double rxAntennaGain = 0;
-                    double propagationGainDb = 0;
-                    double pathLossDb = 0;
-                    if (rxParams->txAntenna)
-                    {
-                        Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
-                        txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
-                        NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
-                        pathLossDb -= txAntennaGain;
-                    }
-                    Ptr<AntennaModel> rxAntenna =
-                        DynamicCast<AntennaModel>((*rxPhyIterator)->GetAntenna());
-                    if (rxAntenna)
-                    {
-                        Angles rxAngles(txMobility->GetPosition(), receiverMobility->GetPosition());
-                        rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
-                        NS_LOG_LOGIC("rxAntennaGain = " << rxAntennaGain << " dB");
-                        pathLossDb -= rxAntennaGain;
-                    }
-                    if (m_propagationLoss)
-                    {
-                        propagationGainDb =
-                            m_propagationLoss->CalcRxPower(0, txMobility, receiverMobility);
-                        NS_LOG_LOGIC("propagationGainDb = " << propagationGainDb << " dB");
-                        pathLossDb -= propagationGainDb;
-                    }
-                    NS_LOG_LOGIC("total pathLoss = " << pathLossDb << " dB");
-                    // Gain trace
-                    m_gainTrace(txMobility,
-                                receiverMobility,
-                                txAntennaGain,
-                                rxAntennaGain,
-                                propagationGainDb,
-                                pathLossDb);
-                    // Pathloss trace
-                    m_pathLossTrace(txParams->txPhy, *rxPhyIterator, pathLossDb);
-                    if (pathLossDb > m_maxLossDb)
-                    {
-                        // beyond range
-                        continue;
-                    }
-                    double pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
-                    *(rxParams->psd) *= pathGainLinear;
-
-                    if (m_propagationDelay)
-                    {
-                        delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
-                    }
-                }
-
-                if (rxNetDevice)
-                {
-                    // the receiver has a NetDevice, so we expect that it is attached to a Node
-                    uint32_t dstNode = rxNetDevice->GetNode()->GetId();
-                    Simulator::ScheduleWithContext(dstNode,
-                                                   delay,
-                                                   &MultiModelSpectrumChannel::StartRx,
-                                                   this,
-                                                   rxParams,
-                                                   *rxPhyIterator);
-                }
-                else
-                {
-                    // the receiver is not attached to a NetDevice, so we cannot assume that it is
-                    // attached to a node
-                    Simulator::Schedule(delay,
-                                        &MultiModelSpectrumChannel::StartRx,
-                                        this,
-                                        rxParams,
-                                        *rxPhyIterator);
-                }
+                m_grid->Add(id, m_indexedPhys[id]->GetMobility());
             }
         }
     }
+    m_grid->GetWithinRange(txMobility->GetPosition(), m_maxRange, m_candidates);
+    // visit the receivers in the same order as StartTx does without range
+    std::sort(m_candidates.begin(), m_candidates.end(), [this](uint32_t a, uint32_t b) {
+        return m_rxRanks[a] < m_rxRanks[b];
+    });
+
+    // the PSD is converted once per RX SpectrumModel, or set to nullptr if orthogonal
+    SpectrumModelUid_t txSpectrumModelUid = txParams->psd->GetSpectrumModelUid();
+    std::map<SpectrumModelUid_t, Ptr<SpectrumValue>> convertedTxPowerSpectra;
+    convertedTxPowerSpectra.emplace(txSpectrumModelUid, txParams->psd);
+    for (uint32_t id : m_candidates)
+    {
+        Ptr<SpectrumPhy> rxPhy = m_indexedPhys[id];
+        SpectrumModelUid_t rxSpectrumModelUid = rxPhy->GetRxSpectrumModel()->GetUid();
+        auto [converted, inserted] = convertedTxPowerSpectra.emplace(rxSpectrumModelUid, nullptr);
+        if (inserted)
+        {
+            auto rxConverterIterator = txInfo.m_spectrumConverterMap.find(rxSpectrumModelUid);
+            if (rxConverterIterator != txInfo.m_spectrumConverterMap.end())
+            {
+                NS_LOG_LOGIC("converting txPowerSpectrum SpectrumModelUids "
+                             << txSpectrumModelUid << " --> " << rxSpectrumModelUid);
+                converted->second = rxConverterIterator->second.Convert(txParams->psd);
+            }
+        }
+        if (converted->second)
+        {
+            SelectRx(txParams, converted->second, rxPhy);
+        }
+    }
 }
 
 void
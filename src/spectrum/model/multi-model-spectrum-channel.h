@@ -28,10 +28,15 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
 
+class SpatialGrid;
+
 /**
  * \ingroup spectrum
  * Container: SpectrumModelUid_t, SpectrumConverter
@@ -98,6 +103,12 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * By default, each signal is delivered to all the receivers with a
+ * non-orthogonal SpectrumModel.  When the MaxRange attribute is set, the
+ * receivers are indexed by a SpatialGrid, once the first signal is sent,
+ * and each signal is only delivered to the receivers within that range of
+ * the transmitter, which then no longer need to be visited.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -144,6 +155,57 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      */
     virtual void StartRx(Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+    /**
+     * Select a receiver of the signal, unless the receiver is the transmitter
+     * or is on the node of the transmitter.
+     *
+     * \param txParams The signal parameters.
+     * \param convertedTxPowerSpectrum The PSD, converted to the receiver SpectrumModel.
+     * \param rxPhy The receiver SpectrumPhy.
+     */
+    void SelectRx(Ptr<SpectrumSignalParameters> txParams,
+                  Ptr<SpectrumValue> convertedTxPowerSpectrum,
+                  Ptr<SpectrumPhy> rxPhy);
+
+    /**
+     * Compute the propagation gains of the selected receivers at once, and
+     * schedule the reception of the signal by each of them.
+     *
+     * \param txParams The signal parameters.
+     * \param txMobility The mobility model of the transmitter.
+     */
+    void ScheduleSelectedRx(Ptr<SpectrumSignalParameters> txParams, Ptr<MobilityModel> txMobility);
+
+    /**
+     * Apply the gains and the delay between the transmitter and a receiver,
+     * and schedule the reception of the signal, unless the loss exceeds the
+     * maximum loss.
+     *
+     * \param txParams The signal parameters.
+     * \param txMobility The mobility model of the transmitter.
+     * \param convertedTxPowerSpectrum The PSD, converted to the receiver SpectrumModel.
+     * \param rxPhy The receiver SpectrumPhy.
+     * \param receiverMobility The mobility model of the receiver, or nullptr.
+     * \param propagationGainDb The gain of the propagation loss model, in dB.
+     */
+    void ScheduleRx(Ptr<SpectrumSignalParameters> txParams,
+                    Ptr<MobilityModel> txMobility,
+                    Ptr<SpectrumValue> convertedTxPowerSpectrum,
+                    Ptr<SpectrumPhy> rxPhy,
+                    Ptr<MobilityModel> receiverMobility,
+                    double propagationGainDb);
+
+    /**
+     * Deliver a signal to the receivers within MaxRange of the transmitter.
+     *
+     * \param txParams The signal parameters.
+     * \param txMobility The mobility model of the transmitter.
+     * \param txInfo The converters of the TX SpectrumModel.
+     */
+    void StartTxWithinRange(Ptr<SpectrumSignalParameters> txParams,
+                            Ptr<MobilityModel> txMobility,
+                            const TxSpectrumModelInfo& txInfo);
+
     /**
      * Data structure holding, for each TX SpectrumModel,  all the
      * converters to any RX SpectrumModel, and all the corresponding
@@ -162,6 +224,31 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      * Number of devices connected to the channel.
      */
     std::size_t m_numDevices;
+
+    double m_maxRange;                                   //!< Range of the signals, or 0
+    Ptr<SpatialGrid> m_grid;                             //!< Spatial index of the receivers
+    std::vector<Ptr<SpectrumPhy>> m_indexedPhys;         //!< The receivers, by id in the index
+    std::unordered_map<SpectrumPhy*, uint32_t> m_phyIds; //!< The ids of the receivers
+    std::vector<uint32_t> m_candidates;                  //!< The receivers within range
+    /**
+     * The RX spectrum model and the rank of addition of the receivers, by
+     * id, which give their order in m_rxSpectrumModelInfoMap
+     */
+    std::vector<std::pair<SpectrumModelUid_t, uint64_t>> m_rxRanks;
+    uint64_t m_numAdded; //!< The number of receivers added so far
+
+    /// A selected receiver of the signal being transmitted
+    struct SelectedRx
+    {
+        Ptr<SpectrumPhy> phy;        //!< The receiver
+        Ptr<SpectrumValue> psd;      //!< The PSD, converted to the receiver SpectrumModel
+        Ptr<MobilityModel> mobility; //!< The mobility model of the receiver, or nullptr
+    };
+
+    std::vector<SelectedRx> m_selectedRx; //!< The selected receivers
+    /// The mobility models of the selected receivers which have one
+    std::vector<Ptr<MobilityModel>> m_rxMobilities;
+    std::vector<double> m_propagationGainsDb; //!< The propagation gains of m_rxMobilities
 };
 
 } // namespace ns3
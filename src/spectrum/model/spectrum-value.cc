@@ -22,19 +22,153 @@
 #include <ns3/math.h>
 #include <ns3/spectrum-value.h>
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("SpectrumValue");
 
+namespace
+{
+
+/// Maximum number of released Values kept by a thread, per number of values
+const std::size_t MAX_POOLED_VALUES = 64;
+
+/// The released Values of one thread, by number of values
+struct ValuesPool
+{
+    std::unordered_map<std::size_t, std::vector<Values>> released; //!< The released Values
+};
+
+/// The pool of the calling thread, created on first use
+thread_local ValuesPool* t_pool = nullptr;
+
+/// Whether the pool of the calling thread was deleted, as the thread exits
+thread_local bool t_poolDeleted = false;
+
+/// Deletes the pool of the calling thread when it exits
+struct ValuesPoolDeleter
+{
+    ~ValuesPoolDeleter()
+    {
+        delete t_pool;
+        t_pool = nullptr;
+        t_poolDeleted = true;
+    }
+};
+
+/// Deletes t_pool at thread exit
+thread_local ValuesPoolDeleter t_poolDeleter;
+
+/**
+ * \returns The pool of the calling thread, or nullptr once it was deleted,
+ * for the SpectrumValue destroyed after the thread-local variables, such as
+ * the static ones.
+ */
+ValuesPool*
+GetPool()
+{
+    if (!t_pool && !t_poolDeleted)
+    {
+        t_pool = new ValuesPool;
+        [[maybe_unused]] ValuesPoolDeleter* deleter = &t_poolDeleter;
+    }
+    return t_pool;
+}
+
+/**
+ * \param n The number of values.
+ * \returns Storage for n values, whose content is unspecified.
+ */
+Values
+TakeValues(std::size_t n)
+{
+    ValuesPool* pool = GetPool();
+    if (pool)
+    {
+        auto it = pool->released.find(n);
+        if (it != pool->released.end() && !it->second.empty())
+        {
+            Values values = std::move(it->second.back());
+            it->second.pop_back();
+            return values;
+        }
+    }
+    return Values(n);
+}
+
+/**
+ * \brief Keep the storage of some values for the next TakeValues.
+ * \param values The values, which are freed if the pool of their size is full.
+ */
+void
+ReleaseValues(Values&& values)
+{
+    if (values.empty())
+    {
+        return;
+    }
+    ValuesPool* pool = GetPool();
+    if (!pool)
+    {
+        return;
+    }
+    std::vector<Values>& released = pool->released[values.size()];
+    if (released.size() < MAX_POOLED_VALUES)
+    {
+        released.push_back(std::move(values));
+    }
+}
+
+} // namespace
+
 SpectrumValue::SpectrumValue()
 {
 }
 
 SpectrumValue::SpectrumValue(Ptr<const SpectrumModel> sof)
     : m_spectrumModel(sof),
-      m_values(sof->GetNumBands())
+      m_values(TakeValues(sof->GetNumBands()))
+{
+    std::fill(m_values.begin(), m_values.end(), 0);
+}
+
+SpectrumValue::SpectrumValue(const SpectrumValue& other)
+    : SimpleRefCount<SpectrumValue>(other),
+      m_spectrumModel(other.m_spectrumModel),
+      m_values(TakeValues(other.m_values.size()))
+{
+    std::copy(other.m_values.begin(), other.m_values.end(), m_values.begin());
+}
+
+SpectrumValue::~SpectrumValue()
+{
+    ReleaseValues(std::move(m_values));
+}
+
+SpectrumValue&
+SpectrumValue::operator=(SpectrumValue&& other)
+{
+    if (this != &other)
+    {
+        ReleaseValues(std::move(m_values));
+        m_spectrumModel = std::move(other.m_spectrumModel);
+        m_values = std::move(other.m_values);
+    }
+    return *this;
+}
+
+void
+SpectrumValue::Reshape(const SpectrumValue& x)
 {
+    m_spectrumModel = x.m_spectrumModel;
+    if (m_values.size() != x.m_values.size())
+    {
+        ReleaseValues(std::move(m_values));
+        m_values = TakeValues(x.m_values.size());
+    }
 }
 
 double&
@@ -499,6 +633,62 @@ operator/(double lhs, const SpectrumValue& rhs)
     return res;
 }
 
+SpectrumValue
+operator+(SpectrumValue&& lhs, const SpectrumValue& rhs)
+{
+    lhs.Add(rhs);
+    return std::move(lhs);
+}
+
+SpectrumValue
+operator+(SpectrumValue&& lhs, double rhs)
+{
+    lhs.Add(rhs);
+    return std::move(lhs);
+}
+
+SpectrumValue
+operator-(SpectrumValue&& lhs, const SpectrumValue& rhs)
+{
+    lhs.Subtract(rhs);
+    return std::move(lhs);
+}
+
+SpectrumValue
+operator-(SpectrumValue&& lhs, double rhs)
+{
+    lhs.Subtract(rhs);
+    return std::move(lhs);
+}
+
+SpectrumValue
+operator*(SpectrumValue&& lhs, const SpectrumValue& rhs)
+{
+    lhs.Multiply(rhs);
+    return std::move(lhs);
+}
+
+SpectrumValue
+operator*(SpectrumValue&& lhs, double rhs)
+{
+    lhs.Multiply(rhs);
+    return std::move(lhs);
+}
+
+SpectrumValue
+operator/(SpectrumValue&& lhs, const SpectrumValue& rhs)
+{
+    lhs.Divide(rhs);
+    return std::move(lhs);
+}
+
+SpectrumValue
+operator/(SpectrumValue&& lhs, double rhs)
+{
+    lhs.Divide(rhs);
+    return std::move(lhs);
+}
+
 SpectrumValue
 operator+(const SpectrumValue& rhs)
 {
@@ -622,6 +812,56 @@ SpectrumValue::operator=(double rhs)
     return *this;
 }
 
+void
+SpectrumValue::SetInterference(const SpectrumValue& allSignals,
+                               const SpectrumValue& signal,
+                               const SpectrumValue& noise)
+{
+    NS_ASSERT(allSignals.m_spectrumModel == signal.m_spectrumModel);
+    NS_ASSERT(allSignals.m_spectrumModel == noise.m_spectrumModel);
+    Reshape(allSignals);
+    const double* all = allSignals.m_values.data();
+    const double* sig = signal.m_values.data();
+    const double* n = noise.m_values.data();
+    double* res = m_values.data();
+    for (std::size_t i = 0; i < m_values.size(); i++)
+    {
+        res[i] = all[i] - sig[i] + n[i];
+    }
+}
+
+void
+SpectrumValue::SetSinr(const SpectrumValue& signal,
+                       const SpectrumValue& allSignals,
+                       const SpectrumValue& noise)
+{
+    NS_ASSERT(signal.m_spectrumModel == allSignals.m_spectrumModel);
+    NS_ASSERT(signal.m_spectrumModel == noise.m_spectrumModel);
+    Reshape(signal);
+    const double* sig = signal.m_values.data();
+    const double* all = allSignals.m_values.data();
+    const double* n = noise.m_values.data();
+    double* res = m_values.data();
+    for (std::size_t i = 0; i < m_values.size(); i++)
+    {
+        res[i] = sig[i] / (all[i] - sig[i] + n[i]);
+    }
+}
+
+void
+SpectrumValue::SetQuotient(const SpectrumValue& lhs, const SpectrumValue& rhs)
+{
+    NS_ASSERT(lhs.m_spectrumModel == rhs.m_spectrumModel);
+    Reshape(lhs);
+    const double* l = lhs.m_values.data();
+    const double* r = rhs.m_values.data();
+    double* res = m_values.data();
+    for (std::size_t i = 0; i < m_values.size(); i++)
+    {
+        res[i] = l[i] / r[i];
+    }
+}
+
 SpectrumValue
 SpectrumValue::operator<<(int n) const
 {
@@ -80,6 +80,51 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
 
     SpectrumValue();
 
+    /**
+     * Copy constructor, which takes the storage of the values from the pool
+     * of the calling thread
+     *
+     * @param other the SpectrumValue to copy
+     */
+    SpectrumValue(const SpectrumValue& other);
+
+    /**
+     * Move constructor
+     *
+     * @param other the SpectrumValue to move
+     */
+    SpectrumValue(SpectrumValue&& other) = default;
+
+    /**
+     * Destructor, which returns the storage of the values to the pool of
+     * the calling thread
+     *
+     * The storage of the values released by each thread is kept, up to a
+     * bound, for the next SpectrumValue of the same number of bands, such
+     * as those which share a SpectrumModel, constructed or copied by that
+     * thread.
+     */
+    ~SpectrumValue();
+
+    /**
+     * Copy assignment operator
+     *
+     * @param other the SpectrumValue to copy
+     *
+     * @return a reference to *this
+     */
+    SpectrumValue& operator=(const SpectrumValue& other) = default;
+
+    /**
+     * Move assignment operator, which returns the storage of the values of
+     * *this to the pool of the calling thread
+     *
+     * @param other the SpectrumValue to move
+     *
+     * @return a reference to *this
+     */
+    SpectrumValue& operator=(SpectrumValue&& other);
+
     /**
      * Access value at given frequency index
      *
@@ -285,6 +330,86 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     friend SpectrumValue operator/(double lhs, const SpectrumValue& rhs);
 
+    /**
+     * addition operator, which reuses the storage of a temporary lhs
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of lhs + rhs
+     */
+    friend SpectrumValue operator+(SpectrumValue&& lhs, const SpectrumValue& rhs);
+
+    /**
+     * addition operator, which reuses the storage of a temporary lhs
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of lhs + rhs
+     */
+    friend SpectrumValue operator+(SpectrumValue&& lhs, double rhs);
+
+    /**
+     * subtraction operator, which reuses the storage of a temporary lhs
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of lhs - rhs
+     */
+    friend SpectrumValue operator-(SpectrumValue&& lhs, const SpectrumValue& rhs);
+
+    /**
+     * subtraction operator, which reuses the storage of a temporary lhs
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of lhs - rhs
+     */
+    friend SpectrumValue operator-(SpectrumValue&& lhs, double rhs);
+
+    /**
+     * multiplication component-by-component, which reuses the storage of a temporary lhs
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of lhs * rhs
+     */
+    friend SpectrumValue operator*(SpectrumValue&& lhs, const SpectrumValue& rhs);
+
+    /**
+     * multiplication by a scalar, which reuses the storage of a temporary lhs
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of lhs * rhs
+     */
+    friend SpectrumValue operator*(SpectrumValue&& lhs, double rhs);
+
+    /**
+     * division component-by-component, which reuses the storage of a temporary lhs
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of lhs / rhs
+     */
+    friend SpectrumValue operator/(SpectrumValue&& lhs, const SpectrumValue& rhs);
+
+    /**
+     * division by a scalar, which reuses the storage of a temporary lhs
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of lhs / rhs
+     */
+    friend SpectrumValue operator/(SpectrumValue&& lhs, double rhs);
+
     /**
      * unary plus operator
      *
@@ -409,6 +534,47 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     SpectrumValue& operator=(double rhs);
 
+    /**
+     * Set *this to the interference suffered by a signal, component by
+     * component, in a single pass and without temporary SpectrumValue,
+     * i.e., to allSignals - signal + noise
+     *
+     * *this takes the SpectrumModel of the operands, and may be one of them.
+     *
+     * @param allSignals the sum of all the signals, including signal
+     * @param signal the signal
+     * @param noise the noise
+     */
+    void SetInterference(const SpectrumValue& allSignals,
+                         const SpectrumValue& signal,
+                         const SpectrumValue& noise);
+
+    /**
+     * Set *this to the SINR of a signal, component by component, in a
+     * single pass and without temporary SpectrumValue, i.e., to
+     * signal / (allSignals - signal + noise)
+     *
+     * *this takes the SpectrumModel of the operands, and may be one of them.
+     *
+     * @param signal the signal
+     * @param allSignals the sum of all the signals, including signal
+     * @param noise the noise
+     */
+    void SetSinr(const SpectrumValue& signal,
+                 const SpectrumValue& allSignals,
+                 const SpectrumValue& noise);
+
+    /**
+     * Set *this to lhs / rhs, component by component, without temporary
+     * SpectrumValue
+     *
+     * *this takes the SpectrumModel of the operands, and may be one of them.
+     *
+     * @param lhs the dividend
+     * @param rhs the divisor
+     */
+    void SetQuotient(const SpectrumValue& lhs, const SpectrumValue& rhs);
+
     /**
      *
      * @param x the operand
@@ -507,6 +673,12 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
     typedef void (*TracedCallback)(Ptr<SpectrumValue> value);
 
   private:
+    /**
+     * Take the SpectrumModel of another SpectrumValue, and storage for as
+     * many values, whose content is unspecified
+     * \param x SpectrumValue
+     */
+    void Reshape(const SpectrumValue& x);
     /**
      * Add a SpectrumValue (element to element addition)
      * \param x SpectrumValue
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/double.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/net-device.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/test.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief SpectrumPhy which records the signals it receives.
+ */
+class RecordingSpectrumPhy : public SpectrumPhy
+{
+  public:
+    /**
+     * Constructor
+     * \param id The identifier of the PHY.
+     * \param position The position of the PHY.
+     * \param rxSpectrumModel The RX spectrum model of the PHY.
+     * \param received The identifiers of the PHYs which received a signal, in order.
+     */
+    RecordingSpectrumPhy(uint32_t id,
+                         const Vector& position,
+                         Ptr<const SpectrumModel> rxSpectrumModel,
+                         std::vector<uint32_t>* received);
+
+    void SetDevice(Ptr<NetDevice> d) override;
+    Ptr<NetDevice> GetDevice() const override;
+    void SetMobility(Ptr<MobilityModel> m) override;
+    Ptr<MobilityModel> GetMobility() const override;
+    void SetChannel(Ptr<SpectrumChannel> c) override;
+    Ptr<const SpectrumModel> GetRxSpectrumModel() const override;
+    Ptr<Object> GetAntenna() const override;
+    void StartRx(Ptr<SpectrumSignalParameters> params) override;
+
+    /**
+     * Set the RX spectrum model
+     * \param rxSpectrumModel The RX spectrum model.
+     */
+    void SetRxSpectrumModel(Ptr<const SpectrumModel> rxSpectrumModel);
+
+  private:
+    uint32_t m_id;                              //!< The identifier of the PHY
+    Ptr<MobilityModel> m_mobility;              //!< The mobility model
+    Ptr<const SpectrumModel> m_rxSpectrumModel; //!< The RX spectrum model
+    std::vector<uint32_t>* m_received;          //!< The PHYs which received a signal
+};
+
+RecordingSpectrumPhy::RecordingSpectrumPhy(uint32_t id,
+                                           const Vector& position,
+                                           Ptr<const SpectrumModel> rxSpectrumModel,
+                                           std::vector<uint32_t>* received)
+    : m_id(id),
+      m_mobility(CreateObject<ConstantPositionMobilityModel>()),
+      m_rxSpectrumModel(rxSpectrumModel),
+      m_received(received)
+{
+    m_mobility->SetPosition(position);
+}
+
+void
+RecordingSpectrumPhy::SetDevice(Ptr<NetDevice> d)
+{
+}
+
+Ptr<NetDevice>
+RecordingSpectrumPhy::GetDevice() const
+{
+    return nullptr;
+}
+
+void
+RecordingSpectrumPhy::SetMobility(Ptr<MobilityModel> m)
+{
+    m_mobility = m;
+}
+
+Ptr<MobilityModel>
+RecordingSpectrumPhy::GetMobility() const
+{
+    return m_mobility;
+}
+
+void
+RecordingSpectrumPhy::SetChannel(Ptr<SpectrumChannel> c)
+{
+}
+
+Ptr<const SpectrumModel>
+RecordingSpectrumPhy::GetRxSpectrumModel() const
+{
+    return m_rxSpectrumModel;
+}
+
+Ptr<Object>
+RecordingSpectrumPhy::GetAntenna() const
+{
+    return nullptr;
+}
+
+void
+RecordingSpectrumPhy::StartRx(Ptr<SpectrumSignalParameters> params)
+{
+    m_received->push_back(m_id);
+}
+
+void
+RecordingSpectrumPhy::SetRxSpectrumModel(Ptr<const SpectrumModel> rxSpectrumModel)
+{
+    m_rxSpectrumModel = rxSpectrumModel;
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief MultiModelSpectrumChannel MaxRange test: the signals are delivered
+ * to the receivers within range, in the same order as without MaxRange,
+ * while receivers are removed, added again, moved, and change their
+ * spectrum model.
+ */
+class MultiModelSpectrumChannelRangeTestCase : public TestCase
+{
+  public:
+    MultiModelSpectrumChannelRangeTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Transmit a signal from m_tx
+     * \param channel The channel.
+     * \returns The identifiers of the PHYs which received the signal, in order.
+     */
+    std::vector<uint32_t> Transmit(Ptr<MultiModelSpectrumChannel> channel);
+
+    /**
+     * Check that the channel with MaxRange delivers the signals to the
+     * receivers within range of the channel without it, in the same order
+     * \param step The description of the step of the test.
+     */
+    void CheckReceivers(std::string step);
+
+    /**
+     * Add a receiver to both channels
+     * \param phy The receiver.
+     */
+    void AddRx(Ptr<RecordingSpectrumPhy> phy);
+
+    /**
+     * Remove a receiver from both channels
+     * \param phy The receiver.
+     */
+    void RemoveRx(Ptr<RecordingSpectrumPhy> phy);
+
+    static constexpr double MAX_RANGE = 50; //!< The range of m_ranged
+
+    Ptr<MultiModelSpectrumChannel> m_all;          //!< The channel without MaxRange
+    Ptr<MultiModelSpectrumChannel> m_ranged;       //!< The channel with MaxRange
+    Ptr<const SpectrumModel> m_modelA;             //!< The TX spectrum model
+    Ptr<const SpectrumModel> m_modelB;             //!< Another RX spectrum model
+    Ptr<RecordingSpectrumPhy> m_tx;                //!< The transmitter
+    std::vector<Ptr<RecordingSpectrumPhy>> m_phys; //!< The receivers, by identifier
+    std::vector<uint32_t> m_received;              //!< The receivers of the last signal
+};
+
+MultiModelSpectrumChannelRangeTestCase::MultiModelSpectrumChannelRangeTestCase()
+    : TestCase("Check the receivers of a MultiModelSpectrumChannel with MaxRange")
+{
+}
+
+std::vector<uint32_t>
+MultiModelSpectrumChannelRangeTestCase::Transmit(Ptr<MultiModelSpectrumChannel> channel)
+{
+    auto params = Create<SpectrumSignalParameters>();
+    params->psd = Create<SpectrumValue>(m_modelA);
+    *params->psd = 1e-9;
+    params->duration = MicroSeconds(100);
+    params->txPhy = m_tx;
+    m_received.clear();
+    channel->StartTx(params);
+    Simulator::Run();
+    return m_received;
+}
+
+void
+MultiModelSpectrumChannelRangeTestCase::CheckReceivers(std::string step)
+{
+    std::vector<uint32_t> expected;
+    for (uint32_t id : Transmit(m_all))
+    {
+        if (m_phys[id]->GetMobility()->GetDistanceFrom(m_tx->GetMobility()) <= MAX_RANGE)
+        {
+            expected.push_back(id);
+        }
+    }
+    std::vector<uint32_t> received = Transmit(m_ranged);
+    NS_TEST_ASSERT_MSG_GT(expected.size(), 0, "No receiver within range, " << step);
+    NS_TEST_ASSERT_MSG_EQ(received.size(), expected.size(), "Wrong receivers, " << step);
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(received[i], expected[i], "Wrong receiver " << i << ", " << step);
+    }
+}
+
+void
+MultiModelSpectrumChannelRangeTestCase::AddRx(Ptr<RecordingSpectrumPhy> phy)
+{
+    m_all->AddRx(phy);
+    m_ranged->AddRx(phy);
+}
+
+void
+MultiModelSpectrumChannelRangeTestCase::RemoveRx(Ptr<RecordingSpectrumPhy> phy)
+{
+    m_all->RemoveRx(phy);
+    m_ranged->RemoveRx(phy);
+}
+
+void
+MultiModelSpectrumChannelRangeTestCase::DoRun()
+{
+    m_all = CreateObject<MultiModelSpectrumChannel>();
+    m_ranged = CreateObject<MultiModelSpectrumChannel>();
+    m_ranged->SetAttribute("MaxRange", DoubleValue(MAX_RANGE));
+    // two overlapping spectrum models, which need a conversion
+    m_modelA = Create<SpectrumModel>(std::vector<double>{2.400e9, 2.410e9, 2.420e9});
+    m_modelB = Create<SpectrumModel>(std::vector<double>{2.405e9, 2.415e9});
+
+    m_tx = CreateObject<RecordingSpectrumPhy>(100, Vector(0, 0, 0), m_modelA, &m_received);
+    AddRx(m_tx);
+    // receivers further and further from the transmitter, in all directions
+    for (uint32_t id = 0; id < 16; id++)
+    {
+        double distance = 6.0 * (id + 1);
+        Vector position(distance * std::cos(id), distance * std::sin(id), 0);
+        m_phys.push_back(CreateObject<RecordingSpectrumPhy>(id,
+                                                            position,
+                                                            id % 3 == 0 ? m_modelB : m_modelA,
+                                                            &m_received));
+        AddRx(m_phys.back());
+    }
+    CheckReceivers("initial receivers");
+
+    RemoveRx(m_phys[2]);
+    RemoveRx(m_phys[4]);
+    RemoveRx(m_phys[12]);
+    CheckReceivers("removed receivers");
+
+    // the receivers added again reuse their ids in the spatial index
+    AddRx(m_phys[4]);
+    m_phys[12]->GetMobility()->SetPosition(Vector(10, 10, 0));
+    AddRx(m_phys[12]);
+    m_phys[5]->SetRxSpectrumModel(m_modelB);
+    AddRx(m_phys[5]);
+    m_phys[1]->GetMobility()->SetPosition(Vector(100, 0, 0));
+    m_phys.push_back(
+        CreateObject<RecordingSpectrumPhy>(16, Vector(0, 30, 0), m_modelA, &m_received));
+    AddRx(m_phys.back());
+    CheckReceivers("added and moved receivers");
+
+    Simulator::Destroy();
+    m_all->Dispose();
+    m_ranged->Dispose();
+    m_tx = nullptr;
+    m_phys.clear();
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief MultiModelSpectrumChannel TestSuite
+ */
+class MultiModelSpectrumChannelTestSuite : public TestSuite
+{
+  public:
+    MultiModelSpectrumChannelTestSuite()
+        : TestSuite("multi-model-spectrum-channel", UNIT)
+    {
+        AddTestCase(new MultiModelSpectrumChannelRangeTestCase(), TestCase::QUICK);
+    }
+};
+
+/// Static variable for test initialization
+static MultiModelSpectrumChannelTestSuite g_multiModelSpectrumChannelTestSuite;
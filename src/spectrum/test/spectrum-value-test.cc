@@ -268,6 +268,53 @@ SpectrumValueTestSuite::SpectrumValueTestSuite()
     v1rs3[4] = v1[1];
     tv1rs3 = v1 >> 3;
     AddTestCase(new SpectrumValueTestCase(tv1rs3, v1rs3, "tv1rs3 = v1 >> 3"), TestCase::QUICK);
+
+    SpectrumValue tv3c = SpectrumValue(v1) + v2;
+    SpectrumValue tv4c = SpectrumValue(v1) - v2;
+    SpectrumValue tv5c = SpectrumValue(v1) * v2;
+    SpectrumValue tv6c = SpectrumValue(v1) / v2;
+    AddTestCase(new SpectrumValueTestCase(tv3c, v3, "tv3c = (v1) + v2"), TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(tv4c, v4, "tv4c = (v1) - v2"), TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(tv5c, v5, "tv5c = (v1) * v2"), TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(tv6c, v6, "tv6c = (v1) div v2"), TestCase::QUICK);
+
+    SpectrumValue tv7c = SpectrumValue(v1) + doubleValue;
+    SpectrumValue tv8c = SpectrumValue(v1) - doubleValue;
+    SpectrumValue tv9c = SpectrumValue(v1) * doubleValue;
+    SpectrumValue tv10c = SpectrumValue(v1) / doubleValue;
+    AddTestCase(new SpectrumValueTestCase(tv7c, v7, "tv7c = (v1) + doubleValue"), TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(tv8c, v8, "tv8c = (v1) - doubleValue"), TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(tv9c, v9, "tv9c = (v1) * doubleValue"), TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(tv10c, v10, "tv10c = (v1) div doubleValue"),
+                TestCase::QUICK);
+
+    SpectrumValue noise(f);
+    noise = doubleValue;
+    SpectrumValue interference;
+    SpectrumValue sinr;
+    SpectrumValue quotient;
+    interference.SetInterference(v3, v1, noise);
+    sinr.SetSinr(v1, v3, noise);
+    quotient.SetQuotient(v1, v2);
+    AddTestCase(new SpectrumValueTestCase(interference,
+                                          v2 + doubleValue,
+                                          "interference.SetInterference (v3, v1, noise)"),
+                TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(sinr,
+                                          v1 / (v2 + doubleValue),
+                                          "sinr.SetSinr (v1, v3, noise)"),
+                TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(quotient, v6, "quotient.SetQuotient (v1, v2)"),
+                TestCase::QUICK);
+
+    // the storage of a destroyed value is reused, and zeroed, by the next one
+    SpectrumValue zero = v1 * 0.0;
+    {
+        SpectrumValue released(f);
+        released = doubleValue;
+    }
+    SpectrumValue reused(f);
+    AddTestCase(new SpectrumValueTestCase(reused, zero, "reused"), TestCase::QUICK);
 }
 
 /**
@@ -697,7 +697,10 @@ QueueDisc::PacketEnqueued(Ptr<const QueueDiscItem> item)
     m_stats.nTotalEnqueuedBytes += item->GetSize();
 
     NS_LOG_LOGIC("m_traceEnqueue (p)");
-    m_traceEnqueue(item);
+    if (!m_traceEnqueue.IsEmpty())
+    {
+        m_traceEnqueue(item);
+    }
 }
 
 void
@@ -718,7 +721,10 @@ QueueDisc::PacketDequeued(Ptr<const QueueDiscItem> item)
         m_sojourn(Simulator::Now() - item->GetTimeStamp());
 
         NS_LOG_LOGIC("m_traceDequeue (p)");
-        m_traceDequeue(item);
+        if (!m_traceDequeue.IsEmpty())
+        {
+            m_traceDequeue(item);
+        }
     }
 }
 
@@ -1065,7 +1071,10 @@ QueueDisc::Requeue(Ptr<QueueDiscItem> item)
     m_stats.nTotalRequeuedBytes += item->GetSize();
 
     NS_LOG_LOGIC("m_traceRequeue (p)");
-    m_traceRequeue(item);
+    if (!m_traceRequeue.IsEmpty())
+    {
+        m_traceRequeue(item);
+    }
 }
 
 bool
@@ -202,6 +202,12 @@ YansWavePhyHelper::EnableAsciiInternal(Ptr<OutputStreamWrapper> stream,
     //
     Packet::EnablePrinting();
 
+    //
+    // Our trace sinks print the packets: they cannot write binary records.
+    //
+    NS_ABORT_MSG_IF(stream && stream->GetBinaryTrace(),
+                    "The WAVE ascii trace sinks do not support binary trace streams");
+
     uint32_t nodeid = nd->GetNode()->GetId();
     uint32_t deviceid = nd->GetIfIndex();
     std::ostringstream oss;
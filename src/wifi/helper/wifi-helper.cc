@@ -21,6 +21,7 @@
 
 #include "wifi-helper.h"
 
+#include "ns3/abort.h"
 #include "ns3/ampdu-subframe-header.h"
 #include "ns3/ap-wifi-mac.h"
 #include "ns3/config.h"
@@ -641,6 +642,10 @@ WifiPhyHelper::EnableAsciiInternal(Ptr<OutputStreamWrapper> stream,
     // that is turned on.
     Packet::EnablePrinting();
 
+    // Our trace sinks print the packets: they cannot write binary records.
+    NS_ABORT_MSG_IF(stream && stream->GetBinaryTrace(),
+                    "The wifi ascii trace sinks do not support binary trace streams");
+
     uint32_t nodeid = nd->GetNode()->GetId();
     uint32_t deviceid = nd->GetIfIndex();
     std::ostringstream oss;
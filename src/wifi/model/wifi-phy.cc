@@ -1484,7 +1484,7 @@ WifiPhy::GetMaxPsduSize(WifiModulationClass modulation)
 }
 
 void
-WifiPhy::NotifyTxBegin(WifiConstPsduMap psdus, double txPowerW)
+WifiPhy::NotifyTxBegin(const WifiConstPsduMap& psdus, double txPowerW)
 {
     if (!m_phyTxBeginTrace.IsEmpty())
     {
@@ -1499,7 +1499,7 @@ WifiPhy::NotifyTxBegin(WifiConstPsduMap psdus, double txPowerW)
 }
 
 void
-WifiPhy::NotifyTxEnd(WifiConstPsduMap psdus)
+WifiPhy::NotifyTxEnd(const WifiConstPsduMap& psdus)
 {
     if (!m_phyTxEndTrace.IsEmpty())
     {
@@ -1564,9 +1564,9 @@ WifiPhy::NotifyRxDrop(Ptr<const WifiPsdu> psdu, WifiPhyRxfailureReason reason)
 void
 WifiPhy::NotifyMonitorSniffRx(Ptr<const WifiPsdu> psdu,
                               uint16_t channelFreqMhz,
-                              WifiTxVector txVector,
+                              const WifiTxVector& txVector,
                               SignalNoiseDbm signalNoise,
-                              std::vector<bool> statusPerMpdu,
+                              const std::vector<bool>& statusPerMpdu,
                               uint16_t staId)
 {
     MpduInfo aMpdu;
@@ -1618,7 +1618,7 @@ WifiPhy::NotifyMonitorSniffRx(Ptr<const WifiPsdu> psdu,
 void
 WifiPhy::NotifyMonitorSniffTx(Ptr<const WifiPsdu> psdu,
                               uint16_t channelFreqMhz,
-                              WifiTxVector txVector,
+                              const WifiTxVector& txVector,
                               uint16_t staId)
 {
     MpduInfo aMpdu;
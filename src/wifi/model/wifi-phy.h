@@ -541,14 +541,14 @@ class WifiPhy : public Object
      * \param psdus the PSDUs being transmitted (only one unless DL MU transmission)
      * \param txPowerW the transmit power in Watts
      */
-    void NotifyTxBegin(WifiConstPsduMap psdus, double txPowerW);
+    void NotifyTxBegin(const WifiConstPsduMap& psdus, double txPowerW);
     /**
      * Public method used to fire a PhyTxEnd trace.
      * Implemented for encapsulation purposes.
      *
      * \param psdus the PSDUs being transmitted (only one unless DL MU transmission)
      */
-    void NotifyTxEnd(WifiConstPsduMap psdus);
+    void NotifyTxEnd(const WifiConstPsduMap& psdus);
     /**
      * Public method used to fire a PhyTxDrop trace.
      * Implemented for encapsulation purposes.
@@ -603,9 +603,9 @@ class WifiPhy : public Object
      */
     void NotifyMonitorSniffRx(Ptr<const WifiPsdu> psdu,
                               uint16_t channelFreqMhz,
-                              WifiTxVector txVector,
+                              const WifiTxVector& txVector,
                               SignalNoiseDbm signalNoise,
-                              std::vector<bool> statusPerMpdu,
+                              const std::vector<bool>& statusPerMpdu,
                               uint16_t staId = SU_STA_ID);
 
     /**
@@ -651,7 +651,7 @@ class WifiPhy : public Object
      */
     void NotifyMonitorSniffTx(Ptr<const WifiPsdu> psdu,
                               uint16_t channelFreqMhz,
-                              WifiTxVector txVector,
+                              const WifiTxVector& txVector,
                               uint16_t staId = SU_STA_ID);
 
     /**
@@ -24,6 +24,7 @@
 #include "wifi-utils.h"
 #include "yans-wifi-phy.h"
 
+#include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
@@ -31,6 +32,7 @@
 #include "ns3/propagation-delay-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
+#include "ns3/spatial-grid.h"
 #include "ns3/wifi-net-device.h"
 
 namespace ns3
@@ -57,7 +59,21 @@ YansWifiChannel::GetTypeId()
                           "A pointer to the propagation delay model attached to this channel.",
                           PointerValue(),
                           MakePointerAccessor(&YansWifiChannel::m_delay),
-                          MakePointerChecker<PropagationDelayModel>());
+                          MakePointerChecker<PropagationDelayModel>())
+            .AddAttribute("MaxLossDb",
+                          "If a single-frequency PropagationLossModel is used, this value "
+                          "represents the maximum loss in dB for which transmissions will be "
+                          "passed to the receiving PHY.",
+                          DoubleValue(1.0e9),
+                          MakeDoubleAccessor(&YansWifiChannel::m_maxLossDb),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("MaxRange",
+                          "The distance, in meters, beyond which the PPDUs are not delivered, "
+                          "so that the receivers are looked up in a spatial index of the PHYs "
+                          "instead of all being visited. The value 0 means no limit.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&YansWifiChannel::m_maxRange),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
@@ -92,42 +108,102 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
     NS_LOG_FUNCTION(this << sender << ppdu << txPowerDbm);
     Ptr<MobilityModel> senderMobility = sender->GetMobility();
     NS_ASSERT(senderMobility);
-    for (PhyList::const_iterator i = m_phyList.begin(); i != m_phyList.end(); i++)
+    m_receivers.clear();
+    m_receiverMobilities.clear();
+    if (m_maxRange > 0)
     {
-        if (sender != (*i))
+        if (!m_grid)
         {
-            // For now don't account for inter channel interference nor channel bonding
-            if ((*i)->GetChannelNumber() != sender->GetChannelNumber())
+            // the PHYs are indexed once they are all attached to their node
+            m_grid = Create<SpatialGrid>(m_maxRange);
+            for (uint32_t i = 0; i < m_phyList.size(); i++)
             {
-                continue;
+                m_grid->Add(i, m_phyList[i]->GetMobility());
             }
+        }
+        m_grid->GetWithinRange(senderMobility->GetPosition(), m_maxRange, m_candidates);
+        for (uint32_t i : m_candidates)
+        {
+            AddReceiver(sender, m_phyList[i]);
+        }
+    }
+    else
+    {
+        for (PhyList::const_iterator i = m_phyList.begin(); i != m_phyList.end(); i++)
+        {
+            AddReceiver(sender, *i);
+        }
+    }
 
-            Ptr<MobilityModel> receiverMobility = (*i)->GetMobility()->GetObject<MobilityModel>();
-            Time delay = m_delay->GetDelay(senderMobility, receiverMobility);
-            double rxPowerDbm = m_loss->CalcRxPower(txPowerDbm, senderMobility, receiverMobility);
-            NS_LOG_DEBUG("propagation: txPower="
-                         << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, "
-                         << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
-                         << "m, delay=" << delay);
-            Ptr<NetDevice> dstNetDevice = (*i)->GetDevice();
-            uint32_t dstNode;
-            if (!dstNetDevice)
-            {
-                dstNode = 0xffffffff;
-            }
-            else
-            {
-                dstNode = dstNetDevice->GetNode()->GetId();
-            }
+    if (m_receivers.empty())
+    {
+        // as before, the propagation models are only needed by the receivers
+        return;
+    }
+    // the losses of all the receivers are computed at once
+    m_loss->CalcRxPowers(txPowerDbm, senderMobility, m_receiverMobilities, m_rxPowersDbm);
+    for (std::size_t i = 0; i < m_receivers.size(); i++)
+    {
+        SendTo(senderMobility,
+               m_receivers[i],
+               m_receiverMobilities[i],
+               ppdu,
+               txPowerDbm,
+               m_rxPowersDbm[i]);
+    }
+}
 
-            Simulator::ScheduleWithContext(dstNode,
-                                           delay,
-                                           &YansWifiChannel::Receive,
-                                           (*i),
-                                           ppdu,
-                                           rxPowerDbm);
-        }
+void
+YansWifiChannel::AddReceiver(Ptr<YansWifiPhy> sender, Ptr<YansWifiPhy> receiver) const
+{
+    if (sender == receiver)
+    {
+        return;
+    }
+    // For now don't account for inter channel interference nor channel bonding
+    if (receiver->GetChannelNumber() != sender->GetChannelNumber())
+    {
+        return;
+    }
+    m_receivers.push_back(receiver);
+    m_receiverMobilities.push_back(receiver->GetMobility()->GetObject<MobilityModel>());
+}
+
+void
+YansWifiChannel::SendTo(Ptr<MobilityModel> senderMobility,
+                        Ptr<YansWifiPhy> receiver,
+                        Ptr<MobilityModel> receiverMobility,
+                        Ptr<const WifiPpdu> ppdu,
+                        double txPowerDbm,
+                        double rxPowerDbm) const
+{
+    Time delay = m_delay->GetDelay(senderMobility, receiverMobility);
+    NS_LOG_DEBUG("propagation: txPower="
+                 << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, "
+                 << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
+                 << "m, delay=" << delay);
+    if (txPowerDbm - rxPowerDbm > m_maxLossDb)
+    {
+        NS_LOG_LOGIC("Dropping signal after " << txPowerDbm - rxPowerDbm << " dB of loss");
+        return;
+    }
+    Ptr<NetDevice> dstNetDevice = receiver->GetDevice();
+    uint32_t dstNode;
+    if (!dstNetDevice)
+    {
+        dstNode = 0xffffffff;
     }
+    else
+    {
+        dstNode = dstNetDevice->GetNode()->GetId();
+    }
+
+    Simulator::ScheduleWithContext(dstNode,
+                                   delay,
+                                   &YansWifiChannel::Receive,
+                                   receiver,
+                                   ppdu,
+                                   rxPowerDbm);
 }
 
 void
@@ -166,6 +242,10 @@ YansWifiChannel::Add(Ptr<YansWifiPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
     m_phyList.push_back(phy);
+    if (m_grid)
+    {
+        m_grid->Add(m_phyList.size() - 1, phy->GetMobility());
+    }
 }
 
 int64_t
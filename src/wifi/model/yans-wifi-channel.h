@@ -25,9 +25,11 @@
 namespace ns3
 {
 
+class MobilityModel;
 class NetDevice;
 class PropagationLossModel;
 class PropagationDelayModel;
+class SpatialGrid;
 class YansWifiPhy;
 class Packet;
 class Time;
@@ -41,6 +43,13 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * By default, each PPDU is delivered to all the other YansWifiPhy objects
+ * on the channel.  When the MaxRange attribute is set, the PHYs are
+ * indexed by a SpatialGrid, once the first PPDU is sent, and each PPDU is
+ * only delivered to the PHYs within that range of the sender, at a cost
+ * which depends on the number of neighbors of the sender rather than on
+ * the number of PHYs.
  */
 class YansWifiChannel : public Channel
 {
@@ -102,6 +111,32 @@ class YansWifiChannel : public Channel
      */
     typedef std::vector<Ptr<YansWifiPhy>> PhyList;
 
+    /**
+     * Add a receiver to the receivers of a PPDU, unless the receiver is the
+     * sender or is on another channel.
+     *
+     * \param sender the PHY object from which the packet is originating
+     * \param receiver the PHY object to which the packet may be delivered
+     */
+    void AddReceiver(Ptr<YansWifiPhy> sender, Ptr<YansWifiPhy> receiver) const;
+
+    /**
+     * Deliver a PPDU to a receiver, unless the loss exceeds the maximum loss.
+     *
+     * \param senderMobility the mobility model of the sender
+     * \param receiver the PHY object to which the packet is delivered
+     * \param receiverMobility the mobility model of the receiver
+     * \param ppdu the PPDU to send
+     * \param txPowerDbm the TX power associated to the packet, in dBm
+     * \param rxPowerDbm the RX power of the packet at the receiver, in dBm
+     */
+    void SendTo(Ptr<MobilityModel> senderMobility,
+                Ptr<YansWifiPhy> receiver,
+                Ptr<MobilityModel> receiverMobility,
+                Ptr<const WifiPpdu> ppdu,
+                double txPowerDbm,
+                double rxPowerDbm) const;
+
     /**
      * This method is scheduled by Send for each associated YansWifiPhy.
      * The method then calls the corresponding YansWifiPhy that the first
@@ -116,6 +151,15 @@ class YansWifiChannel : public Channel
     PhyList m_phyList;                  //!< List of YansWifiPhys connected to this YansWifiChannel
     Ptr<PropagationLossModel> m_loss;   //!< Propagation loss model
     Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+    double m_maxLossDb;                 //!< Maximum loss beyond which the PPDUs are not delivered
+    double m_maxRange;                  //!< Range beyond which the PPDUs are not delivered, or 0
+
+    mutable Ptr<SpatialGrid> m_grid;            //!< Spatial index of the PHYs, by index in the list
+    mutable std::vector<uint32_t> m_candidates; //!< Indices of the PHYs within range of a sender
+    mutable PhyList m_receivers;                //!< The receivers of the PPDU being sent
+    /// The mobility models of the receivers of the PPDU being sent
+    mutable std::vector<Ptr<MobilityModel>> m_receiverMobilities;
+    mutable std::vector<double> m_rxPowersDbm; //!< The RX powers of the PPDU being sent, in dBm
 };
 
 } // namespace ns3
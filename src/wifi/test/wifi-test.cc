@@ -36,6 +36,7 @@
 #include "ns3/packet-socket-helper.h"
 #include "ns3/packet-socket-server.h"
 #include "ns3/pointer.h"
+#include "ns3/propagation-delay-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/rng-seed-manager.h"
 #include "ns3/socket.h"
@@ -3604,6 +3605,165 @@ HeRuMcsDataRateTestCase::DoRun()
                           "Data rate verification for RUs above 52-tone RU (included) failed");
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief YansWifiChannel receivers test
+ *
+ * A station broadcasts a PPDU to stations further and further from it. With
+ * the MaxRange attribute of the YansWifiChannel, the PPDU must start being
+ * received by the same stations, in the same order, as without it, except
+ * for the stations out of range. With the MaxLossDb attribute, the PPDU must
+ * not be received by the stations whose loss exceeds it.
+ */
+class YansWifiChannelReceiversTest : public TestCase
+{
+  public:
+    YansWifiChannelReceiversTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Broadcast a PPDU from the first station to the other ones.
+     * \param maxRange the MaxRange attribute of the channel
+     * \param maxLossDb the MaxLossDb attribute of the channel
+     * \returns the indexes of the stations which started receiving the PPDU, in order
+     */
+    std::vector<uint32_t> Broadcast(double maxRange, double maxLossDb);
+
+    /**
+     * Notify the beginning of the reception of a PPDU by a station.
+     * \param index the index of the station
+     * \param p the packet
+     * \param rxPowersW the receive power per channel band in Watts
+     */
+    void NotifyRxBegin(uint32_t index, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW);
+
+    static constexpr uint32_t m_nReceivers = 12; ///< the number of receiving stations
+    std::vector<uint32_t> m_received;        ///< the stations which received the last PPDU
+};
+
+YansWifiChannelReceiversTest::YansWifiChannelReceiversTest()
+    : TestCase("Check the receivers of a YansWifiChannel with MaxRange and MaxLossDb")
+{
+}
+
+void
+YansWifiChannelReceiversTest::NotifyRxBegin(uint32_t index,
+                                            Ptr<const Packet> p,
+                                            RxPowerWattPerChannelBand rxPowersW)
+{
+    m_received.push_back(index);
+}
+
+std::vector<uint32_t>
+YansWifiChannelReceiversTest::Broadcast(double maxRange, double maxLossDb)
+{
+    NodeContainer nodes;
+    nodes.Create(1 + m_nReceivers);
+
+    // the receiving station i is at 7 * i meters from the transmitter, in all directions
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    for (uint32_t i = 1; i <= m_nReceivers; i++)
+    {
+        positionAlloc->Add(Vector(7.0 * i * std::cos(i), 7.0 * i * std::sin(i), 0.0));
+    }
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    // the loss is 80 dB to the odd stations and 50 dB to the other ones, and the
+    // propagation delay is null, so that all the stations receive at the same time
+    Ptr<MatrixPropagationLossModel> lossModel = CreateObject<MatrixPropagationLossModel>();
+    lossModel->SetDefaultLoss(50);
+    for (uint32_t i = 1; i <= m_nReceivers; i += 2)
+    {
+        lossModel->SetLoss(nodes.Get(0)->GetObject<MobilityModel>(),
+                           nodes.Get(i)->GetObject<MobilityModel>(),
+                           80);
+    }
+    Ptr<YansWifiChannel> channel = CreateObject<YansWifiChannel>();
+    channel->SetPropagationLossModel(lossModel);
+    channel->SetPropagationDelayModel(
+        CreateObjectWithAttributes<ConstantSpeedPropagationDelayModel>("Speed",
+                                                                       DoubleValue(1e20)));
+    channel->SetAttribute("MaxRange", DoubleValue(maxRange));
+    channel->SetAttribute("MaxLossDb", DoubleValue(maxLossDb));
+
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("OfdmRate6Mbps"));
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    NetDeviceContainer devices = wifi.Install(phy, mac, nodes);
+
+    for (uint32_t i = 1; i <= m_nReceivers; i++)
+    {
+        DynamicCast<WifiNetDevice>(devices.Get(i))
+            ->GetPhy()
+            ->TraceConnectWithoutContext(
+                "PhyRxBegin",
+                MakeCallback(&YansWifiChannelReceiversTest::NotifyRxBegin, this).Bind(i));
+    }
+
+    Ptr<NetDevice> txDevice = devices.Get(0);
+    Simulator::Schedule(Seconds(1.0),
+                        &NetDevice::Send,
+                        txDevice,
+                        Create<Packet>(1000),
+                        txDevice->GetBroadcast(),
+                        1);
+
+    m_received.clear();
+    Simulator::Stop(Seconds(2.0));
+    Simulator::Run();
+    Simulator::Destroy();
+    return m_received;
+}
+
+void
+YansWifiChannelReceiversTest::DoRun()
+{
+    std::vector<uint32_t> all = Broadcast(0, 1e9);
+    NS_TEST_ASSERT_MSG_EQ(all.size(), m_nReceivers, "All the stations should receive the PPDU");
+
+    const double maxRange = 50;
+    std::vector<uint32_t> expected;
+    std::copy_if(all.begin(), all.end(), std::back_inserter(expected), [=](uint32_t i) {
+        return 7.0 * i <= maxRange;
+    });
+    NS_TEST_EXPECT_MSG_EQ((Broadcast(maxRange, 1e9) == expected),
+                          true,
+                          "The stations within range should receive the PPDU, in the same order");
+
+    expected.clear();
+    std::copy_if(all.begin(), all.end(), std::back_inserter(expected), [](uint32_t i) {
+        return i % 2 == 0;
+    });
+    NS_TEST_EXPECT_MSG_EQ((Broadcast(0, 70) == expected),
+                          true,
+                          "The stations with a loss above MaxLossDb should not receive the PPDU");
+
+    expected.clear();
+    std::copy_if(all.begin(), all.end(), std::back_inserter(expected), [=](uint32_t i) {
+        return i % 2 == 0 && 7.0 * i <= maxRange;
+    });
+    NS_TEST_EXPECT_MSG_EQ((Broadcast(maxRange, 70) == expected),
+                          true,
+                          "The stations within range and below MaxLossDb should receive the PPDU");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -3636,6 +3796,7 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new IdealRateManagerChannelWidthTest, TestCase::QUICK);
     AddTestCase(new IdealRateManagerMimoTest, TestCase::QUICK);
     AddTestCase(new HeRuMcsDataRateTestCase, TestCase::QUICK);
+    AddTestCase(new YansWifiChannelReceiversTest, TestCase::QUICK);
 }
 
 static WifiTestSuite g_wifiTestSuite; ///< the test suite
@@ -20,6 +20,7 @@
 
 #include "wimax-helper.h"
 
+#include "ns3/abort.h"
 #include "ns3/bs-net-device.h"
 #include "ns3/config.h"
 #include "ns3/log.h"
@@ -489,6 +490,12 @@ WimaxHelper::EnableAsciiInternal(Ptr<OutputStreamWrapper> stream,
     //
     Packet::EnablePrinting();
 
+    //
+    // Our trace sinks print the packets: they cannot write binary records.
+    //
+    NS_ABORT_MSG_IF(stream && stream->GetBinaryTrace(),
+                    "The WiMAX ascii trace sinks do not support binary trace streams");
+
     //
     // If we are not provided an OutputStreamWrapper, we are expected to create
     // one using the usual trace filename conventions and do a Hook*WithoutContext
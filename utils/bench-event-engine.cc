@@ -0,0 +1,910 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath> // sqrt
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * \file
+ * Benchmark of the event engine: the simulator and its Scheduler,
+ * with event mixes representative of network simulations.
+ */
+
+using namespace ns3;
+
+/**
+ * \name Heap allocation counters
+ * Updated by the replacements of the global operator new below.
+ * The benchmark is single-threaded, so the counters are not atomic.
+ */
+/** @{ */
+/** Number of calls to operator new. */
+uint64_t g_allocations = 0;
+/** Number of bytes requested from operator new. */
+uint64_t g_allocatedBytes = 0;
+/** @} */
+
+/**
+ * Replacement of the global operator new, counting the allocations.
+ * \param [in] size The number of bytes to allocate.
+ * \returns The allocated memory.
+ */
+void*
+operator new(std::size_t size)
+{
+    g_allocations++;
+    g_allocatedBytes += size;
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+/**
+ * Replacement of the global array operator new, counting the allocations.
+ * \param [in] size The number of bytes to allocate.
+ * \returns The allocated memory.
+ */
+void*
+operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+/**
+ * Replacement of the global operator delete.
+ * \param [in] p The memory to free.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC does not know that the memory was allocated by the operator new above
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void
+operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+/**
+ * Replacement of the global sized operator delete.
+ * \param [in] p The memory to free.
+ */
+void
+operator delete(void* p, std::size_t /* size */) noexcept
+{
+    operator delete(p);
+}
+
+/**
+ * Replacement of the global array operator delete.
+ * \param [in] p The memory to free.
+ */
+void
+operator delete[](void* p) noexcept
+{
+    operator delete(p);
+}
+
+/**
+ * Replacement of the global sized array operator delete.
+ * \param [in] p The memory to free.
+ */
+void
+operator delete[](void* p, std::size_t /* size */) noexcept
+{
+    operator delete(p);
+}
+
+/** Name of this program. */
+std::string g_me;
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+/** Log with program name prefix. */
+#define LOGME(x) LOG(g_me << x)
+
+/** The clock used to measure the latency of single operations. */
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Reset the peak resident set size of this process, where supported.
+ */
+void
+ResetPeakRss()
+{
+#ifdef __linux__
+    // Writing 5 to clear_refs resets VmHWM, since Linux 4.0
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+#endif
+}
+
+/**
+ * Get the peak resident set size of this process since the last call
+ * to ResetPeakRss().
+ * \returns The peak RSS in KiB, or -1 if not supported.
+ */
+int64_t
+GetPeakRss()
+{
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            return std::stoll(line.substr(6));
+        }
+    }
+#endif
+    return -1;
+}
+
+/**
+ * Samples of the latency of an operation.
+ */
+class LatencySamples
+{
+  public:
+    /**
+     * Add a sample.
+     * \param [in] start When the operation started.
+     */
+    void Add(Clock::time_point start)
+    {
+        auto elapsed = Clock::now() - start;
+        m_samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    /**
+     * Add the samples of another instance.
+     * \param [in] other The other samples.
+     */
+    void Add(const LatencySamples& other)
+    {
+        m_samples.insert(m_samples.end(), other.m_samples.begin(), other.m_samples.end());
+    }
+
+    /** Remove all the samples. */
+    void Clear()
+    {
+        m_samples.clear();
+    }
+
+    /**
+     * Get the number of samples.
+     * \returns The number of samples.
+     */
+    std::size_t GetSize() const
+    {
+        return m_samples.size();
+    }
+
+    /**
+     * Get a percentile of the samples.
+     * \param [in] percent The percentile, in [0, 100].
+     * \returns The percentile in ns, or 0 if there are no samples.
+     */
+    int64_t GetPercentile(double percent)
+    {
+        if (m_samples.empty())
+        {
+            return 0;
+        }
+        auto n = static_cast<std::size_t>(percent / 100 * (m_samples.size() - 1) + 0.5);
+        std::nth_element(m_samples.begin(), m_samples.begin() + n, m_samples.end());
+        return m_samples[n];
+    }
+
+  private:
+    std::vector<int64_t> m_samples; //!< The samples, in ns.
+};
+
+/**
+ * The event mixes.
+ */
+enum Scenario
+{
+    /**
+     * The classic hold model: each event schedules one more event after
+     * an exponential delay, keeping the population constant.
+     */
+    HOLD,
+    /**
+     * Cancel-heavy retransmission timers, as TCP RTO: each connection
+     * sends packets, and each packet cancels and restarts the timer of
+     * its connection, which therefore seldom expires.
+     */
+    TIMERS,
+    /**
+     * Bursts of simultaneous events, as the receptions of a broadcast:
+     * each source event schedules several events with the same timestamp.
+     */
+    BURST,
+    /**
+     * The hold model, where events also schedule events in the far future,
+     * as periodic reports or end of simulation timers, which accumulate in
+     * the event list.
+     */
+    FAR,
+};
+
+/** All the scenarios, in order. */
+const Scenario g_scenarios[] = {HOLD, TIMERS, BURST, FAR};
+
+/**
+ * Get the name of a scenario.
+ * \param [in] scenario The scenario.
+ * \returns The name.
+ */
+std::string
+GetScenarioName(Scenario scenario)
+{
+    switch (scenario)
+    {
+    case HOLD:
+        return "hold";
+    case TIMERS:
+        return "timers";
+    case BURST:
+        return "burst";
+    case FAR:
+        return "far";
+    }
+    return "unknown";
+}
+
+/** The configuration of the benchmark, common to all runs. */
+struct BenchConfig
+{
+    uint64_t pop;    //!< The event population size.
+    uint64_t total;  //!< The number of events to execute per run.
+    uint32_t sample; //!< Measure the latency of one operation out of \c sample.
+    double mean;     //!< Mean delay of the near events (ns).
+    double rto;      //!< Retransmission timeout of the timers scenario (ns).
+    uint32_t burst;  //!< Number of events per burst in the burst scenario.
+    double far;      //!< Probability to schedule a far event in the far scenario.
+};
+
+/**
+ * Benchmark instance which does a single run of one scenario.
+ */
+class Bench
+{
+  public:
+    /** The output. */
+    struct Result
+    {
+        double init;             //!< Time (s) for initialization.
+        double simu;             //!< Time (s) for simulation.
+        uint64_t events;         //!< Number of events executed.
+        uint64_t cancelled;      //!< Number of events cancelled.
+        int64_t peakRss;         //!< Peak RSS (KiB), or -1.
+        uint64_t allocations;    //!< Number of heap allocations.
+        uint64_t allocatedBytes; //!< Number of heap allocated bytes.
+    };
+
+    /**
+     * Constructor
+     * \param [in] config The configuration.
+     * \param [in] scenario The scenario.
+     * \param [in] total The total number of events to execute.
+     */
+    Bench(const BenchConfig& config, Scenario scenario, uint64_t total);
+
+    /**
+     * Run the benchmark as configured.
+     *
+     * \returns The Result.
+     */
+    Result Run();
+
+    LatencySamples m_schedule; //!< Latency of Simulator::Schedule().
+    LatencySamples m_cancel;   //!< Latency of Simulator::Cancel().
+    /**
+     * Latency from the end of an event to the start of the next one,
+     * which includes removing it from the Scheduler and skipping the
+     * cancelled events.
+     */
+    LatencySamples m_dispatch;
+
+  private:
+    /**
+     * Schedule an event, measuring a sample of the latencies.
+     * \tparam Ts \deduced The types of the arguments.
+     * \param [in] delay The delay of the event.
+     * \param [in] args The method and arguments to schedule.
+     * \returns The event.
+     */
+    template <typename... Ts>
+    EventId Schedule(const Time& delay, Ts&&... args);
+    /**
+     * Cancel an event, measuring a sample of the latencies.
+     * \param [in] id The event.
+     */
+    void Cancel(const EventId& id);
+    /**
+     * Get the delay of the next near event.
+     * \returns The delay.
+     */
+    Time NextDelay();
+
+    /**
+     * Account for the start of an event, checking for completion.
+     * \returns \c false if the run is complete.
+     */
+    bool Begin();
+    /** Account for the end of an event. */
+    void End();
+
+    /** Event of the hold and far scenarios. */
+    void HoldEvent();
+    /** Far future event. */
+    void FarEvent();
+    /**
+     * Packet of a connection, restarting its timer.
+     * \param [in] connection The index of the connection.
+     */
+    void PacketEvent(uint32_t connection);
+    /** Expiration of the timer of a connection. */
+    void TimeoutEvent();
+    /** Broadcast by a source, followed by simultaneous receptions. */
+    void SourceEvent();
+    /** Reception of a broadcast. */
+    void ReceiveEvent();
+
+    BenchConfig m_config;                  //!< The configuration.
+    Scenario m_scenario;                   //!< The scenario.
+    uint64_t m_total;                      //!< The number of events to execute.
+    uint64_t m_count;                      //!< The number of events executed so far.
+    uint64_t m_cancelled;                  //!< The number of events cancelled so far.
+    uint64_t m_operations;                 //!< The number of operations so far.
+    bool m_measureDispatch;                //!< Whether to measure the next dispatch.
+    Clock::time_point m_lastEnd;           //!< End of the last measured event.
+    Ptr<ExponentialRandomVariable> m_near; //!< Near event delays.
+    Ptr<UniformRandomVariable> m_uniform;  //!< Far event delays and probability.
+    std::vector<EventId> m_timers;         //!< The timer of each connection.
+
+}; // class Bench
+
+Bench::Bench(const BenchConfig& config, Scenario scenario, uint64_t total)
+    : m_config(config),
+      m_scenario(scenario),
+      m_total(total),
+      m_count(0),
+      m_cancelled(0),
+      m_operations(0),
+      m_measureDispatch(false)
+{
+    m_near = CreateObject<ExponentialRandomVariable>();
+    m_near->SetAttribute("Mean", DoubleValue(config.mean));
+    m_uniform = CreateObject<UniformRandomVariable>();
+}
+
+template <typename... Ts>
+EventId
+Bench::Schedule(const Time& delay, Ts&&... args)
+{
+    if (++m_operations % m_config.sample != 0)
+    {
+        return Simulator::Schedule(delay, std::forward<Ts>(args)...);
+    }
+    auto start = Clock::now();
+    EventId id = Simulator::Schedule(delay, std::forward<Ts>(args)...);
+    m_schedule.Add(start);
+    return id;
+}
+
+void
+Bench::Cancel(const EventId& id)
+{
+    m_cancelled++;
+    if (++m_operations % m_config.sample != 0)
+    {
+        Simulator::Cancel(id);
+        return;
+    }
+    auto start = Clock::now();
+    Simulator::Cancel(id);
+    m_cancel.Add(start);
+}
+
+Time
+Bench::NextDelay()
+{
+    return NanoSeconds(m_near->GetValue());
+}
+
+bool
+Bench::Begin()
+{
+    if (m_measureDispatch)
+    {
+        m_dispatch.Add(m_lastEnd);
+        m_measureDispatch = false;
+    }
+    if (m_count >= m_total)
+    {
+        Simulator::Stop();
+        return false;
+    }
+    ++m_count;
+    return true;
+}
+
+void
+Bench::End()
+{
+    if (m_count % m_config.sample == 0)
+    {
+        m_measureDispatch = true;
+        m_lastEnd = Clock::now();
+    }
+}
+
+void
+Bench::HoldEvent()
+{
+    if (!Begin())
+    {
+        return;
+    }
+    Schedule(NextDelay(), &Bench::HoldEvent, this);
+    if (m_scenario == FAR && m_uniform->GetValue() < m_config.far)
+    {
+        // Between 1 and 10 s ahead, beyond the end of the run
+        Schedule(NanoSeconds(m_uniform->GetValue(1e9, 1e10)), &Bench::FarEvent, this);
+    }
+    End();
+}
+
+void
+Bench::FarEvent()
+{
+    if (Begin())
+    {
+        End();
+    }
+}
+
+void
+Bench::PacketEvent(uint32_t connection)
+{
+    if (!Begin())
+    {
+        return;
+    }
+    Cancel(m_timers[connection]);
+    m_timers[connection] = Schedule(NanoSeconds(m_config.rto), &Bench::TimeoutEvent, this);
+    Schedule(NextDelay(), &Bench::PacketEvent, this, connection);
+    End();
+}
+
+void
+Bench::TimeoutEvent()
+{
+    if (Begin())
+    {
+        End();
+    }
+}
+
+void
+Bench::SourceEvent()
+{
+    if (!Begin())
+    {
+        return;
+    }
+    Time delay = NextDelay();
+    for (uint32_t i = 0; i < m_config.burst; i++)
+    {
+        Schedule(delay, &Bench::ReceiveEvent, this);
+    }
+    Schedule(NextDelay(), &Bench::SourceEvent, this);
+    End();
+}
+
+void
+Bench::ReceiveEvent()
+{
+    if (Begin())
+    {
+        End();
+    }
+}
+
+Bench::Result
+Bench::Run()
+{
+    SystemWallClockMs timer;
+
+    // Same event sequence for every scheduler
+    m_near->SetStream(1);
+    m_uniform->SetStream(2);
+    m_count = 0;
+    m_cancelled = 0;
+    m_operations = 0;
+    m_measureDispatch = false;
+    m_schedule.Clear();
+    m_cancel.Clear();
+    m_dispatch.Clear();
+
+    ResetPeakRss();
+    uint64_t allocations = g_allocations;
+    uint64_t allocatedBytes = g_allocatedBytes;
+
+    timer.Start();
+    switch (m_scenario)
+    {
+    case HOLD:
+    case FAR:
+        for (uint64_t i = 0; i < m_config.pop; ++i)
+        {
+            Simulator::Schedule(NextDelay(), &Bench::HoldEvent, this);
+        }
+        break;
+    case TIMERS:
+        m_timers.assign(m_config.pop, EventId());
+        for (uint32_t i = 0; i < m_config.pop; ++i)
+        {
+            Simulator::Schedule(NextDelay(), &Bench::PacketEvent, this, i);
+        }
+        break;
+    case BURST:
+        // Keep the population comparable to the other scenarios
+        for (uint64_t i = 0; i < std::max<uint64_t>(1, m_config.pop / m_config.burst); ++i)
+        {
+            Simulator::Schedule(NextDelay(), &Bench::SourceEvent, this);
+        }
+        break;
+    }
+    double init = timer.End() / 1000.0;
+
+    timer.Start();
+    Simulator::Run();
+    double simu = timer.End() / 1000.0;
+
+    Result result{init,
+                  simu,
+                  m_count,
+                  m_cancelled,
+                  GetPeakRss(),
+                  g_allocations - allocations,
+                  g_allocatedBytes - allocatedBytes};
+
+    m_timers.clear();
+    Simulator::Destroy();
+
+    return result;
+}
+
+/** Benchmark which performs an ensemble of runs of one scenario. */
+class BenchSuite
+{
+  public:
+    /**
+     * Perform the runs of a scenario for a single scheduler type.
+     *
+     * This will create and set the scheduler, then execute a priming run
+     * followed by the number of data runs requested.
+     *
+     * \param [in] factory Factory pre-configured to create the desired Scheduler.
+     * \param [in] config The configuration.
+     * \param [in] scenario The scenario.
+     * \param [in] total The total number of events to execute.
+     * \param [in] runs The number of replications.
+     */
+    BenchSuite(ObjectFactory& factory,
+               const BenchConfig& config,
+               Scenario scenario,
+               uint64_t total,
+               uint64_t runs);
+
+    /** Write the summary of the results to \c LOG() */
+    void Log();
+
+    /**
+     * Write the results as a JSON object.
+     * \param [in] os The output stream.
+     * \param [in] indent The indentation of the object.
+     */
+    void WriteJson(std::ostream& os, const std::string& indent);
+
+  private:
+    std::string m_scheduler;              //!< The scheduler type name.
+    Scenario m_scenario;                  //!< The scenario.
+    std::vector<Bench::Result> m_results; //!< Store for the run results.
+    LatencySamples m_schedule;            //!< Latency of Simulator::Schedule().
+    LatencySamples m_cancel;              //!< Latency of Simulator::Cancel().
+    LatencySamples m_dispatch;            //!< Latency of the event dispatch.
+    double m_rate;                        //!< Average event rate (events/s).
+    double m_rateStdev;                   //!< Standard deviation of the event rate.
+
+}; // BenchSuite
+
+BenchSuite::BenchSuite(ObjectFactory& factory,
+                       const BenchConfig& config,
+                       Scenario scenario,
+                       uint64_t total,
+                       uint64_t runs)
+    : m_scheduler(factory.GetTypeId().GetName()),
+      m_scenario(scenario)
+{
+    Simulator::SetScheduler(factory);
+
+    Bench bench(config, scenario, total);
+
+    // Prime
+    bench.Run();
+
+    // Perform the actual runs
+    for (uint64_t i = 0; i < runs; i++)
+    {
+        m_results.push_back(bench.Run());
+        m_schedule.Add(bench.m_schedule);
+        m_cancel.Add(bench.m_cancel);
+        m_dispatch.Add(bench.m_dispatch);
+    }
+
+    Simulator::Destroy();
+
+    // Welford's online algorithm, as in bench-scheduler
+    m_rate = 0;
+    double moment2 = 0;
+    uint64_t n = 0;
+    for (const auto& run : m_results)
+    {
+        double rate = run.events / run.simu;
+        ++n;
+        double deltaPre = rate - m_rate;
+        m_rate += deltaPre / n;
+        moment2 += deltaPre * (rate - m_rate);
+    }
+    m_rateStdev = n ? std::sqrt(moment2 / n) : 0;
+
+} // BenchSuite::BenchSuite
+
+void
+BenchSuite::Log()
+{
+    int64_t peakRss = -1;
+    uint64_t allocations = 0;
+    for (const auto& run : m_results)
+    {
+        peakRss = std::max(peakRss, run.peakRss);
+        allocations = std::max(allocations, run.allocations);
+    }
+
+    std::ostringstream latencies;
+    for (auto samples : {&m_schedule, &m_cancel, &m_dispatch})
+    {
+        latencies << std::setw(7) << samples->GetPercentile(50) << "/" << std::left
+                  << std::setw(7) << samples->GetPercentile(99) << std::right;
+    }
+
+    LOG(std::left << std::setw(28) << m_scheduler << std::setw(8) << GetScenarioName(m_scenario)
+                  << std::right << std::setw(12) << std::setprecision(4) << m_rate
+                  << latencies.str() << std::setw(10) << peakRss << std::setw(12)
+                  << allocations);
+}
+
+void
+BenchSuite::WriteJson(std::ostream& os, const std::string& indent)
+{
+    os << indent << "{\n"
+       << indent << "  \"scheduler\": \"" << m_scheduler << "\",\n"
+       << indent << "  \"scenario\": \"" << GetScenarioName(m_scenario) << "\",\n"
+       << indent << "  \"eventsPerSecond\": " << m_rate << ",\n"
+       << indent << "  \"eventsPerSecondStdev\": " << m_rateStdev << ",\n"
+       << indent << "  \"latencyNs\": {\n";
+    std::pair<const char*, LatencySamples*> operations[] = {{"schedule", &m_schedule},
+                                                            {"cancel", &m_cancel},
+                                                            {"dispatch", &m_dispatch}};
+    for (auto& [name, samples] : operations)
+    {
+        os << indent << "    \"" << name << "\": {\"p50\": " << samples->GetPercentile(50)
+           << ", \"p99\": " << samples->GetPercentile(99) << ", \"samples\": " << samples->GetSize()
+           << "}" << (samples != &m_dispatch ? "," : "") << "\n";
+    }
+    os << indent << "  },\n" << indent << "  \"runs\": [\n";
+    for (std::size_t i = 0; i < m_results.size(); i++)
+    {
+        const auto& run = m_results[i];
+        os << indent << "    {\"initSeconds\": " << run.init << ", \"runSeconds\": " << run.simu
+           << ", \"events\": " << run.events << ", \"cancelled\": " << run.cancelled
+           << ", \"eventsPerSecond\": " << run.events / run.simu << ", \"peakRssKiB\": ";
+        if (run.peakRss < 0)
+        {
+            os << "null";
+        }
+        else
+        {
+            os << run.peakRss;
+        }
+        os << ", \"allocations\": " << run.allocations
+           << ", \"allocatedBytes\": " << run.allocatedBytes << "}"
+           << (i + 1 < m_results.size() ? "," : "") << "\n";
+    }
+    os << indent << "  ]\n" << indent << "}";
+}
+
+int
+main(int argc, char* argv[])
+{
+    BenchConfig config;
+    config.pop = 10000;
+    config.total = 1000000;
+    config.sample = 64;
+    config.mean = 100;
+    config.rto = 1000;
+    config.burst = 16;
+    config.far = 0.01;
+    uint64_t runs = 1;
+    std::string schedulers = "";
+    std::string scenarios = "";
+    std::string json = "";
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the event engine, with every Scheduler.\n"
+              "\n"
+              "Scenarios:\n"
+              "  hold:   each event schedules one event, after an exponential delay\n"
+              "  timers: connections restarting a timer at each packet, as TCP RTO\n"
+              "  burst:  sources scheduling bursts of simultaneous events\n"
+              "  far:    as hold, also scheduling events 1 to 10 s in the future\n"
+              "\n"
+              "For each scheduler and scenario, reports the event rate, the\n"
+              "p50/p99 latency of Schedule, Cancel and of the dispatch of the\n"
+              "next event, the peak RSS and the number of heap allocations.\n"
+              "The ListScheduler runs 1/10 of the total events.");
+    cmd.AddValue("schedulers",
+                 "comma separated Scheduler types to run, by default all of them",
+                 schedulers);
+    cmd.AddValue("scenarios",
+                 "comma separated scenarios to run, by default all of them",
+                 scenarios);
+    cmd.AddValue("pop", "event population size", config.pop);
+    cmd.AddValue("total", "total number of events to run", config.total);
+    cmd.AddValue("runs", "number of runs", runs);
+    cmd.AddValue("sample", "measure the latency of one operation out of this many", config.sample);
+    cmd.AddValue("mean", "mean delay of the near events (ns)", config.mean);
+    cmd.AddValue("rto", "retransmission timeout of the timers scenario (ns)", config.rto);
+    cmd.AddValue("burst", "number of events per burst in the burst scenario", config.burst);
+    cmd.AddValue("far", "probability to schedule a far event in the far scenario", config.far);
+    cmd.AddValue("json", "write the results as JSON to this file, - for stdout", json);
+    cmd.Parse(argc, argv);
+
+    g_me = cmd.GetName() + ": ";
+    config.sample = std::max(config.sample, 1U);
+    config.burst = std::max(config.burst, 1U);
+
+    // Find the schedulers
+    std::vector<TypeId> types;
+    for (uint16_t i = 0; i < TypeId::GetRegisteredN(); i++)
+    {
+        TypeId tid = TypeId::GetRegistered(i);
+        if (tid.IsChildOf(Scheduler::GetTypeId()) && tid.HasConstructor() &&
+            (schedulers.empty() || ("," + schedulers + ",").find("," + tid.GetName() + ",") !=
+                                       std::string::npos))
+        {
+            types.push_back(tid);
+        }
+    }
+    std::sort(types.begin(), types.end(), [](TypeId a, TypeId b) {
+        return a.GetName() < b.GetName();
+    });
+    if (types.empty())
+    {
+        LOGME("no Scheduler matches " << schedulers);
+        return 1;
+    }
+
+    // Write the table to stderr if the JSON output is on stdout
+    std::streambuf* coutBuf = std::cout.rdbuf();
+    if (json == "-")
+    {
+        std::cout.rdbuf(std::cerr.rdbuf());
+    }
+
+    LOG("");
+    LOGME(" Benchmark the event engine");
+    LOG("  Event population size:        " << config.pop);
+    LOG("  Total events per run:         " << config.total);
+    LOG("  Number of runs per scenario:  " << runs);
+    LOG("");
+    LOG(std::left << std::setw(28) << "Scheduler" << std::setw(8) << "Mix" << std::right
+                  << std::setw(12) << "Rate (ev/s)" << std::setw(15) << "Schedule (ns)"
+                  << std::setw(15) << "Cancel (ns)" << std::setw(15) << "Dispatch (ns)"
+                  << std::setw(10) << "RSS (KiB)" << std::setw(12) << "Allocations");
+    LOG(std::left << std::setw(28 + 8 + 12) << "" << std::right << std::setw(15) << "p50/p99  "
+                  << std::setw(15) << "p50/p99  " << std::setw(15) << "p50/p99  ");
+
+    std::vector<BenchSuite> suites;
+    for (auto tid : types)
+    {
+        ObjectFactory factory;
+        factory.SetTypeId(tid);
+        uint64_t total = config.total;
+        if (tid.GetName() == "ns3::ListScheduler")
+        {
+            total /= 10;
+        }
+        for (auto scenario : g_scenarios)
+        {
+            if (!scenarios.empty() &&
+                ("," + scenarios + ",").find("," + GetScenarioName(scenario) + ",") ==
+                    std::string::npos)
+            {
+                continue;
+            }
+            suites.emplace_back(factory, config, scenario, total, runs);
+            suites.back().Log();
+        }
+    }
+    LOG("");
+
+    std::cout.rdbuf(coutBuf);
+
+    if (!json.empty())
+    {
+        std::ofstream file;
+        if (json != "-")
+        {
+            file.open(json);
+            if (!file.is_open())
+            {
+                LOGME("unable to open " << json);
+                return 1;
+            }
+        }
+        std::ostream& os = json == "-" ? std::cout : file;
+        os << std::setprecision(6);
+        os << "{\n"
+           << "  \"benchmark\": \"bench-event-engine\",\n"
+           << "  \"parameters\": {\"pop\": " << config.pop << ", \"total\": " << config.total
+           << ", \"runs\": " << runs << ", \"sample\": " << config.sample
+           << ", \"mean\": " << config.mean << ", \"rto\": " << config.rto
+           << ", \"burst\": " << config.burst << ", \"far\": " << config.far << "},\n"
+           << "  \"results\": [\n";
+        for (std::size_t i = 0; i < suites.size(); i++)
+        {
+            suites[i].WriteJson(os, "    ");
+            os << (i + 1 < suites.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+    return 0;
+}
@@ -21,7 +21,9 @@
 // operations using Headers and Tags, for various numbers of packets 'n'
 // Sample usage:  ./ns3 run 'bench-packets --n=10000'
 
+#include "ns3/buffer-pool.h"
 #include "ns3/command-line.h"
+#include "ns3/header-field.h"
 #include "ns3/packet-metadata.h"
 #include "ns3/packet.h"
 #include "ns3/system-wall-clock-ms.h"
@@ -32,6 +34,7 @@
 #include <sstream>
 #include <stdlib.h> // for exit ()
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -147,6 +150,131 @@ BenchHeader<N>::Deserialize(Buffer::Iterator start)
     return N;
 }
 
+/**
+ * BenchFieldsHeader class used for benchmarking the serialization of a
+ * header with the layout of an IPv4 header, either field by field or at
+ * once, through Buffer::Iterator spans and HeaderField.
+ */
+template <bool SPAN>
+class BenchFieldsHeader : public Header
+{
+  public:
+    /**
+     * Register this type.
+     * \return The TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId(SPAN ? "ns3::BenchFieldsHeader<span>" : "ns3::BenchFieldsHeader")
+                                .SetParent<Header>()
+                                .SetGroupName("Utils")
+                                .HideFromDocumentation()
+                                .AddConstructor<BenchFieldsHeader<SPAN>>();
+        return tid;
+    }
+
+    TypeId GetInstanceTypeId() const override
+    {
+        return GetTypeId();
+    }
+
+    void Print(std::ostream& os) const override
+    {
+        NS_ASSERT(false);
+    }
+
+    uint32_t GetSerializedSize() const override
+    {
+        return Destination::END;
+    }
+
+    void Serialize(Buffer::Iterator start) const override
+    {
+        if (SPAN)
+        {
+            uint8_t* header = start.WriteSpan(Destination::END);
+            VerIhl::Write(header, 0x45);
+            Tos::Write(header, m_tos);
+            TotalLength::Write(header, m_length);
+            Identification::Write(header, m_identification);
+            FlagsFragment::Write(header, m_flagsFragment);
+            Ttl::Write(header, m_ttl);
+            Protocol::Write(header, m_protocol);
+            Checksum::Write(header, m_checksum);
+            Source::Write(header, m_source);
+            Destination::Write(header, m_destination);
+        }
+        else
+        {
+            start.WriteU8(0x45);
+            start.WriteU8(m_tos);
+            start.WriteHtonU16(m_length);
+            start.WriteHtonU16(m_identification);
+            start.WriteHtonU16(m_flagsFragment);
+            start.WriteU8(m_ttl);
+            start.WriteU8(m_protocol);
+            start.WriteU16(m_checksum);
+            start.WriteHtonU32(m_source);
+            start.WriteHtonU32(m_destination);
+        }
+    }
+
+    uint32_t Deserialize(Buffer::Iterator start) override
+    {
+        if (SPAN)
+        {
+            uint8_t scratch[Destination::END];
+            const uint8_t* header = start.ReadSpan(scratch, Destination::END);
+            VerIhl::Read(header);
+            m_tos = Tos::Read(header);
+            m_length = TotalLength::Read(header);
+            m_identification = Identification::Read(header);
+            m_flagsFragment = FlagsFragment::Read(header);
+            m_ttl = Ttl::Read(header);
+            m_protocol = Protocol::Read(header);
+            m_checksum = Checksum::Read(header);
+            m_source = Source::Read(header);
+            m_destination = Destination::Read(header);
+        }
+        else
+        {
+            start.ReadU8();
+            m_tos = start.ReadU8();
+            m_length = start.ReadNtohU16();
+            m_identification = start.ReadNtohU16();
+            m_flagsFragment = start.ReadNtohU16();
+            m_ttl = start.ReadU8();
+            m_protocol = start.ReadU8();
+            m_checksum = start.ReadU16();
+            m_source = start.ReadNtohU32();
+            m_destination = start.ReadNtohU32();
+        }
+        return Destination::END;
+    }
+
+  private:
+    using VerIhl = HeaderField<0, uint8_t>;                           ///< Version and length
+    using Tos = HeaderField<VerIhl::END, uint8_t>;                    ///< Type of service
+    using TotalLength = HeaderField<Tos::END, uint16_t>;              ///< Total length
+    using Identification = HeaderField<TotalLength::END, uint16_t>;   ///< Identification
+    using FlagsFragment = HeaderField<Identification::END, uint16_t>; ///< Flags, fragment offset
+    using Ttl = HeaderField<FlagsFragment::END, uint8_t>;             ///< Time to live
+    using Protocol = HeaderField<Ttl::END, uint8_t>;                  ///< Protocol
+    using Checksum = HeaderField<Protocol::END, uint16_t, false>;     ///< Checksum
+    using Source = HeaderField<Checksum::END, uint32_t>;              ///< Source address
+    using Destination = HeaderField<Source::END, uint32_t>;           ///< Destination address
+
+    uint8_t m_tos{0x10};                ///< Type of service
+    uint16_t m_length{1500};            ///< Total length
+    uint16_t m_identification{0x1234};  ///< Identification
+    uint16_t m_flagsFragment{0x4000};   ///< Flags and fragment offset
+    uint8_t m_ttl{64};                  ///< Time to live
+    uint8_t m_protocol{17};             ///< Protocol
+    uint16_t m_checksum{0xabcd};        ///< Checksum
+    uint32_t m_source{0x0a000001};      ///< Source address
+    uint32_t m_destination{0x0a000002}; ///< Destination address
+};
+
 /// BenchTag class used for benchmarking packet serialization/deserialization
 template <int N>
 class BenchTag : public Tag
@@ -237,6 +365,31 @@ benchD(uint32_t n)
     }
 }
 
+/**
+ * Add and remove headers with the layout of an IPv4 header.
+ * \tparam SPAN whether to serialize the headers at once rather than field by field
+ * \param n the number of packets
+ */
+template <bool SPAN>
+static void
+benchFields(uint32_t n)
+{
+    BenchFieldsHeader<SPAN> header;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        Ptr<Packet> p = Create<Packet>(1000);
+        for (uint32_t j = 0; j < 4; j++)
+        {
+            p->AddHeader(header);
+        }
+        for (uint32_t j = 0; j < 4; j++)
+        {
+            p->RemoveHeader(header);
+        }
+    }
+}
+
 static void
 benchA(uint32_t n)
 {
@@ -350,6 +503,75 @@ benchByteTags(uint32_t n)
     }
 }
 
+static void
+benchPacketTags(uint32_t n)
+{
+    // Small tags of the sizes of a FlowIdTag, a TimestampTag, an SnrTag
+    // and an LtePhyTag, added and removed along a path of four hops.
+    BenchTag<4> flowId;
+    BenchTag<8> timestamp;
+    BenchTag<9> snr;
+    BenchTag<2> phy;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        Ptr<Packet> p = Create<Packet>(1000);
+        p->AddPacketTag(flowId);
+        p->AddPacketTag(timestamp);
+        for (uint32_t hop = 0; hop < 4; hop++)
+        {
+            Ptr<Packet> q = p->Copy();
+            q->AddPacketTag(phy);
+            q->AddPacketTag(snr);
+            q->PeekPacketTag(flowId);
+            q->RemovePacketTag(snr);
+            q->RemovePacketTag(phy);
+            q->PeekPacketTag(timestamp);
+            p = q;
+        }
+        p->RemovePacketTag(timestamp);
+        p->RemovePacketTag(flowId);
+    }
+}
+
+static void
+benchCopyUntagged(uint32_t n)
+{
+    // Packets without packet tags, copied for each receiver of a
+    // broadcast channel.
+    BenchHeader<25> ipv4;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        Ptr<Packet> p = Create<Packet>(1000);
+        p->AddHeader(ipv4);
+        for (uint32_t receiver = 0; receiver < 8; receiver++)
+        {
+            Ptr<Packet> q = p->Copy();
+        }
+    }
+}
+
+static void
+benchMixedSizes(uint32_t n)
+{
+    BenchHeader<25> ipv4;
+    BenchHeader<8> udp;
+    // Acknowledgments, full-size frames, and an occasional aggregate,
+    // held in a window of in-flight packets as in a device queue.
+    static uint8_t payload[65000] = {0};
+    const uint32_t sizes[] = {64, 1500, 64, 1500, 64, 1500, 64, 65000};
+    std::vector<Ptr<Packet>> window(64);
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        Ptr<Packet> p = Create<Packet>(payload, sizes[i % 8]);
+        p->AddHeader(udp);
+        p->AddHeader(ipv4);
+        window[i % window.size()] = p;
+    }
+}
+
 static uint64_t
 runBenchOneIteration(void (*bench)(uint32_t), uint32_t n)
 {
@@ -382,6 +604,7 @@ main(int argc, char* argv[])
     uint32_t n = 0;
     uint32_t minIterations = 1;
     bool enablePrinting = false;
+    bool enableCompactPrinting = false;
 
     CommandLine cmd(__FILE__);
     cmd.Usage("Benchmark Packet class");
@@ -390,8 +613,20 @@ main(int argc, char* argv[])
                  "number of subiterations to minimize iteration time over",
                  minIterations);
     cmd.AddValue("enable-printing", "enable packet printing", enablePrinting);
+    cmd.AddValue("enable-compact-printing",
+                 "enable packet printing with the compact metadata representation",
+                 enableCompactPrinting);
     cmd.Parse(argc, argv);
 
+    if (enableCompactPrinting)
+    {
+        Packet::EnableCompactPrinting();
+    }
+    else if (enablePrinting)
+    {
+        Packet::EnablePrinting();
+    }
+
     if (n == 0)
     {
         std::cerr << "Error-- number of packets must be specified "
@@ -407,6 +642,20 @@ main(int argc, char* argv[])
     runBench(&benchD, n, minIterations, "Intermixed add/remove headers and tags");
     runBench(&benchFragment, n, minIterations, "Fragmentation and concatenation");
     runBench(&benchByteTags, n, minIterations, "Benchmark byte tags");
+    runBench(&benchPacketTags, n, minIterations, "Benchmark packet tags");
+    runBench(&benchCopyUntagged, n, minIterations, "Copy packets without packet tags");
+    runBench(&benchFields<false>, n, minIterations, "Fixed-layout headers, field by field");
+    runBench(&benchFields<true>, n, minIterations, "Fixed-layout headers, at once");
+
+    BufferPool::ResetStatistics();
+    runBench(&benchMixedSizes, n, minIterations, "Mixed packet sizes");
+    BufferPool::Statistics stats = BufferPool::GetStatistics();
+    uint64_t allocations = stats.hits + stats.misses + stats.oversize;
+    std::cout << "Buffer pool: " << stats.hits << " hits, " << stats.misses << " misses, "
+              << stats.oversize << " oversize, hit rate "
+              << 100.0 * stats.hits / std::max<uint64_t>(1, allocations) << "%, "
+              << stats.outstandingBytes << " bytes outstanding, " << BufferPool::GetReservedBytes()
+              << " bytes reserved" << std::endl;
 
     return 0;
 }
@@ -278,6 +278,12 @@ BenchSuite::BenchSuite(ObjectFactory& factory,
     {
         m_scheduler += ": insertion order: " + std::string(calRev ? "reverse" : "normal");
     }
+    if (m_scheduler == "ns3::DaryHeapScheduler")
+    {
+        UintegerValue arity;
+        factory.Create<Scheduler>()->GetAttribute("Arity", arity);
+        m_scheduler += ": arity " + std::to_string(arity.Get());
+    }
     if (m_scheduler == "ns3::MapScheduler")
     {
         m_scheduler += " (default)";
@@ -456,6 +462,7 @@ main(int argc, char* argv[])
 {
     bool allSched = false;
     bool schedCal = false;
+    bool schedDary = false;
     bool schedHeap = false;
     bool schedList = false;
     bool schedMap = false; // default scheduler
@@ -466,6 +473,7 @@ main(int argc, char* argv[])
     uint64_t runs = 1;
     std::string filename = "";
     bool calRev = false;
+    uint32_t arity = 4;
 
     CommandLine cmd(__FILE__);
     cmd.Usage("Benchmark the simulator scheduler.\n"
@@ -481,6 +489,8 @@ main(int argc, char* argv[])
     cmd.AddValue("all", "use all schedulers", allSched);
     cmd.AddValue("cal", "use CalendarSheduler", schedCal);
     cmd.AddValue("calrev", "reverse ordering in the CalendarScheduler", calRev);
+    cmd.AddValue("dary", "use DaryHeapScheduler", schedDary);
+    cmd.AddValue("arity", "arity of the DaryHeapScheduler", arity);
     cmd.AddValue("heap", "use HeapScheduler", schedHeap);
     cmd.AddValue("list", "use ListSheduler", schedList);
     cmd.AddValue("map", "use MapScheduler (default)", schedMap);
@@ -505,10 +515,10 @@ main(int argc, char* argv[])
 
     if (allSched)
     {
-        schedCal = schedHeap = schedList = schedMap = schedPQ = true;
+        schedCal = schedDary = schedHeap = schedList = schedMap = schedPQ = true;
     }
     // Set the default case if nothing else is set
-    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ))
+    if (!(schedCal || schedDary || schedHeap || schedList || schedMap || schedPQ))
     {
         schedMap = true;
     }
@@ -527,6 +537,12 @@ main(int argc, char* argv[])
             BenchSuite(factory, pop, total, runs, eventStream, !calRev).Log();
         }
     }
+    if (schedDary)
+    {
+        factory.SetTypeId("ns3::DaryHeapScheduler");
+        factory.Set("Arity", UintegerValue(arity));
+        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+    }
     if (schedHeap)
     {
         factory.SetTypeId("ns3::HeapScheduler");
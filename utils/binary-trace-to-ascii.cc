@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 ns-3 project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program converts a binary trace, written by the default ascii trace
+// sinks to a stream created by AsciiTraceHelper::CreateBinaryFileStream, to
+// the text of the ascii traces.
+// Sample usage:  ./ns3 run 'binary-trace-to-ascii --input=trace.bin --output=trace.tr'
+
+#include "ns3/binary-trace-writer.h"
+#include "ns3/command-line.h"
+
+#include <fstream>
+#include <iostream>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    std::string input;
+    std::string output;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Convert a binary trace to an ascii trace");
+    cmd.AddValue("input", "binary trace to convert", input);
+    cmd.AddValue("output", "ascii trace to write, or the standard output if empty", output);
+    cmd.Parse(argc, argv);
+
+    std::ifstream binary(input, std::ios::in | std::ios::binary);
+    if (!binary)
+    {
+        std::cerr << "Unable to open " << input << std::endl;
+        return 1;
+    }
+    std::ofstream file;
+    if (!output.empty())
+    {
+        file.open(output);
+        if (!file)
+        {
+            std::cerr << "Unable to open " << output << std::endl;
+            return 1;
+        }
+    }
+
+    if (!BinaryTraceWriter::ConvertToAscii(binary, output.empty() ? std::cout : file))
+    {
+        std::cerr << input << " is not a valid binary trace" << std::endl;
+        return 1;
+    }
+    return 0;
+}